@@ -1,6 +1,7 @@
 package vlab.cs.ucsb.edu;
 
 import java.math.BigInteger;
+import java.util.List;
 import java.util.Map;
 
 /**
@@ -27,9 +28,17 @@ public class DriverProxy {
 		LIMIT_LEN_IMPLICATIONS(10),
 		ENABLE_SORTING_HEURISTICS(11), 		// default option
 		DISABLE_SORTING_HEURISTICS(12), 
-		REGEX_FLAG(13),
-		OUTPUT_PATH(14), 					// not actively used through Java
-		SCRIPT_PATH(15);					// not actively used
+		FORCE_DNF_FORMULA(13),
+		COUNT_BOUND_EXACT(14),
+		REGEX_FLAG(15),
+		OUTPUT_PATH(16), 					// not actively used through Java
+		SCRIPT_PATH(17),					// not actively used
+		NUM_OF_THREADS(18),					// 0 uses all cores (default option), fixed once the thread pool starts
+		CACHE_PATH(19),						// persistent constraint cache file, disabled by default
+		AUTOMATON_CACHE_SIZE(20),			// memory budget of automata operation cache in MB (default 256), 0 disables
+		SYMBOLIC_ARITHMETIC_THRESHOLD(21),	// arithmetic automata with at least that many variables are built as bdds
+		ENABLE_SATISFIABILITY_ONLY(22),		// top level disjunctions stop at the first sat disjunct, the dnf is generated lazily with FORCE_DNF_FORMULA, no counting afterwards
+		DISABLE_SATISFIABILITY_ONLY(23);	// default option
 
 		private final int value;
 
@@ -116,7 +125,24 @@ public class DriverProxy {
 
 	private native void setOption(final int option, final String value);
 
+	/**
+	 * Throws IllegalArgumentException when the constraint does not parse or uses an undeclared variable.
+	 */
 	public native boolean isSatisfiable(final String constraint);
+	
+	/**
+	 * Adds declarations and assertions to the incremental session, keeps results of the previous assertions.
+	 * Session is cleared by {@link #reset()} and {@link #isSatisfiable(String)}.
+	 * Throws IllegalArgumentException after processing the valid commands if some commands are malformed.
+	 */
+	public native boolean assertIncremental(final String constraint);
+	
+	public native void push();
+	
+	/**
+	 * Throws IllegalArgumentException if there are fewer levels than given.
+	 */
+	public native void pop(final int levels);
 
 	public native BigInteger countVariable(final String varName, final long bound);
 	
@@ -126,6 +152,16 @@ public class DriverProxy {
 	
 	public native BigInteger count(final long intBound, final long strBound);
 	
+	public native BigInteger[] countVariable(final String varName, final long[] bounds);
+
+	public native BigInteger[] countInts(final long[] bounds);
+
+	public native BigInteger[] countStrs(final long[] bounds);
+
+	public native BigInteger[] countAll(final long[] bounds);
+
+	public native BigInteger[] countRange(final long lowerBound, final long upperBound, final long step);
+
 	public native byte[] getModelCounterForVariable(final String varName);
 	
 	public native byte[] getModelCounter();
@@ -148,6 +184,24 @@ public class DriverProxy {
 
 	public native Map<String, String> getSatisfyingExamplesRandomBounded(final int bound);
 
+	/**
+	 * Draws numOfExamples strings for each string variable, uniformly among its values of length up to bound.
+	 * Variables are sampled independently, same seed gives the same examples.
+	 * Examples are the raw bytes of the strings, they may have any byte value including 0.
+	 * Throws IllegalArgumentException if numOfExamples or bound is negative.
+	 */
+	public native Map<String, List<byte[]>> getSatisfyingExamplesUniform(final int numOfExamples, final int bound, final long seed);
+
+	/**
+	 * Starts enumerating models in length and lexicographic order, models are pulled with hasNextModel and getNextModel.
+	 * Strings are bounded by length and integers by bit length.
+	 */
+	public native void initializeModelIterator(final long bound);
+
+	public native boolean hasNextModel();
+
+	public native Map<String, String> getNextModel();
+
 	public native void reset();
 
 	public native void dispose();
@@ -16,14 +16,21 @@ Driver::Driver()
     : script_(nullptr),
       symbol_table_(nullptr),
       constraint_information_(nullptr),
-      is_model_counter_cached_ { false } {
+      is_model_counter_cached_ { false },
+      is_solved_from_cache_ { false },
+      is_sat_from_cache_ { false },
+      is_incremental_script_pending_ { false },
+      dnf_declarations_(nullptr),
+      is_dnf_pending_ { false },
+      is_sat_from_dnf_ { false } {
 }
 
 Driver::~Driver() {
   delete symbol_table_;
   delete script_;
   delete constraint_information_;
-  Theory::Automaton::CleanUp();
+  delete dnf_declarations_;
+  // bdd variable indices are shared by the drivers of the process, they are not cleaned up here
 }
 
 void Driver::InitializeLogger(int log_level) {
@@ -45,8 +52,10 @@ int Driver::Parse(std::istream* in) {
   SMT::Parser parser(script_, scanner);
   //  parser.set_debug_level (trace_parsing);
   int res = parser.parse();
-  CHECK_EQ(0, res)<< "Syntax error";
-  
+  if (res != 0) {
+    throw std::runtime_error("syntax error");
+  }
+
   return res;
 }
 
@@ -68,28 +77,66 @@ void Driver::ast2dot(std::string file_name) {
 
 void Driver::InitializeSolver() {
 
+  StartPhase();
+  if (Option::Solver::FORCE_DNF_FORMULA) {
+    // the initializer removes the declarations from the script
+    delete dnf_declarations_;
+    dnf_declarations_ = new SMT::Script(new SMT::CommandList());
+    for (auto command : *script_->command_list) {
+      if (SMT::Command::Type::ASSERT != command->getType()) {
+        dnf_declarations_->command_list->push_back(command->clone());
+      }
+    }
+  }
   symbol_table_ = new Solver::SymbolTable();
   constraint_information_ = new Solver::ConstraintInformation();
 
   Solver::Initializer initializer(script_, symbol_table_);
   initializer.start();
+  EndPhase("initializer");
 
   std::string output_root {"./output"};
   //ast2dot(output_root + "/post_initializer.dot");
   //std::cin.get();
 
-  Solver::SyntacticProcessor syntactic_processor(script_);
+  Solver::SyntacticProcessor syntactic_processor(script_, dnf_declarations_ != nullptr);
   syntactic_processor.start();
+  EndPhase("syntactic_processor");
+
+  if (dnf_declarations_ != nullptr) {
+    auto assert_command = dynamic_cast<SMT::Assert_ptr>(script_->command_list->front());
+    if (SMT::And_ptr and_term = dynamic_cast<SMT::And_ptr>(assert_command->term)) {
+      for (auto term : *and_term->term_list) {
+        is_dnf_pending_ = is_dnf_pending_ or (SMT::Term::Type::OR == term->type());
+      }
+    }
+    if (is_dnf_pending_) {
+      return;
+    }
+  }
 
   //ast2dot(output_root + "/post_syntactic_processor.dot");
   //std::cin.get();
 
   Solver::SyntacticOptimizer syntactic_optimizer(script_, symbol_table_);
   syntactic_optimizer.start();
+  EndPhase("syntactic_optimizer");
 
   //ast2dot(output_root + "/post_syntactic_optimizer.dot");
   //std::cin.get();
 
+  if (GetConstraintCache() != nullptr) {
+    LoadFromCache();
+    EndPhase("constraint_cache");
+    if (is_solved_from_cache_) {
+      return;
+    }
+  }
+
+  RunOptimizations();
+}
+
+void Driver::RunOptimizations() {
   //int count = 0;
   if (Option::Solver::ENABLE_EQUIVALENCE_CLASSES) {
     Solver::EquivalenceGenerator equivalence_generator(script_, symbol_table_);
@@ -100,23 +147,27 @@ void Driver::InitializeSolver() {
       //count++;
       //std::cin.get();
     } while (equivalence_generator.has_constant_substitution());
+    EndPhase("equivalence_generator");
   }
 
   //ast2dot(output_root + "/post_equivalence.dot");
 
   Solver::DependencySlicer dependency_slicer(script_, symbol_table_, constraint_information_);
 	dependency_slicer.start();
+  EndPhase("dependency_slicer");
 
 	//ast2dot(output_root + "/post_dependency_slicer.dot");
 
   if (Option::Solver::ENABLE_IMPLICATIONS) {
     Solver::ImplicationRunner implication_runner(script_, symbol_table_, constraint_information_);
     implication_runner.start();
+    EndPhase("implication_runner");
     //ast2dot(output_root + "/post_implication_runner.dot");
   }
 
   Solver::FormulaOptimizer formula_optimizer(script_, symbol_table_);
   formula_optimizer.start();
+  EndPhase("formula_optimizer");
 
   //ast2dot(output_root + "/post_formula_optimizer.dot");
 	//std::cin.get();
@@ -124,6 +175,7 @@ void Driver::InitializeSolver() {
   if (Option::Solver::ENABLE_SORTING_HEURISTICS) {
     Solver::ConstraintSorter constraint_sorter(script_, symbol_table_);
     constraint_sorter.start();
+    EndPhase("constraint_sorter");
   }
 }
 
@@ -133,280 +185,373 @@ void Driver::Solve() {
 //  Solver::ArithmeticFormulaGenerator arithmetic_formula_generator(script_, symbol_table_, constraint_information_);
 //  arithmetic_formula_generator.start();
 
+  if (is_solved_from_cache_) {
+    return;
+  }
+
+  if (is_dnf_pending_) {
+    StartPhase();
+    is_sat_from_dnf_ = SolveDisjunctsLazily();
+    EndPhase("lazy_dnf");
+    return;
+  }
+
+  StartPhase();
   Solver::ConstraintSolver constraint_solver(script_, symbol_table_, constraint_information_);
   constraint_solver.start();
+  EndPhase("constraint_solver");
+
+  // a cached entry with a model counter is not overridden when a cached script is solved again
+  if (GetConstraintCache() != nullptr and not cache_key_.empty() and not is_model_counter_cached_) {
+    Solver::ConstraintCache::Entry entry;
+    entry.is_sat = symbol_table_->isSatisfiable();
+    GetConstraintCache()->Store(cache_key_, cache_canonical_form_, entry);
+  }
 }
 
 bool Driver::is_sat() {
+  if (is_incremental_script_pending_) {
+    return incremental_context_.is_sat();
+  }
+  if (is_solved_from_cache_) {
+    return is_sat_from_cache_;
+  }
+  if (is_dnf_pending_) {
+    return is_sat_from_dnf_;
+  }
   return symbol_table_->isSatisfiable();
 }
 
-void Driver::GetModels(const unsigned long bound,const unsigned long num_models) {
+/**
+ * Depth first search over the disjuncts of the conjunction of disjunctions, one disjunct is picked from each
+ * disjunction in order. The state of the common terms and the disjuncts picked so far is kept for each prefix on the
+ * current path and each disjunct is solved alone once. The state of a longer prefix intersects the values of the
+ * prefix with the values of the disjunct, an empty intersection prunes every conjunction that extends the prefix. The
+ * intersection is the exact state when neither state relates variables, otherwise the conjunction is solved again.
+ * With satisfiability only, the first satisfiable full conjunction ends the search. Otherwise the values of the
+ * satisfiable full conjunctions are united and kept in the symbol table; counts of a variable are exact, counts of
+ * tuples count the product of the united values.
+ */
+bool Driver::SolveDisjunctsLazily() {
+  auto assert_command = dynamic_cast<SMT::Assert_ptr>(script_->command_list->front());
+  auto and_term = dynamic_cast<SMT::And_ptr>(assert_command->term);
+  SMT::TermList terms;
+  std::vector<SMT::Or_ptr> or_terms;
+  for (auto term : *and_term->term_list) {
+    if (SMT::Term::Type::OR == term->type()) {
+      or_terms.push_back(dynamic_cast<SMT::Or_ptr>(term));
+    } else {
+      terms.push_back(term);
+    }
+  }
 
-	LOG(FATAL) << "IMPLEMENT ME";
+  const std::size_t num_of_common_terms = terms.size();
+  unsigned long num_of_conjunctions = 0;
+  // prefix_states[i] is the state of the common terms and the disjuncts picked before or_terms[i]
+  std::vector<DnfState> prefix_states(1);
+  if (terms.empty()) {
+    prefix_states.back().is_sat = true;
+  } else {
+    SolveConjunction(terms, prefix_states.back());
+    ++num_of_conjunctions;
+  }
+  // disjunct_states[i][j] is the state of the j-th disjunct of or_terms[i] solved alone
+  std::vector<std::vector<std::unique_ptr<DnfState>>> disjunct_states(or_terms.size());
+  for (std::size_t i = 0; i < or_terms.size(); ++i) {
+    disjunct_states[i].resize(or_terms[i]->term_list->size());
+  }
+  DnfState union_state;
+  // positions[i] is the disjunct picked from or_terms[i]
+  std::vector<std::size_t> positions;
+  if (prefix_states.back().is_sat) {
+    positions.push_back(0);
+  }
+  while (not positions.empty()) {
+    const std::size_t level = positions.size() - 1;
+    if (positions[level] == or_terms[level]->term_list->size()) {
+      positions.pop_back();
+      prefix_states.pop_back();
+      if (not positions.empty()) {
+        ++positions.back();
+      }
+      continue;
+    }
+    SMT::Term_ptr disjunct = or_terms[level]->term_list->at(positions[level]);
+    terms.resize(num_of_common_terms + level);
+    terms.push_back(disjunct);
+
+    auto& disjunct_state = disjunct_states[level][positions[level]];
+    if (disjunct_state == nullptr) {
+      disjunct_state.reset(new DnfState());
+      SolveConjunction(SMT::TermList {disjunct}, *disjunct_state);
+      ++num_of_conjunctions;
+    }
+    DnfState state;
+    bool is_sat = disjunct_state->is_sat and IntersectDnfStates(prefix_states[level], *disjunct_state, state);
+    if (is_sat and not state.is_exact) {
+      state = DnfState();
+      SolveConjunction(terms, state);
+      ++num_of_conjunctions;
+      is_sat = state.is_sat;
+    }
 
-	//LOG(INFO) << "Numver of satisfying variables: " << getSatisfyingVariables().size();
-	std::map<std::string,std::vector<std::string>> variable_values;
-	std::map<SMT::Variable_ptr,Solver::Value_ptr> var_vals;
+    if (not is_sat) {
+      ++positions.back();
+    } else if (positions.size() < or_terms.size()) {
+      prefix_states.push_back(std::move(state));
+      positions.push_back(0);
+    } else if (Option::Solver::SATISFIABILITY_ONLY) {
+      union_state = std::move(state);
+      break;
+    } else {
+      UnionDnfStates(union_state, state);
+      ++positions.back();
+    }
+  }
 
-	std::string var_name("var_8");
-	auto v8 = symbol_table_->get_variable(var_name);
-	auto v8_rep = symbol_table_->get_representative_variable_of_at_scope(script_, v8);
-	auto v8_all_solutions = symbol_table_->get_projected_value_at_scope(script_,v8_rep);
+  if (union_state.is_sat) {
+    auto& values = symbol_table_->get_values_at_scope(script_);
+    for (auto& entry : union_state.values) {
+      auto variable = symbol_table_->get_variable_unsafe(entry.first);
+      if (variable != nullptr) {
+        delete values[variable];
+        values[variable] = entry.second->clone();
+      }
+    }
+  }
+  symbol_table_->update_satisfiability_result(union_state.is_sat);
+  DVLOG(20) << "lazy dnf: " << num_of_conjunctions << " conjunctions solved for " << or_terms.size()
+            << " disjunctions, " << (union_state.is_sat ? "sat" : "unsat");
+  return union_state.is_sat;
+}
 
-	auto v8_n_solutions = v8_all_solutions->getStringAutomaton()->GetModelsWithinBound(num_models,-1);
-	LOG(INFO) << 0;
-	Theory::StringAutomaton_ptr union_auto = nullptr, t1_auto = nullptr, t2_auto = nullptr;
-	for(int i = 0; i < v8_n_solutions["var_8"].size(); i++) {
-		t1_auto = Theory::StringAutomaton::MakeString(v8_n_solutions["var_8"][i]);
-		if(union_auto == nullptr) {
-			union_auto = t1_auto;
-		} else {
-			t2_auto = union_auto->Union(t1_auto);
-			delete union_auto;
-			delete t1_auto;
-			union_auto = t2_auto;
-		}
-	}
+void Driver::SolveConjunction(const SMT::TermList& terms, DnfState& state) {
+  Driver driver;
+  driver.script_ = dnf_declarations_->clone();
+  SMT::TermList_ptr term_list = new SMT::TermList();
+  for (auto term : terms) {
+    term_list->push_back(term->clone());
+  }
+  driver.script_->command_list->push_back(new SMT::Assert(new SMT::And(term_list)));
+  driver.InitializeSolver();
+  driver.Solve();
+  driver.GetDnfState(state);
+}
 
-	var_name = "var_7";
-	auto v7_var = symbol_table_->get_variable(var_name);
-	auto v7_rep = symbol_table_->get_representative_variable_of_at_scope(script_,v7_var);
-	auto v7_all_solutions_val = symbol_table_->get_projected_value_at_scope(script_,v7_rep);
-
-	var_name = "var_6";
-	auto v6_var = symbol_table_->get_variable(var_name);
-	auto v6_rep = symbol_table_->get_representative_variable_of_at_scope(script_,v6_var);
-	auto v6_all_solutions_val = symbol_table_->get_projected_value_at_scope(script_,v6_rep);
-
-	Theory::StringAutomaton_ptr prefix_suffix_auto = Theory::StringAutomaton::MakePrefixSuffix(0,1,2,3);
-	auto prefix_multi = new Theory::StringAutomaton(v6_all_solutions_val->getStringAutomaton()->getDFA(),1,3,8);
-	auto temp_dfa = Theory::StringAutomaton::PrependLambda(v7_all_solutions_val->getStringAutomaton()->getDFA(),8);
-	auto suffix_multi = new Theory::StringAutomaton(temp_dfa,2,3,9);
-	dfaFree(temp_dfa);
-
-	auto intersect_multi = prefix_suffix_auto->Intersect(prefix_multi);
-	delete prefix_suffix_auto;
-	delete prefix_multi;
-	prefix_suffix_auto = intersect_multi;
-
-	intersect_multi = prefix_suffix_auto->Intersect(suffix_multi);
-	delete prefix_suffix_auto;
-	delete suffix_multi;
-
-	auto v8_multi = new Theory::StringAutomaton(union_auto->getDFA(),0,3,8);
-	auto v8_v7_v6_auto = intersect_multi->Intersect(v8_multi);
-	delete intersect_multi;
-	delete v8_multi;
-
-
-	auto v8_v7_v6_solutions = v8_v7_v6_auto->GetModelsWithinBound(num_models,-1);
-	for(int k = 0; k < v8_v7_v6_solutions["var_8"].size();k++) {
-		LOG(INFO) << "v8=" << v8_v7_v6_solutions["var_8"][k];
-		LOG(INFO) << "v6=" << v8_v7_v6_solutions["var_6"][k];
-		LOG(INFO) << "v7=" << v8_v7_v6_solutions["var_7"][k];
-		std::cin.get();
-	}
+/**
+ * Reads the projected values of the solved script. The values relate variables when a value tracks more than one
+ * variable, when a variable stands for another one or when both string and int values are constrained.
+ */
+void Driver::GetDnfState(DnfState& state) {
+  SolveCachedScript();
+  state.is_sat = is_sat();
+  if (not state.is_sat) {
+    return;
+  }
 
+  // a lazily solved script keeps the union of its conjunctions or its first satisfiable one
+  state.is_exact = not is_dnf_pending_;
+  bool has_string_value = false, has_int_value = false;
+  for (auto& variable_entry : symbol_table_->get_values_at_scope(script_)) {
+    auto value = variable_entry.second;
+    if (value == nullptr) {
+      continue;
+    }
+    switch (value->getType()) {
+      case Solver::Value::Type::STRING_AUTOMATON: {
+        has_string_value = true;
+        auto formula = value->getStringAutomaton()->GetFormula();
+        state.is_exact = state.is_exact and (formula == nullptr or formula->GetVariableCoefficientMap().size() < 2);
+        break;
+      }
+      case Solver::Value::Type::BINARYINT_AUTOMATON: {
+        has_int_value = true;
+        auto formula = value->getBinaryIntAutomaton()->GetFormula();
+        state.is_exact = state.is_exact and (formula == nullptr or formula->GetVariableCoefficientMap().size() < 2);
+        break;
+      }
+      case Solver::Value::Type::INT_AUTOMATON:
+      case Solver::Value::Type::INT_CONSTANT:
+        has_int_value = true;
+        break;
+      default:
+        break;
+    }
+  }
+  state.is_exact = state.is_exact and not (has_string_value and has_int_value);
 
-//	temp_multi = MakePrefixSuffix(0,1,2,3);
-//	prefix_multi = new StringAutomaton(prefix_dfa,1,3,var);
-//	temp_dfa = PrependLambda(suffix_dfa,var);
-//	suffix_multi = new StringAutomaton(temp_dfa,2,3,VAR_PER_TRACK);
-//	dfaFree(temp_dfa);
-//	intersect_multi = temp_multi->Intersect(prefix_multi);
-//	delete temp_multi;
-//	delete prefix_multi;
-//	temp_multi = intersect_multi;
-//	intersect_multi = temp_multi->Intersect(suffix_multi);
-//	delete temp_multi;
-//	delete suffix_multi;
-
-	auto start = std::chrono::steady_clock::now();
-	int count = 0;
-	for (const auto &variable_entry : getSatisfyingVariables()) {
-		if (variable_entry.second == nullptr or variable_values.find(variable_entry.first->getName()) != variable_values.end()) {
-			continue;
-		}
-		count++;
-		//LOG(INFO) << "Var name: " << variable_entry.first->getName();
-		switch (variable_entry.second->getType()) {
-
-//			case Vlab::Solver::Value::Type::BINARYINT_AUTOMATON: {
-//				auto binary_auto = variable_entry.second->getBinaryIntAutomaton();
-//				auto formula = binary_auto->GetFormula();
-//				model_counter_.add_symbolic_counter(binary_auto->GetSymbolicCounter());
-//				//LOG(INFO) << "Binary int with " << formula->GetNumberOfVariables() << " variables";
-//				//binary_auto->inspectAuto(false,true);
-//				//std::cin.get();
-//				auto res = binary_auto->GetModelsWithinBound(num_models,-1);
-//				for(auto iter : res) {
-////					LOG(INFO) << "Setting " << iter.first;
-//					variable_values[iter.first] = iter.second;
-//				}
-//
-//			}
-			case Vlab::Solver::Value::Type::STRING_AUTOMATON: {
-				auto string_auto = variable_entry.second->getStringAutomaton();
-				model_counter_.add_symbolic_counter(string_auto->GetSymbolicCounter());
-				//LOG(INFO) << "String int with " << string_auto->GetNumTracks() << " variables";
-				auto res = string_auto->GetModelsWithinBound(num_models,-1);
-				for(auto iter : res) {
-					//LOG(INFO) << "Setting " << iter.first;
-					variable_values[iter.first] = iter.second;
-				}
-				//string_auto->inspectAuto(false,true);
-				//std::cin.get();
-			}
-				break;
-//			case Vlab::Solver::Value::Type::INT_AUTOMATON: {
-//				auto int_auto = variable_entry.second->getIntAutomaton();
-//				model_counter_.add_symbolic_counter(int_auto->GetSymbolicCounter());
-//				int_auto->GetModelsWithinBound(num_models,-1);
-//			}
-//				break;
-			default:
-				break;
-		}
-	}
-	//LOG(INFO) << "NUM SAT VAR: " << count;
-
-	auto end = std::chrono::steady_clock::now();
-	auto t1 = end-start;
-	int sat = 0;
-
-	LOG(INFO) << "Getting models took " << std::chrono::duration<long double, std::milli>(t1).count() << " ms";
-
-	start = std::chrono::steady_clock::now();
-	symbol_table_->clear_variable_values();
-	symbol_table_->push_scope(script_);
-	for(auto var : variable_values) {
-		Theory::StringAutomaton_ptr union_val = nullptr,temp = nullptr;
-		for(auto str_val : var.second) {
-			temp = Theory::StringAutomaton::MakeString(str_val);
-			if(union_val == nullptr) {
-				union_val = temp;
-			} else {
-				auto res = union_val->Union(temp);
-				delete union_val;
-				delete temp;
-				union_val = res;
-			}
-		}
-		Theory::StringFormula_ptr str_formula = union_val->GetFormula();
-		str_formula->AddVariable(var.first,1);
-		str_formula->SetType(Theory::StringFormula::Type::VAR);
-		symbol_table_->set_value(var.first,new Solver::Value(union_val));
-	}
-	symbol_table_->pop_scope();
-	Solver::ConstraintSolver constraint_solver(script_, symbol_table_, constraint_information_);
-	constraint_solver.start();
-	if(symbol_table_->isSatisfiable()) {
-		LOG(INFO) << "SAT!";
-	}
-	end = std::chrono::steady_clock::now();
+  for (auto& variable_entry : symbol_table_->get_variables()) {
+    auto variable = variable_entry.second;
+    if (symbol_table_->get_representative_variable_of_at_scope(script_, variable) != variable) {
+      state.is_exact = false;
+    }
+    auto value = symbol_table_->get_projected_value_at_scope(script_, variable);
+    if (value != nullptr) {
+      state.values[variable_entry.first].reset(value->clone());
+    }
+  }
+}
 
+/**
+ * @return false when the value of a variable becomes empty
+ */
+bool Driver::IntersectDnfStates(const DnfState& prefix_state, const DnfState& disjunct_state, DnfState& state) {
+  state.is_exact = prefix_state.is_exact and disjunct_state.is_exact;
+  state.values = prefix_state.values;
+  for (auto& entry : disjunct_state.values) {
+    auto& value = state.values[entry.first];
+    if (value == nullptr) {
+      value = entry.second;
+    } else {
+      value.reset(CombineValues(value.get(), entry.second.get(), entry.first, false));
+      if (not value->is_satisfiable()) {
+        return false;
+      }
+    }
+  }
+  state.is_sat = true;
+  return true;
+}
 
-	variable_values.clear();
-	for (const auto &variable_entry : getSatisfyingVariables()) {
-		if (variable_entry.second == nullptr or variable_values.find(variable_entry.first->getName()) != variable_values.end()) {
-			continue;
-		}
-		count++;
-		//LOG(INFO) << "Var name: " << variable_entry.first->getName();
-		switch (variable_entry.second->getType()) {
-
-//			case Vlab::Solver::Value::Type::BINARYINT_AUTOMATON: {
-//				auto binary_auto = variable_entry.second->getBinaryIntAutomaton();
-//				auto formula = binary_auto->GetFormula();
-//				model_counter_.add_symbolic_counter(binary_auto->GetSymbolicCounter());
-//				//LOG(INFO) << "Binary int with " << formula->GetNumberOfVariables() << " variables";
-//				//binary_auto->inspectAuto(false,true);
-//				//std::cin.get();
-//				auto res = binary_auto->GetModelsWithinBound(num_models,-1);
-//				for(auto iter : res) {
-////					LOG(INFO) << "Setting " << iter.first;
-//					variable_values[iter.first] = iter.second;
-//				}
-//
-//			}
-			case Vlab::Solver::Value::Type::STRING_AUTOMATON: {
-				auto string_auto = variable_entry.second->getStringAutomaton();
-				model_counter_.add_symbolic_counter(string_auto->GetSymbolicCounter());
-				//LOG(INFO) << "String int with " << string_auto->GetNumTracks() << " variables";
-				auto res = string_auto->GetModelsWithinBound(num_models,-1);
-				for(auto iter : res) {
-					//LOG(INFO) << "Setting " << iter.first;
-					variable_values[iter.first] = iter.second;
-				}
-				//string_auto->inspectAuto(false,true);
-				//std::cin.get();
-			}
-				break;
-//			case Vlab::Solver::Value::Type::INT_AUTOMATON: {
-//				auto int_auto = variable_entry.second->getIntAutomaton();
-//				model_counter_.add_symbolic_counter(int_auto->GetSymbolicCounter());
-//				int_auto->GetModelsWithinBound(num_models,-1);
-//			}
-//				break;
-			default:
-				break;
-		}
-	}
+/**
+ * A variable left unconstrained by a conjunction is unconstrained in the union
+ */
+void Driver::UnionDnfStates(DnfState& union_state, DnfState& state) {
+  if (not union_state.is_sat) {
+    union_state = std::move(state);
+    return;
+  }
+  for (auto it = union_state.values.begin(); it != union_state.values.end();) {
+    auto state_it = state.values.find(it->first);
+    if (state_it == state.values.end()) {
+      it = union_state.values.erase(it);
+    } else {
+      it->second.reset(CombineValues(it->second.get(), state_it->second.get(), it->first, true));
+      ++it;
+    }
+  }
+}
 
+/**
+ * Intersection or union of the values of a variable solved in different conjunctions, an int constant is made a
+ * binary int automaton when the other value is one
+ */
+Solver::Value_ptr Driver::CombineValues(Solver::Value_ptr value, Solver::Value_ptr other_value,
+                                        const std::string& var_name, bool is_union) {
+  if (Solver::Value::Type::INT_CONSTANT == value->getType()
+      and Solver::Value::Type::BINARYINT_AUTOMATON == other_value->getType()) {
+    std::swap(value, other_value);
+  }
+  std::unique_ptr<Solver::Value> binary_value;
+  if (Solver::Value::Type::BINARYINT_AUTOMATON == value->getType()
+      and Solver::Value::Type::INT_CONSTANT == other_value->getType()) {
+    auto binary_auto = value->getBinaryIntAutomaton();
+    binary_value.reset(new Solver::Value(Theory::BinaryIntAutomaton::MakeAutomaton(
+        other_value->getIntConstant(), var_name, binary_auto->GetFormula()->clone(),
+        not binary_auto->is_natural_number())));
+    other_value = binary_value.get();
+  }
+  return is_union ? value->union_(other_value) : value->intersect(other_value);
+}
 
-	start = std::chrono::steady_clock::now();
-	for(int model_index = 0; model_index < num_models; model_index++) {
-		symbol_table_->clear_variable_values();
-		symbol_table_->push_scope(script_);
+std::vector<std::map<std::string, std::string>> Driver::GetModels(const unsigned long bound,
+                                                                 const unsigned long num_models) {
+  std::vector<std::map<std::string, std::string>> models;
+  InitializeModelIterator(bound);
+  while (models.size() < num_models and HasNextModel()) {
+    models.push_back(GetNextModel());
+  }
+  return models;
+}
 
-		for(auto var : variable_values) {
-			int safety_index = (model_index >= var.second.size()) ? var.second.size()-1 : model_index;
-			Theory::StringAutomaton_ptr str_auto = Theory::StringAutomaton::MakeString(var.second[safety_index]);
-			Theory::StringFormula_ptr str_formula = str_auto->GetFormula();
-			str_formula->AddVariable(var.first,1);
-			str_formula->SetType(Theory::StringFormula::Type::VAR);
-			symbol_table_->set_value(var.first,new Solver::Value(str_auto));
-		}
-		symbol_table_->pop_scope();
-		Solver::ConstraintSolver constraint_solver(script_, symbol_table_, constraint_information_);
-		constraint_solver.start();
-		if(symbol_table_->isSatisfiable()) {
-			sat++;
-		}
-		//LOG(INFO) << "sat? " << symbol_table_->isSatisfiable();
-		//std::cin.get();
-	}
-	end = std::chrono::steady_clock::now();
-	auto t2 = end-start;
+std::vector<std::map<std::string, std::string>> Driver::GetModels(const unsigned long num_models) {
+  std::vector<std::map<std::string, std::string>> models;
+  InitializeModelIterator();
+  while (models.size() < num_models and HasNextModel()) {
+    models.push_back(GetNextModel());
+  }
+  return models;
+}
+
+void Driver::InitializeModelIterator(const unsigned long bound) {
+  model_iterator_.reset(new Solver::ModelIterator(getSatisfyingVariables(), bound));
+}
+
+void Driver::InitializeModelIterator() {
+  model_iterator_.reset(new Solver::ModelIterator(getSatisfyingVariables()));
+}
 
-	LOG(INFO) << "Checking models took " << std::chrono::duration<long double, std::milli>(t1).count() << " ms";
-	LOG(INFO) << "num sat  : " << sat;
-	LOG(INFO) << "num unsat: " << num_models - sat;
+bool Driver::HasNextModel() {
+  CHECK(model_iterator_ != nullptr) << "model iterator is not initialized";
+  return model_iterator_->HasNext();
+}
 
+std::map<std::string, std::string> Driver::GetNextModel() {
+  CHECK(model_iterator_ != nullptr) << "model iterator is not initialized";
+  return model_iterator_->Next();
 }
 
-Theory::BigInteger Driver::CountVariable(const std::string var_name, const unsigned long bound) {
+Theory::BigInteger Driver::CountVariable(const std::string var_name, const unsigned long bound,
+                                         const Theory::SymbolicCounter::Method method) {
   Theory::BigInteger projected_count, tuple_count;
-  tuple_count = GetModelCounterForVariable(var_name,false).Count(bound, bound);
-  projected_count = GetModelCounterForVariable(var_name,true).Count(bound, bound);
+  tuple_count = GetModelCounterForVariable(var_name,false).Count(bound, bound, method);
+  projected_count = GetModelCounterForVariable(var_name,true).Count(bound, bound, method);
 
 	return (projected_count < tuple_count) ? projected_count : tuple_count;
 }
 
-Theory::BigInteger Driver::CountInts(const unsigned long bound) {
-  return GetModelCounter().CountInts(bound);
+Theory::BigInteger Driver::CountInts(const unsigned long bound, const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountInts(bound, method);
+}
+
+Theory::BigInteger Driver::CountStrs(const unsigned long bound, const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountStrs(bound, method);
 }
 
-Theory::BigInteger Driver::CountStrs(const unsigned long bound) {
-  return GetModelCounter().CountStrs(bound);
+Theory::BigInteger Driver::Count(const unsigned long int_bound, const unsigned long str_bound,
+                                 const Theory::SymbolicCounter::Method method) {
+  return CountInts(int_bound, method) * CountStrs(str_bound, method);
 }
 
-Theory::BigInteger Driver::Count(const unsigned long int_bound, const unsigned long str_bound) {
-  return CountInts(int_bound) * CountStrs(str_bound);
+/**
+ * Count sweep for a variable, tuple and projected model counters are set once for all bounds
+ */
+std::vector<Theory::BigInteger> Driver::CountVariable(const std::string var_name, const std::vector<unsigned long>& bounds,
+                                                      const Theory::SymbolicCounter::Method method) {
+  std::vector<Theory::BigInteger> tuple_counts = GetModelCounterForVariable(var_name, false).CountAll(bounds, method);
+  std::vector<Theory::BigInteger> projected_counts = GetModelCounterForVariable(var_name, true).CountAll(bounds, method);
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    if (projected_counts[i] < tuple_counts[i]) {
+      tuple_counts[i] = projected_counts[i];
+    }
+  }
+  return tuple_counts;
+}
+
+std::vector<Theory::BigInteger> Driver::CountInts(const std::vector<unsigned long>& bounds,
+                                                  const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountInts(bounds, method);
+}
+
+std::vector<Theory::BigInteger> Driver::CountStrs(const std::vector<unsigned long>& bounds,
+                                                  const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountStrs(bounds, method);
+}
+
+std::vector<Theory::BigInteger> Driver::CountAll(const std::vector<unsigned long>& bounds,
+                                                 const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountAll(bounds, method);
+}
+
+std::vector<Theory::BigInteger> Driver::CountRange(const unsigned long lower_bound, const unsigned long upper_bound,
+                                                   const unsigned long step,
+                                                   const Theory::SymbolicCounter::Method method) {
+  return GetModelCounter().CountRange(lower_bound, upper_bound, step, method);
 }
 
 Solver::ModelCounter& Driver::GetModelCounterForVariable(const std::string var_name, bool project) {
+  SolveIncrementalScript();
+  SolveCachedScript();
   auto variable = symbol_table_->get_variable(var_name);
   auto representative_variable = symbol_table_->get_representative_variable_of_at_scope(script_, variable);
 
@@ -419,8 +564,21 @@ Solver::ModelCounter& Driver::GetModelCounterForVariable(const std::string var_n
 }
 
 Solver::ModelCounter& Driver::GetModelCounter() {
+  SolveIncrementalScript();
   if (not is_model_counter_cached_) {
     SetModelCounter();
+    if (GetConstraintCache() != nullptr and not cache_key_.empty()) {
+      Solver::ConstraintCache::Entry entry;
+      entry.is_sat = is_sat();
+      entry.has_model_counter = true;
+      std::stringstream os;
+      {
+        cereal::BinaryOutputArchive ar(os);
+        model_counter_.save(ar);
+      }
+      entry.model_counter = os.str();
+      GetConstraintCache()->Store(cache_key_, cache_canonical_form_, entry);
+    }
   }
   return model_counter_;
 }
@@ -555,10 +713,74 @@ void Driver::printResult(Solver::Value_ptr value, std::ostream& out) {
   }
 }
 
-std::map<SMT::Variable_ptr, Solver::Value_ptr> Driver::getSatisfyingVariables() const {
+std::map<SMT::Variable_ptr, Solver::Value_ptr> Driver::getSatisfyingVariables() {
+  SolveIncrementalScript();
+  SolveCachedScript();
   return symbol_table_->get_values_at_scope(script_);
 }
 
+Solver::ConstraintCache* Driver::GetConstraintCache() {
+  if (Option::Solver::CACHE_PATH.empty()) {
+    return nullptr;
+  }
+  if (constraint_cache_ == nullptr or constraint_cache_->get_file_path() != Option::Solver::CACHE_PATH) {
+    constraint_cache_.reset(new Solver::ConstraintCache(Option::Solver::CACHE_PATH));
+  }
+  return constraint_cache_.get();
+}
+
+/**
+ * Options that change the solution or the model counter are part of the cache key
+ */
+std::string Driver::GetCacheContext() const {
+  std::stringstream ss;
+  ss << Option::Solver::USE_SIGNED_INTEGERS << Option::Solver::USE_MULTITRACK_AUTO
+     << Option::Solver::ENABLE_EQUIVALENCE_CLASSES << Option::Solver::ENABLE_DEPENDENCY_ANALYSIS
+     << Option::Solver::ENABLE_IMPLICATIONS << Option::Solver::ENABLE_LEN_IMPLICATIONS
+     << Option::Solver::ENABLE_SORTING_HEURISTICS << Option::Solver::FORCE_DNF_FORMULA
+     << Option::Solver::COUNT_BOUND_EXACT << ":" << Util::RegularExpression::DEFAULT;
+  return ss.str();
+}
+
+/**
+ * Looks up the canonical form of the optimized script, the rest of the solver pipeline is skipped on a hit
+ */
+void Driver::LoadFromCache() {
+  Solver::ScriptHasher script_hasher(script_, symbol_table_);
+  script_hasher.add_context(GetCacheContext());
+  script_hasher.start();
+  cache_key_ = script_hasher.get_key();
+  cache_canonical_form_ = script_hasher.get_canonical_form();
+
+  Solver::ConstraintCache::Entry entry;
+  if (not GetConstraintCache()->Find(cache_key_, cache_canonical_form_, entry)) {
+    return;
+  }
+
+  is_solved_from_cache_ = true;
+  is_sat_from_cache_ = entry.is_sat;
+  if (entry.has_model_counter) {
+    std::stringstream is(entry.model_counter);
+    {
+      cereal::BinaryInputArchive ar(is);
+      model_counter_.load(ar);
+    }
+    is_model_counter_cached_ = true;
+  }
+}
+
+/**
+ * Runs the solver pipeline for a script whose result is read from the cache, needed when variable values are asked
+ */
+void Driver::SolveCachedScript() {
+  if (not is_solved_from_cache_) {
+    return;
+  }
+  is_solved_from_cache_ = false;
+  RunOptimizations();
+  Solve();
+}
+
 std::map<std::string, std::string> Driver::getSatisfyingExamples() {
   std::map<std::string, std::string> results;
   for (auto& variable_entry : getSatisfyingVariables()) {
@@ -646,7 +868,168 @@ std::map<std::string, std::string> Driver::getSatisfyingExamplesRandomBounded(co
   return results;
 }
 
+std::map<std::string, std::vector<std::string>> Driver::getSatisfyingExamplesUniform(const unsigned num_of_examples,
+                                                                                   const int bound,
+                                                                                   const unsigned long seed) {
+  CHECK_GE(bound, 0) << "bound cannot be negative";
+  std::map<std::string, std::vector<std::string>> results;
+
+  // projected automata are shared with the random examples
+  if (cached_values_.empty()) {
+    for (auto& variable_entry : getSatisfyingVariables()) {
+      if (Solver::Value::Type::STRING_AUTOMATON == variable_entry.second->getType()) {
+        auto string_auto = variable_entry.second->getStringAutomaton();
+        auto string_formula = string_auto->GetFormula();
+        for (auto it : string_formula->GetVariableCoefficientMap()) {
+          cached_values_[it.first] = new Solver::Value(string_auto->GetAutomatonForVariable(it.first));
+        }
+      }
+    }
+  }
+
+  std::mt19937_64 rng(seed);
+  for (auto& it : cached_values_) {
+    auto examples = it.second->getStringAutomaton()->GetAcceptingStringsUniform(num_of_examples, bound, rng);
+    if (not examples.empty()) {
+      results[it.first] = examples;
+    }
+  }
+  return results;
+}
+
 void Driver::reset() {
+  ResetSolver();
+  incremental_context_.Clear();
+  is_incremental_script_pending_ = false;
+}
+
+/**
+ * Solved component of the incremental context, keeps the driver that solved it
+ */
+class Driver::IncrementalComponent : public Solver::IncrementalContext::ComponentState {
+ public:
+  IncrementalComponent(const std::string& script) {
+    std::istringstream input(script);
+    driver_.Parse(&input);
+    driver_.InitializeSolver();
+    driver_.Solve();
+  }
+
+  bool is_sat() override {
+    return driver_.is_sat();
+  }
+
+  /**
+   * Intersects the string value of the variable with the value the script gives it. Only a component solved into a
+   * single string automaton that tracks the variable takes the script, the intersection is exact then.
+   */
+  bool Refine(const std::string& variable_name, const std::string& script) override {
+    driver_.SolveCachedScript();
+    auto& values = driver_.symbol_table_->get_values_at_scope(driver_.script_);
+    if (values.size() != 1) {
+      return false;
+    }
+    auto component_value = values.begin()->second;
+    if (Solver::Value::Type::STRING_AUTOMATON != component_value->getType()) {
+      return false;
+    }
+    auto component_auto = component_value->getStringAutomaton();
+    if (component_auto->GetFormula() == nullptr
+        or component_auto->GetFormula()->GetVariableCoefficientMap().count(variable_name) == 0) {
+      return false;
+    }
+
+    IncrementalComponent assertion(script);
+    if (not assertion.is_sat()) {
+      driver_.symbol_table_->update_satisfiability_result(false);
+      return true;
+    }
+    Theory::StringAutomaton_ptr assertion_auto = nullptr;
+    for (auto& variable_entry : assertion.driver_.getSatisfyingVariables()) {
+      auto value = variable_entry.second;
+      if (Solver::Value::Type::STRING_AUTOMATON == value->getType() and value->getStringAutomaton()->GetFormula()
+          and value->getStringAutomaton()->GetFormula()->GetVariableCoefficientMap().count(variable_name) > 0) {
+        assertion_auto = value->getStringAutomaton()->GetAutomatonForVariable(variable_name);
+        break;
+      }
+    }
+    if (assertion_auto == nullptr) {
+      return false;
+    }
+
+    Solver::Value assertion_value(assertion_auto);
+    auto refined_value = component_value->intersect(&assertion_value);
+    delete values.begin()->second;
+    values.begin()->second = refined_value;
+    driver_.symbol_table_->update_satisfiability_result(refined_value->is_satisfiable());
+    return true;
+  }
+
+ protected:
+  Driver driver_;
+};
+
+/**
+ * Solves the new assertions together with the components of the previous assertions they share variables with,
+ * other components are not solved again
+ */
+bool Driver::AssertIncremental(const std::string& constraint) {
+  is_incremental_script_pending_ = false;
+  bool result = incremental_context_.Assert(constraint, [](const std::string& script) {
+    return std::make_shared<IncrementalComponent>(script);
+  });
+  is_incremental_script_pending_ = true;
+  return result;
+}
+
+void Driver::Push() {
+  incremental_context_.Push();
+}
+
+bool Driver::Pop(const unsigned levels) {
+  if (not incremental_context_.Pop(levels)) {
+    return false;
+  }
+  is_incremental_script_pending_ = true;
+  return true;
+}
+
+const std::string& Driver::get_incremental_error() const {
+  return incremental_context_.get_error();
+}
+
+/**
+ * Solves all assertions of the incremental context together, needed when variable values or counts are asked
+ */
+void Driver::SolveIncrementalScript() {
+  if (not is_incremental_script_pending_) {
+    return;
+  }
+  is_incremental_script_pending_ = false;
+  ResetSolver();
+  std::istringstream input(incremental_context_.GetScript());
+  Parse(&input);
+  InitializeSolver();
+  Solve();
+}
+
+const std::vector<std::pair<std::string, double>>& Driver::get_phase_times() const {
+  return phase_times_;
+}
+
+void Driver::StartPhase() {
+  phase_start_ = std::chrono::steady_clock::now();
+}
+
+void Driver::EndPhase(const std::string phase_name) {
+  auto phase_end = std::chrono::steady_clock::now();
+  phase_times_.push_back(std::make_pair(phase_name, std::chrono::duration<double, std::milli>(phase_end - phase_start_).count()));
+  phase_start_ = phase_end;
+}
+
+void Driver::ResetSolver() {
+  model_iterator_.reset();
+
 	for(auto &iter : cached_values_) {
 		delete iter.second;
 		iter.second = nullptr;
@@ -663,6 +1046,19 @@ void Driver::reset() {
   delete script_;
   script_ = nullptr;
   symbol_table_ = nullptr;
+
+  model_counter_ = Solver::ModelCounter();
+  is_model_counter_cached_ = false;
+  variable_model_counter_.clear();
+  cache_key_.clear();
+  cache_canonical_form_.clear();
+  is_solved_from_cache_ = false;
+  is_sat_from_cache_ = false;
+  delete dnf_declarations_;
+  dnf_declarations_ = nullptr;
+  is_dnf_pending_ = false;
+  is_sat_from_dnf_ = false;
+  phase_times_.clear();
 //  LOG(INFO) << "Driver reseted.";
 }
 
@@ -713,6 +1109,12 @@ void Driver::set_option(const Option::Name option) {
     case Option::Name::COUNT_BOUND_EXACT:
     	Option::Solver::COUNT_BOUND_EXACT = true;
     	break;
+    case Option::Name::ENABLE_SATISFIABILITY_ONLY:
+      Option::Solver::SATISFIABILITY_ONLY = true;
+      break;
+    case Option::Name::DISABLE_SATISFIABILITY_ONLY:
+      Option::Solver::SATISFIABILITY_ONLY = false;
+      break;
     default:
       LOG(ERROR)<< "option is not recognized: " << static_cast<int>(option);
       break;
@@ -724,6 +1126,27 @@ void Driver::set_option(const Option::Name option, const int value) {
     case Option::Name::REGEX_FLAG:
       Util::RegularExpression::DEFAULT = value;
       break;
+    case Option::Name::NUM_OF_THREADS:
+      if (value < 0) {
+        LOG(ERROR) << "number of threads cannot be negative, option is ignored: " << value;
+      } else if (Util::ThreadPool::Configure(value)) {
+        Option::Solver::NUM_OF_THREADS = value;
+      } else {
+        LOG(WARNING) << "thread pool has already started, number of threads is not changed to " << value;
+      }
+      break;
+    case Option::Name::AUTOMATON_CACHE_SIZE:
+      if (value < 0) {
+        LOG(ERROR) << "automaton cache size cannot be negative, option is ignored: " << value;
+        break;
+      }
+      Option::Theory::AUTOMATON_CACHE_SIZE = value;
+      Theory::AutomatonCache::GetInstance().set_memory_budget(Option::Theory::AUTOMATON_CACHE_SIZE * 1024 * 1024);
+      break;
+    case Option::Name::SYMBOLIC_ARITHMETIC_THRESHOLD:
+      CHECK_GE(value, 0) << "symbolic arithmetic threshold cannot be negative";
+      Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD = value;
+      break;
     default:
       LOG(ERROR)<< "option is not recognized: " << static_cast<int>(option) << " -> " << value;
       break;
@@ -740,6 +1163,9 @@ void Driver::set_option(const Option::Name option, const std::string value) {
       Option::Solver::SCRIPT_PATH = value;
       Option::Theory::SCRIPT_PATH = value;
       break;
+    case Option::Name::CACHE_PATH:
+      Option::Solver::CACHE_PATH = value;
+      break;
     default:
       LOG(ERROR)<< "option is not recognized: " << static_cast<int>(option) << " -> " << value;
       break;
@@ -976,7 +1402,9 @@ void Driver::test() {
 }
 
 void Driver::error(const Vlab::SMT::location& l, const std::string& m) {
-  LOG(FATAL)<<"error: " << l << " : " << m;
+  std::stringstream ss;
+  ss << l << ": " << m;
+  throw std::runtime_error(ss.str());
 }
 
 //void Driver::solveAst() {
@@ -8,14 +8,19 @@
 #ifndef SRC_DRIVER_H_
 #define SRC_DRIVER_H_
 
+#include <chrono>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <limits>
 #include <map>
+#include <memory>
+#include <random>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <glog/logging.h>
 
@@ -28,6 +33,7 @@
 #include "smt/ast.h"
 #include "smt/typedefs.h"
 #include "solver/Ast2Dot.h"
+#include "solver/ConstraintCache.h"
 #include "solver/ConstraintInformation.h"
 #include "solver/ConstraintSolver.h"
 #include "solver/ConstraintSorter.h"
@@ -35,14 +41,18 @@
 #include "solver/EquivalenceGenerator.h"
 #include "solver/FormulaOptimizer.h"
 #include "solver/ImplicationRunner.h"
+#include "solver/IncrementalContext.h"
 #include "solver/Initializer.h"
+#include "solver/ScriptHasher.h"
 #include "solver/ModelCounter.h"
+#include "solver/ModelIterator.h"
 #include "solver/options/Solver.h"
 #include "solver/SymbolTable.h"
 #include "solver/SyntacticOptimizer.h"
 #include "solver/SyntacticProcessor.h"
 #include "solver/Value.h"
 #include "theory/ArithmeticFormula.h"
+#include "theory/AutomatonCache.h"
 #include "theory/BinaryIntAutomaton.h"
 #include "theory/IntAutomaton.h"
 #include "theory/options/Theory.h"
@@ -51,6 +61,7 @@
 #include "theory/Formula.h"
 #include "theory/SymbolicCounter.h"
 #include "utils/Serialize.h"
+#include "utils/ThreadPool.h"
 
 namespace Vlab {
 namespace SMT {
@@ -69,6 +80,9 @@ public:
   // Error handling.
   void error(const Vlab::SMT::location& l, const std::string& m);
   void error(const std::string& m);
+  /**
+   * @throws std::runtime_error with the location and the reason when the script does not parse
+   */
   int Parse(std::istream* in = &std::cin);
   void ast2dot(std::string file_name);
   void ast2dot(std::ostream* out);
@@ -77,26 +91,85 @@ public:
   void Solve();
   bool is_sat();
 
-  void GetModels(const unsigned long bound,const unsigned long num_models);
+  /**
+   * Models in length and lexicographic order of each group of variables, see Solver::ModelIterator
+   * @param bound length bound of strings and bit length bound of integers
+   * @param num_models
+   * @return at most num_models models, each maps variable names to values
+   */
+  std::vector<std::map<std::string, std::string>> GetModels(const unsigned long bound, const unsigned long num_models);
+  /**
+   * Models of any length, fewer than num_models when the constraint has fewer models
+   */
+  std::vector<std::map<std::string, std::string>> GetModels(const unsigned long num_models);
 
-  Theory::BigInteger CountVariable(const std::string var_name, const unsigned long bound);
-  Theory::BigInteger CountInts(const unsigned long bound);
-  Theory::BigInteger CountStrs(const unsigned long bound);
-  Theory::BigInteger Count(const unsigned long int_bound, const unsigned long str_bound);
+  /**
+   * Pull style model enumeration, the iterator is discarded when the driver is reset
+   */
+  void InitializeModelIterator(const unsigned long bound);
+  void InitializeModelIterator();
+  bool HasNextModel();
+  std::map<std::string, std::string> GetNextModel();
+
+  Theory::BigInteger CountVariable(const std::string var_name, const unsigned long bound,
+                                   const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  Theory::BigInteger CountInts(const unsigned long bound,
+                               const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  Theory::BigInteger CountStrs(const unsigned long bound,
+                               const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  Theory::BigInteger Count(const unsigned long int_bound, const unsigned long str_bound,
+                           const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+
+  std::vector<Theory::BigInteger> CountVariable(const std::string var_name, const std::vector<unsigned long>& bounds,
+                                                const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountInts(const std::vector<unsigned long>& bounds,
+                                            const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountStrs(const std::vector<unsigned long>& bounds,
+                                            const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountAll(const std::vector<unsigned long>& bounds,
+                                           const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountRange(const unsigned long lower_bound, const unsigned long upper_bound,
+                                             const unsigned long step,
+                                             const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
 
   Solver::ModelCounter& GetModelCounterForVariable(const std::string var_name, bool project = true);
   Solver::ModelCounter& GetModelCounter();
 
   void printResult(Solver::Value_ptr value, std::ostream& out);
   void inspectResult(Solver::Value_ptr value, std::string file_name);
-  std::map<SMT::Variable_ptr, Solver::Value_ptr> getSatisfyingVariables() const;
+  std::map<SMT::Variable_ptr, Solver::Value_ptr> getSatisfyingVariables();
   std::map<std::string, std::string> getSatisfyingExamples();
   std::map<std::string, std::string> getSatisfyingExamplesRandom();
   std::map<std::string, std::string> getSatisfyingExamplesRandomBounded(const int bound);
+  /**
+   * Samples each string variable uniformly among its values of length up to the bound, variables are sampled
+   * independently of each other; same seed gives the same examples
+   */
+  std::map<std::string, std::vector<std::string>> getSatisfyingExamplesUniform(const unsigned num_of_examples,
+                                                                             const int bound,
+                                                                             const unsigned long seed);
 
   void reset();
+
+  /**
+   * Incremental solving, assertions are kept across calls until they are popped or the driver is reset.
+   * The constraint may have declare-fun, assert, push and pop commands, malformed commands are skipped and reported
+   * by get_incremental_error.
+   */
+  bool AssertIncremental(const std::string& constraint);
+  void Push();
+  /**
+   * @return false and keeps the assertions when there are fewer levels than given
+   */
+  bool Pop(const unsigned levels = 1);
+  const std::string& get_incremental_error() const;
 //	void solveAst();
 
+  /**
+   * Time spent in each phase of InitializeSolver and Solve in milliseconds, in execution order
+   */
+  const std::vector<std::pair<std::string, double>>& get_phase_times() const;
+
   void set_option(const Option::Name option);
   void set_option(const Option::Name option, const int value);
   void set_option(const Option::Name option, const std::string value);
@@ -112,8 +185,42 @@ public:
   std::string file_;
 
 protected:
+  class IncrementalComponent;
+
   void SetModelCounterForVariable(const std::string var_name, bool project = true);
   void SetModelCounter();
+  void RunOptimizations();
+  Solver::ConstraintCache* GetConstraintCache();
+  std::string GetCacheContext() const;
+  void LoadFromCache();
+  void SolveCachedScript();
+  void ResetSolver();
+  void SolveIncrementalScript();
+  /**
+   * Projected values of the variables of a solved conjunction of the lazily explored DNF, a variable without a value
+   * is unconstrained
+   */
+  struct DnfState {
+    bool is_sat = false;
+    /**
+     * True when the values do not relate variables, the solutions of the conjunction are the product of the values
+     */
+    bool is_exact = true;
+    /**
+     * Values a state does not change are shared with the state of the prefix
+     */
+    std::map<std::string, std::shared_ptr<Solver::Value>> values;
+  };
+
+  bool SolveDisjunctsLazily();
+  void SolveConjunction(const SMT::TermList& terms, DnfState& state);
+  void GetDnfState(DnfState& state);
+  static bool IntersectDnfStates(const DnfState& prefix_state, const DnfState& disjunct_state, DnfState& state);
+  static void UnionDnfStates(DnfState& union_state, DnfState& state);
+  static Solver::Value_ptr CombineValues(Solver::Value_ptr value, Solver::Value_ptr other_value,
+                                         const std::string& var_name, bool is_union);
+  void StartPhase();
+  void EndPhase(const std::string phase_name);
 
   bool is_model_counter_cached_;
   Solver::ModelCounter model_counter_;
@@ -122,6 +229,11 @@ protected:
    */
   std::map<SMT::Variable_ptr, Solver::ModelCounter> variable_model_counter_;
 
+  /**
+   * Enumerates models of the solved script, refers to the values in the symbol table
+   */
+  std::unique_ptr<Solver::ModelIterator> model_iterator_;
+
   /**
    * Keeps automata for variables (string vars are projected)
    */
@@ -132,6 +244,42 @@ protected:
    */
   std::map<std::string, Solver::Value_ptr> cached_bounded_values_;
 
+  /**
+   * Persistent cache of sat results and model counters, shared by drivers using the same cache file
+   */
+  std::unique_ptr<Solver::ConstraintCache> constraint_cache_;
+  std::string cache_key_;
+  /**
+   * Canonical form of the script, stored with the cache record to confirm a hit
+   */
+  std::string cache_canonical_form_;
+  /**
+   * True when the result is read from the cache and the script is not solved
+   */
+  bool is_solved_from_cache_;
+  bool is_sat_from_cache_;
+
+  Solver::IncrementalContext incremental_context_;
+  /**
+   * True when the assertions of the incremental context are not solved together yet
+   */
+  bool is_incremental_script_pending_;
+
+  /**
+   * Commands other than the assertions, a conjunction of the lazily explored DNF is solved as a script of its own
+   * with them
+   */
+  SMT::Script_ptr dnf_declarations_;
+  /**
+   * True when the disjunctions of the assertion are not converted to DNF, see SolveDisjunctsLazily. The union of the
+   * values of the satisfiable conjunctions is kept in the symbol table then.
+   */
+  bool is_dnf_pending_;
+  bool is_sat_from_dnf_;
+
+  std::vector<std::pair<std::string, double>> phase_times_;
+  std::chrono::steady_clock::time_point phase_start_;
+
 private:
   static bool IS_LOGGING_INITIALIZED;
 
@@ -0,0 +1,391 @@
+/*
+ * Server.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "Server.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <sstream>
+#include <stdexcept>
+
+namespace Vlab {
+
+const int Server::VLOG_LEVEL = 12;
+
+const unsigned long Server::MAX_BOUND = 1 << 16;
+
+const unsigned long Server::MAX_NUM_OF_MODELS = 1 << 16;
+
+Server::Server(const std::size_t num_of_workers, const Theory::SymbolicCounter::Method count_method)
+    : count_method_ {count_method},
+      stop_ {false},
+      num_of_connections_ {0} {
+  // a client that goes away is noticed by a failed write
+  std::signal(SIGPIPE, SIG_IGN);
+  std::size_t num_of_threads = num_of_workers;
+  if (num_of_threads == 0) {
+    num_of_threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (std::size_t i = 0; i < num_of_threads; ++i) {
+    workers_.push_back(std::thread(&Server::WorkerLoop, this));
+  }
+  DVLOG(VLOG_LEVEL) << "server started with " << num_of_threads << " workers";
+}
+
+Server::~Server() {
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    state_changed_.wait(lock, [this]() {return num_of_connections_ == 0;});
+    stop_ = true;
+  }
+  state_changed_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+/**
+ * Responses are written by a separate thread in request order, so the next requests are read and solved while the
+ * earlier ones are written
+ */
+void Server::Serve(const int input_fd, const int output_fd) {
+  std::deque<std::future<std::string>> responses;
+  std::mutex responses_mutex;
+  std::condition_variable responses_changed;
+  bool is_input_closed = false;
+
+  std::thread writer([&]() {
+    bool is_output_open = true;
+    while (true) {
+      std::future<std::string> response;
+      {
+        std::unique_lock<std::mutex> lock(responses_mutex);
+        responses_changed.wait(lock, [&]() {return is_input_closed or not responses.empty();});
+        if (responses.empty()) {
+          return;
+        }
+        response = std::move(responses.front());
+        responses.pop_front();
+      }
+      const std::string body = response.get();
+      if (is_output_open) {
+        is_output_open = WriteResponse(output_fd, body);
+      }
+    }
+  });
+
+  Reader reader(input_fd);
+  for (auto request = ReadRequest(reader); request != nullptr; request = ReadRequest(reader)) {
+    auto response = request->response.get_future();
+    if (request->error.empty()) {
+      Submit(request);
+    } else {
+      request->response.set_value("error " + request->error + "\n");
+    }
+    {
+      std::lock_guard<std::mutex> lock(responses_mutex);
+      responses.push_back(std::move(response));
+    }
+    responses_changed.notify_one();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(responses_mutex);
+    is_input_closed = true;
+  }
+  responses_changed.notify_one();
+  writer.join();
+}
+
+void Server::ServeSocket(const std::string& socket_path) {
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  CHECK_LT(socket_path.size(), sizeof(address.sun_path)) << "socket path is too long: " << socket_path;
+  std::strncpy(address.sun_path, socket_path.c_str(), sizeof(address.sun_path) - 1);
+
+  const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  CHECK_GE(listen_fd, 0) << "cannot create socket: " << std::strerror(errno);
+  unlink(socket_path.c_str());
+  int result = bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address));
+  CHECK_EQ(0, result) << "cannot bind " << socket_path << ": " << std::strerror(errno);
+  result = listen(listen_fd, SOMAXCONN);
+  CHECK_EQ(0, result) << "cannot listen on " << socket_path << ": " << std::strerror(errno);
+  LOG(INFO) << "serving on " << socket_path;
+
+  while (true) {
+    const int connection_fd = accept(listen_fd, nullptr, nullptr);
+    if (connection_fd < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG(ERROR) << "cannot accept connection: " << std::strerror(errno);
+      break;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++num_of_connections_;
+    }
+    std::thread([this, connection_fd]() {
+      Serve(connection_fd, connection_fd);
+      close(connection_fd);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --num_of_connections_;
+      }
+      state_changed_.notify_all();
+    }).detach();
+  }
+
+  close(listen_fd);
+  unlink(socket_path.c_str());
+}
+
+Server::Reader::Reader(const int fd)
+    : fd_ {fd},
+      position_ {0} {
+}
+
+bool Server::Reader::ReadLine(std::string& line) {
+  std::size_t end = buffer_.find('\n', position_);
+  while (end == std::string::npos) {
+    if (not Fill()) {
+      return false;
+    }
+    end = buffer_.find('\n', position_);
+  }
+  line = buffer_.substr(position_, end - position_);
+  position_ = end + 1;
+  return true;
+}
+
+bool Server::Reader::ReadBytes(const std::size_t size, std::string& bytes) {
+  while (buffer_.size() - position_ < size) {
+    if (not Fill()) {
+      return false;
+    }
+  }
+  bytes = buffer_.substr(position_, size);
+  position_ += size;
+  return true;
+}
+
+bool Server::Reader::Fill() {
+  buffer_.erase(0, position_);
+  position_ = 0;
+  char chunk[1 << 16];
+  while (true) {
+    const ssize_t size = read(fd_, chunk, sizeof(chunk));
+    if (size > 0) {
+      buffer_.append(chunk, size);
+      return true;
+    } else if (size < 0 and errno == EINTR) {
+      continue;
+    }
+    return false;
+  }
+}
+
+Server::Request_ptr Server::ReadRequest(Reader& reader) {
+  std::string header;
+  do {
+    if (not reader.ReadLine(header)) {
+      return nullptr;
+    }
+  } while (header.find_first_not_of(" \t\r") == std::string::npos);
+
+  std::stringstream ss(header);
+  std::size_t length = 0;
+  if (not (ss >> length)) {
+    // the size of the script is unknown, the rest of the input cannot be framed
+    LOG(ERROR) << "malformed request header: " << header;
+    return nullptr;
+  }
+
+  auto request = std::make_shared<Request>();
+  request->num_models = 0;
+  std::string option;
+  while (request->error.empty() and ss >> option) {
+    std::string value;
+    if (not (ss >> value)) {
+      request->error = "missing value of " + option;
+      break;
+    }
+    try {
+      if (option == "--bound-str") {
+        request->str_bounds = ParseBounds(value);
+      } else if (option == "--bound-int") {
+        request->int_bounds = ParseBounds(value);
+      } else if (option == "--bound-var") {
+        request->var_bounds = ParseBounds(value);
+      } else if (option == "--count-variable") {
+        request->count_variable = value;
+      } else if (option == "--get-models") {
+        request->num_models = ParseNumber(value, MAX_NUM_OF_MODELS);
+      } else {
+        request->error = "unknown option " + option;
+      }
+    } catch (const std::exception&) {
+      request->error = "invalid value of " + option + ": " + value;
+    }
+  }
+
+  if (not reader.ReadBytes(length, request->script)) {
+    LOG(ERROR) << "input closed before the end of the request";
+    return nullptr;
+  }
+  return request;
+}
+
+void Server::Submit(Request_ptr request) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_requests_.push_back(request);
+  }
+  state_changed_.notify_all();
+}
+
+void Server::WorkerLoop() {
+  Driver driver;
+  while (true) {
+    Request_ptr request;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      state_changed_.wait(lock, [this]() {return stop_ or not pending_requests_.empty();});
+      if (pending_requests_.empty()) {
+        return;
+      }
+      request = pending_requests_.front();
+      pending_requests_.pop_front();
+    }
+    auto start = std::chrono::steady_clock::now();
+    std::string response = Solve(driver, *request);
+    driver.reset();
+    auto end = std::chrono::steady_clock::now();
+    DVLOG(VLOG_LEVEL) << "request answered in " << std::chrono::duration<long double, std::milli>(end - start).count()
+                      << " ms";
+    request->response.set_value(response);
+  }
+}
+
+/**
+ * Errors of the script are answered, the worker resets the driver and goes on with the next request
+ */
+std::string Server::Solve(Driver& driver, const Request& request) {
+  try {
+    return SolveScript(driver, request);
+  } catch (const std::exception& e) {
+    DVLOG(VLOG_LEVEL) << "request failed: " << e.what();
+    std::string message = e.what();
+    std::replace(message.begin(), message.end(), '\n', ' ');
+    return "error " + message + "\n";
+  }
+}
+
+std::string Server::SolveScript(Driver& driver, const Request& request) {
+  std::stringstream script(request.script);
+  driver.Parse(&script);
+  driver.InitializeSolver();
+  driver.Solve();
+
+  if (not driver.is_sat()) {
+    return "unsat\n";
+  }
+
+  std::stringstream body;
+  body << "sat\n";
+  if (request.num_models > 0) {
+    // models are bounded by the largest string bound if given
+    std::vector<std::map<std::string, std::string>> models;
+    if (request.str_bounds.empty()) {
+      models = driver.GetModels(request.num_models);
+    } else {
+      models = driver.GetModels(*std::max_element(request.str_bounds.begin(), request.str_bounds.end()),
+                                request.num_models);
+    }
+    for (auto& model : models) {
+      body << "model";
+      for (auto& var_entry : model) {
+        body << " " << var_entry.first << " = \"" << var_entry.second << "\"";
+      }
+      body << "\n";
+    }
+  }
+
+  std::string count_variable = request.count_variable;
+  if (count_variable.empty() and driver.symbol_table_->has_count_variable()) {
+    count_variable = driver.symbol_table_->get_count_variable()->getName();
+  }
+  if (not count_variable.empty()) {
+    std::vector<unsigned long> bounds = request.var_bounds;
+    if (bounds.empty()) {
+      bounds = request.int_bounds;
+      bounds.insert(bounds.end(), request.str_bounds.begin(), request.str_bounds.end());
+    }
+    auto counts = driver.CountVariable(count_variable, bounds, count_method_);
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+      body << "count var " << bounds[i] << " " << counts[i] << "\n";
+    }
+  } else {
+    auto counts = driver.CountInts(request.int_bounds, count_method_);
+    for (std::size_t i = 0; i < request.int_bounds.size(); ++i) {
+      body << "count int " << request.int_bounds[i] << " " << counts[i] << "\n";
+    }
+    counts = driver.CountStrs(request.str_bounds, count_method_);
+    for (std::size_t i = 0; i < request.str_bounds.size(); ++i) {
+      body << "count str " << request.str_bounds[i] << " " << counts[i] << "\n";
+    }
+  }
+  return body.str();
+}
+
+unsigned long Server::ParseNumber(const std::string& value, const unsigned long limit) {
+  if (value.empty() or value.find_first_not_of("0123456789") != std::string::npos) {
+    throw std::invalid_argument("not a number: " + value);
+  }
+  const unsigned long number = std::stoul(value);
+  if (number > limit) {
+    throw std::out_of_range("larger than " + std::to_string(limit) + ": " + value);
+  }
+  return number;
+}
+
+std::vector<unsigned long> Server::ParseBounds(const std::string& bounds_str) {
+  std::vector<unsigned long> bounds;
+  std::stringstream ss(bounds_str);
+  std::string tok;
+  while (getline(ss, tok, ',')) {
+    bounds.push_back(ParseNumber(tok, MAX_BOUND));
+  }
+  return bounds;
+}
+
+bool Server::WriteResponse(const int fd, const std::string& body) {
+  const std::string frame = std::to_string(body.size()) + "\n" + body;
+  std::size_t written = 0;
+  while (written < frame.size()) {
+    const ssize_t size = write(fd, frame.data() + written, frame.size() - written);
+    if (size < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      LOG(ERROR) << "cannot write response: " << std::strerror(errno);
+      return false;
+    }
+    written += size;
+  }
+  return true;
+}
+
+} /* namespace Vlab */
@@ -0,0 +1,134 @@
+/*
+ * Server.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_SERVER_H_
+#define SRC_SERVER_H_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "Driver.h"
+#include "theory/SymbolicCounter.h"
+
+namespace Vlab {
+
+/**
+ * Long running solver that answers a stream of queries, the automaton cache (including the regular expression dfas)
+ * and the constraint cache stay warm between queries.
+ *
+ * A request is a header line followed by an SMT-LIB script of the given number of bytes:
+ *   <length> [--bound-str <values>] [--bound-int <values>] [--bound-var <values>] [--count-variable <name>]
+ *            [--get-models <n>]\n<script>
+ * A response is a header line followed by a body of the given number of bytes:
+ *   <length>\n<body>
+ * where the body is "sat" or "unsat", then a "model x = "..." ..." line for each model and a
+ * "count <var|int|str> <bound> <count>" line for each bound, or a single "error <message>" line.
+ * Bounds and the number of models are decimal numbers up to MAX_BOUND and MAX_NUM_OF_MODELS. The count variable is
+ * counted for the --bound-var bounds, or for the int and string bounds when none are given.
+ *
+ * Requests of a connection are solved by a pool of workers, each with its own driver, and answered in the order
+ * they arrive. Options are process wide and set before serving. A script that does not parse, uses an undeclared
+ * variable or fails while solving with an exception is answered with an error line and the server goes on. A
+ * LOG(FATAL) or a failed CHECK in the solver still aborts the whole process, with every pending request.
+ */
+class Server {
+ public:
+  /**
+   * @param num_of_workers number of queries solved at the same time, 0 uses all hardware threads
+   */
+  Server(const std::size_t num_of_workers, const Theory::SymbolicCounter::Method count_method);
+  virtual ~Server();
+
+  /**
+   * Answers requests read from the input until it is closed
+   */
+  void Serve(const int input_fd, const int output_fd);
+
+  /**
+   * Listens on a unix domain socket and serves each connection on its own thread, returns when accept fails
+   */
+  void ServeSocket(const std::string& socket_path);
+
+ protected:
+  struct Request {
+    std::string script;
+    std::vector<unsigned long> str_bounds;
+    std::vector<unsigned long> int_bounds;
+    std::vector<unsigned long> var_bounds;
+    std::string count_variable;
+    unsigned long num_models;
+    std::string error;
+    std::promise<std::string> response;
+  };
+  using Request_ptr = std::shared_ptr<Request>;
+
+  /**
+   * Buffered reads of request frames from a file descriptor
+   */
+  class Reader {
+   public:
+    Reader(const int fd);
+    /**
+     * @return false when the input is closed before a complete frame
+     */
+    bool ReadLine(std::string& line);
+    bool ReadBytes(const std::size_t size, std::string& bytes);
+   protected:
+    bool Fill();
+    int fd_;
+    std::string buffer_;
+    std::size_t position_;
+  };
+
+  /**
+   * Reads the header and the script of a request; header errors are answered instead of solved
+   * @return nullptr when the input is closed
+   */
+  Request_ptr ReadRequest(Reader& reader);
+  void Submit(Request_ptr request);
+  void WorkerLoop();
+  std::string Solve(Driver& driver, const Request& request);
+  std::string SolveScript(Driver& driver, const Request& request);
+
+  /**
+   * Reads a decimal number, signs and other characters are rejected
+   * @throws std::invalid_argument or std::out_of_range when the value is not a number up to the limit
+   */
+  static unsigned long ParseNumber(const std::string& value, const unsigned long limit);
+  static std::vector<unsigned long> ParseBounds(const std::string& bounds_str);
+  static bool WriteResponse(const int fd, const std::string& body);
+
+  Theory::SymbolicCounter::Method count_method_;
+  std::vector<std::thread> workers_;
+  std::deque<Request_ptr> pending_requests_;
+  std::mutex mutex_;
+  std::condition_variable state_changed_;
+  bool stop_;
+  std::size_t num_of_connections_;
+
+  /**
+   * Limits that keep a single request from occupying a worker for long
+   */
+  static const unsigned long MAX_BOUND;
+  static const unsigned long MAX_NUM_OF_MODELS;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Vlab */
+
+#endif /* SRC_SERVER_H_ */
@@ -0,0 +1,558 @@
+/*
+ ============================================================================
+ Name        : bench.cpp
+ Author      : baki
+ Version     :
+ Copyright   : Copyright 2015 The ABC Authors. All rights reserved. Use of this source code is governed license that can be found in the COPYING file.
+ Description : Benchmark harness, solves and model counts every constraint file of the benchmark suites, reports phase
+               timings, automata sizes and memory as json and compares them against a baseline
+ ============================================================================
+ */
+
+#include <dirent.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "cereal/external/rapidjson/document.h"
+#include "cereal/external/rapidjson/ostreamwrapper.h"
+#include "cereal/external/rapidjson/prettywriter.h"
+#include "cereal/external/rapidjson/stringbuffer.h"
+#include "cereal/external/rapidjson/writer.h"
+#include "Driver.h"
+#include "solver/options/Solver.h"
+#include "theory/Automaton.h"
+#include "theory/SymbolicCounter.h"
+
+struct Suite {
+  std::string name;
+  std::string path;
+};
+
+struct Config {
+  std::vector<Suite> suites;
+  std::vector<unsigned long> str_bounds {50};
+  std::vector<unsigned long> int_bounds;
+  Vlab::Theory::SymbolicCounter::Method count_method = Vlab::Theory::SymbolicCounter::Method::ITERATIVE;
+  std::map<std::string, std::string> options;
+  /**
+   * Worker threads are started in the benchmark process, they do not survive fork
+   */
+  int num_of_threads = -1;
+  unsigned repeat = 1;
+  unsigned timeout = 300;
+  std::string output_file;
+  std::string baseline_file;
+  double tolerance = 0.2;
+  double min_time = 10;
+};
+
+std::vector<unsigned long> parse_count_bounds(std::string);
+std::vector<std::string> list_constraint_files(const std::string& path);
+std::string run_benchmark(const Config& config, const std::string& file_name);
+void merge_repeat(rapidjson::Value& result, const rapidjson::Value& other, rapidjson::Document::AllocatorType& allocator);
+int compare_with_baseline(const Config& config, const rapidjson::Document& results);
+
+int main(const int argc, const char **argv) {
+  FLAGS_minloglevel = 2;
+  FLAGS_logtostderr = 1;
+
+  Vlab::Driver driver;
+  driver.set_option(Vlab::Option::Name::REGEX_FLAG, 0x000e);
+
+  Config config;
+  std::string root {"."};
+  for (int i = 1; i < argc; ++i) {
+    if (argv[i] == std::string("--root")) {
+      root = argv[++i];
+    } else if (argv[i] == std::string("--suite")) {
+      std::string suite {argv[++i]};
+      auto separator = suite.find('=');
+      if (separator == std::string::npos) {
+        config.suites.push_back({suite, suite});
+      } else {
+        config.suites.push_back({suite.substr(0, separator), suite.substr(separator + 1)});
+      }
+    } else if (argv[i] == std::string("-bs") or argv[i] == std::string("--bound-str")) {
+      config.str_bounds = parse_count_bounds(argv[++i]);
+    } else if (argv[i] == std::string("-bi") or argv[i] == std::string("--bound-int")) {
+      config.int_bounds = parse_count_bounds(argv[++i]);
+    } else if (argv[i] == std::string("--use-multitrack")) {
+      driver.set_option(Vlab::Option::Name::USE_MULTITRACK_AUTO);
+      config.options["tracks"] = "multi";
+    } else if (argv[i] == std::string("--use-singletrack")) {
+      driver.set_option(Vlab::Option::Name::USE_SINGLETRACK_AUTO);
+      config.options["tracks"] = "single";
+    } else if (argv[i] == std::string("--enable-equivalence")) {
+      driver.set_option(Vlab::Option::Name::ENABLE_EQUIVALENCE_CLASSES);
+      config.options["equivalence"] = "enabled";
+    } else if (argv[i] == std::string("--disable-equivalence")) {
+      driver.set_option(Vlab::Option::Name::DISABLE_EQUIVALENCE_CLASSES);
+      config.options["equivalence"] = "disabled";
+    } else if (argv[i] == std::string("--enable-sorting")) {
+      driver.set_option(Vlab::Option::Name::ENABLE_SORTING_HEURISTICS);
+      config.options["sorting"] = "enabled";
+    } else if (argv[i] == std::string("--disable-sorting")) {
+      driver.set_option(Vlab::Option::Name::DISABLE_SORTING_HEURISTICS);
+      config.options["sorting"] = "disabled";
+    } else if (argv[i] == std::string("--count-by-squaring")) {
+      config.count_method = Vlab::Theory::SymbolicCounter::Method::MATRIX_EXPONENTIATION;
+      config.options["count"] = "squaring";
+    } else if (argv[i] == std::string("--count-by-recurrence")) {
+      config.count_method = Vlab::Theory::SymbolicCounter::Method::LINEAR_RECURRENCE;
+      config.options["count"] = "recurrence";
+    } else if (argv[i] == std::string("--count-fixed-width")) {
+      config.count_method = Vlab::Theory::SymbolicCounter::Method::FIXED_WIDTH;
+      config.options["count"] = "fixed-width";
+    } else if (argv[i] == std::string("--count-modular")) {
+      config.count_method = Vlab::Theory::SymbolicCounter::Method::MODULAR;
+      config.options["count"] = "modular";
+    } else if (argv[i] == std::string("--threads")) {
+      config.num_of_threads = std::stoi(argv[i + 1]);
+      config.options["threads"] = argv[++i];
+    } else if (argv[i] == std::string("--repeat")) {
+      config.repeat = std::max(1, std::stoi(argv[++i]));
+    } else if (argv[i] == std::string("--timeout")) {
+      config.timeout = std::stoul(argv[++i]);
+    } else if (argv[i] == std::string("-o") or argv[i] == std::string("--output")) {
+      config.output_file = argv[++i];
+    } else if (argv[i] == std::string("--baseline")) {
+      config.baseline_file = argv[++i];
+    } else if (argv[i] == std::string("--tolerance")) {
+      config.tolerance = std::stod(argv[++i]);
+    } else if (argv[i] == std::string("--min-time")) {
+      config.min_time = std::stod(argv[++i]);
+    } else if (argv[i] == std::string("-h") or argv[i] == std::string("--help")) {
+      int col = 28;
+      std::cout << "Usage: abc-bench [options]" << std::endl;
+      std::cout << std::left;
+      std::cout << std::setw(col) << "--root <dir>" << ": source root of the default suites, test/benchmarks/{appscan,pisa} and test/jpf" << std::endl;
+      std::cout << std::setw(col) << "--suite [<name>=]<dir>" << ": benchmark suite, all .smt2 files under the directory, replaces the default suites" << std::endl;
+      std::cout << std::setw(col) << "-bs or --bound-str <values>" << ": string length bounds, e.g., -bs \"10,50\" (default 50)" << std::endl;
+      std::cout << std::setw(col) << "-bi or --bound-int <values>" << ": integer bit length bounds, e.g., -bi \"8,16\"" << std::endl;
+      std::cout << std::setw(col) << "--use-multitrack" << ": uses multitrack automata for strings" << std::endl;
+      std::cout << std::setw(col) << "--use-singletrack" << ": uses singletrack automata for strings" << std::endl;
+      std::cout << std::setw(col) << "--enable-equivalence" << ": enables equivalence class generation" << std::endl;
+      std::cout << std::setw(col) << "--disable-equivalence" << ": disables equivalence class generation" << std::endl;
+      std::cout << std::setw(col) << "--enable-sorting" << ": enables sorting heuristics for string constraints" << std::endl;
+      std::cout << std::setw(col) << "--disable-sorting" << ": disables sorting heuristics for string constraints" << std::endl;
+      std::cout << std::setw(col) << "--count-by-squaring" << ": model counts with matrix exponentiation by successive squaring" << std::endl;
+      std::cout << std::setw(col) << "--count-by-recurrence" << ": model counts by evaluating the linear recurrence of the counts" << std::endl;
+      std::cout << std::setw(col) << "--count-fixed-width" << ": model counts with 64 bit arithmetic, big integers after overflow" << std::endl;
+      std::cout << std::setw(col) << "--count-modular" << ": model counts modulo word sized primes, reconstructed with CRT" << std::endl;
+      std::cout << std::setw(col) << "--threads <n>" << ": number of threads used for counting, 0 uses all cores (default)" << std::endl;
+      std::cout << std::setw(col) << "--repeat <n>" << ": runs each benchmark n times and keeps the fastest phase times (default 1)" << std::endl;
+      std::cout << std::setw(col) << "--timeout <seconds>" << ": time limit of a benchmark (default 300)" << std::endl;
+      std::cout << std::setw(col) << "-o or --output <file>" << ": writes the json report to the file instead of stdout" << std::endl;
+      std::cout << std::setw(col) << "--baseline <file>" << ": json report to compare with, exits with 1 on a regression" << std::endl;
+      std::cout << std::setw(col) << "--tolerance <ratio>" << ": allowed slow down against the baseline (default 0.2)" << std::endl;
+      std::cout << std::setw(col) << "--min-time <ms>" << ": benchmarks faster than this in the baseline are not timed (default 10)" << std::endl;
+      std::exit(0);
+    } else {
+      std::cerr << "unknown option: " << argv[i] << std::endl;
+      std::exit(2);
+    }
+  }
+
+  if (config.suites.empty()) {
+    config.suites.push_back({"appscan", root + "/test/benchmarks/appscan/cvc4"});
+    config.suites.push_back({"pisa", root + "/test/benchmarks/pisa/abc"});
+    config.suites.push_back({"jpf", root + "/test/jpf"});
+  }
+
+  google::InitGoogleLogging(argv[0]);
+
+  rapidjson::Document results;
+  results.SetObject();
+  auto& allocator = results.GetAllocator();
+
+  rapidjson::Value options (rapidjson::kObjectType);
+  for (auto& option : config.options) {
+    options.AddMember(rapidjson::Value(option.first.c_str(), allocator), rapidjson::Value(option.second.c_str(), allocator), allocator);
+  }
+  results.AddMember("options", options, allocator);
+  rapidjson::Value bounds (rapidjson::kObjectType);
+  rapidjson::Value str_bounds (rapidjson::kArrayType), int_bounds (rapidjson::kArrayType);
+  for (auto bound : config.str_bounds) {
+    str_bounds.PushBack(static_cast<uint64_t>(bound), allocator);
+  }
+  for (auto bound : config.int_bounds) {
+    int_bounds.PushBack(static_cast<uint64_t>(bound), allocator);
+  }
+  bounds.AddMember("str", str_bounds, allocator);
+  bounds.AddMember("int", int_bounds, allocator);
+  results.AddMember("bounds", bounds, allocator);
+
+  rapidjson::Value benchmarks (rapidjson::kArrayType);
+  unsigned num_of_errors = 0;
+  double total_time = 0;
+  for (auto& suite : config.suites) {
+    auto files = list_constraint_files(suite.path);
+    if (files.empty()) {
+      std::cerr << "no constraint files in suite " << suite.name << ": " << suite.path << std::endl;
+    }
+    for (auto& file_name : files) {
+      std::cerr << suite.name << ": " << file_name << std::endl;
+      rapidjson::Value result;
+      for (unsigned i = 0; i < config.repeat; ++i) {
+        rapidjson::Document run;
+        run.Parse(run_benchmark(config, file_name).c_str());
+        if (i == 0) {
+          result.CopyFrom(run, allocator);
+        } else {
+          merge_repeat(result, run, allocator);
+        }
+      }
+      result.AddMember("suite", rapidjson::Value(suite.name.c_str(), allocator), allocator);
+      result.AddMember("file", rapidjson::Value(file_name.substr(suite.path.length() + 1).c_str(), allocator), allocator);
+      if (std::string(result["status"].GetString()) != "ok") {
+        ++num_of_errors;
+      } else {
+        total_time += result["time_ms"]["total"].GetDouble();
+      }
+      benchmarks.PushBack(result, allocator);
+    }
+  }
+
+  rapidjson::Value summary (rapidjson::kObjectType);
+  summary.AddMember("num_of_benchmarks", benchmarks.Size(), allocator);
+  summary.AddMember("num_of_errors", num_of_errors, allocator);
+  summary.AddMember("total_time_ms", total_time, allocator);
+  results.AddMember("benchmarks", benchmarks, allocator);
+  results.AddMember("summary", summary, allocator);
+
+  std::ofstream output_file;
+  if (not config.output_file.empty()) {
+    output_file.open(config.output_file);
+    if (not output_file.good()) {
+      std::cerr << "cannot open file: " << config.output_file << std::endl;
+      std::exit(2);
+    }
+  }
+  rapidjson::OStreamWrapper out(config.output_file.empty() ? std::cout : output_file);
+  rapidjson::PrettyWriter<rapidjson::OStreamWrapper> writer(out);
+  results.Accept(writer);
+  (config.output_file.empty() ? std::cout : output_file) << std::endl;
+
+  if (not config.baseline_file.empty()) {
+    return compare_with_baseline(config, results);
+  }
+  return 0;
+}
+
+std::vector<unsigned long> parse_count_bounds(std::string bounds_str) {
+  std::vector<unsigned long> bounds;
+  std::stringstream ss(bounds_str);
+  std::string tok;
+  while (getline(ss, tok, ',')) {
+    bounds.push_back(std::stoul(tok));
+  }
+  return bounds;
+}
+
+/**
+ * Lists .smt2 files under the given directory recursively, in a fixed order
+ */
+std::vector<std::string> list_constraint_files(const std::string& path) {
+  std::vector<std::string> files;
+  DIR* dir = opendir(path.c_str());
+  if (dir == nullptr) {
+    return files;
+  }
+  const std::string extension {".smt2"};
+  while (struct dirent* entry = readdir(dir)) {
+    std::string name {entry->d_name};
+    if (name == "." or name == "..") {
+      continue;
+    }
+    std::string entry_path = path + "/" + name;
+    struct stat entry_stat;
+    if (stat(entry_path.c_str(), &entry_stat) != 0) {
+      continue;
+    }
+    if (S_ISDIR(entry_stat.st_mode)) {
+      auto sub_files = list_constraint_files(entry_path);
+      files.insert(files.end(), sub_files.begin(), sub_files.end());
+    } else if (name.length() > extension.length()
+        and name.compare(name.length() - extension.length(), extension.length(), extension) == 0) {
+      files.push_back(entry_path);
+    }
+  }
+  closedir(dir);
+  std::sort(files.begin(), files.end());
+  return files;
+}
+
+static double elapsed_ms(std::chrono::steady_clock::time_point& start) {
+  auto end = std::chrono::steady_clock::now();
+  double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+  start = end;
+  return elapsed;
+}
+
+/**
+ * Solves and counts the file in the child process, writes the result as json to the output
+ */
+static void solve_and_count(const Config& config, const std::string& file_name, int output) {
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  std::ifstream in(file_name);
+  writer.StartObject();
+  if (not in.good()) {
+    writer.Key("status");
+    writer.String("error");
+    writer.EndObject();
+  } else {
+    Vlab::Driver driver;
+    if (config.num_of_threads >= 0) {
+      driver.set_option(Vlab::Option::Name::NUM_OF_THREADS, config.num_of_threads);
+    }
+    Vlab::Theory::Automaton::ResetStatistics();
+    std::map<std::string, double> times;
+    auto start = std::chrono::steady_clock::now();
+    auto total_start = start;
+    int parse_result = -1;
+    try {
+      parse_result = driver.Parse(&in);
+    } catch (const std::exception& e) {
+      LOG(ERROR) << file_name << ": " << e.what();
+    }
+    times["parse"] = elapsed_ms(start);
+
+    writer.Key("status");
+    if (parse_result != 0 or driver.script_ == nullptr) {
+      writer.String("error");
+    } else {
+      writer.String("ok");
+      driver.InitializeSolver();
+      driver.Solve();
+      start = std::chrono::steady_clock::now();
+      bool is_sat = driver.is_sat();
+
+      std::vector<Vlab::Theory::BigInteger> str_counts, int_counts;
+      if (is_sat) {
+        if (driver.symbol_table_->has_count_variable()) {
+          std::string count_variable = driver.symbol_table_->get_count_variable()->getName();
+          std::vector<unsigned long> bounds = config.int_bounds;
+          bounds.insert(bounds.end(), config.str_bounds.begin(), config.str_bounds.end());
+          str_counts = driver.CountVariable(count_variable, bounds, config.count_method);
+        } else {
+          int_counts = driver.CountInts(config.int_bounds, config.count_method);
+          str_counts = driver.CountStrs(config.str_bounds, config.count_method);
+        }
+      }
+      times["count"] = elapsed_ms(start);
+
+      double solve_time = 0;
+      for (auto& phase : driver.get_phase_times()) {
+        times[phase.first] += phase.second;
+        if (phase.first == "constraint_solver") {
+          solve_time += phase.second;
+        } else {
+          times["initialize"] += phase.second;
+        }
+      }
+      times["solve"] = solve_time;
+
+      writer.Key("sat");
+      writer.Bool(is_sat);
+      writer.Key("counts");
+      writer.StartObject();
+      writer.Key("str");
+      writer.StartArray();
+      for (auto& count : str_counts) {
+        writer.String(count.str().c_str());
+      }
+      writer.EndArray();
+      writer.Key("int");
+      writer.StartArray();
+      for (auto& count : int_counts) {
+        writer.String(count.str().c_str());
+      }
+      writer.EndArray();
+      writer.EndObject();
+      writer.Key("max_dfa_states");
+      writer.Int(Vlab::Theory::Automaton::GetMaxNumOfStates());
+      writer.Key("max_bdd_nodes");
+      writer.Uint(Vlab::Theory::Automaton::GetMaxNumOfBddNodes());
+    }
+    times["total"] = elapsed_ms(total_start);
+    writer.Key("time_ms");
+    writer.StartObject();
+    for (auto& time : times) {
+      writer.Key(time.first.c_str());
+      writer.Double(time.second);
+    }
+    writer.EndObject();
+    writer.EndObject();
+  }
+
+  const char* data = buffer.GetString();
+  std::size_t size = buffer.GetSize();
+  while (size > 0) {
+    ssize_t written = write(output, data, size);
+    if (written < 0 and errno == EINTR) {
+      continue;
+    } else if (written <= 0) {
+      break;
+    }
+    data += written;
+    size -= written;
+  }
+}
+
+/**
+ * Runs the benchmark in a child process so that crashes, time outs and peak memory are isolated
+ * @return result as json
+ */
+std::string run_benchmark(const Config& config, const std::string& file_name) {
+  int pipe_fds[2];
+  int pipe_result = pipe(pipe_fds);
+  CHECK_EQ(0, pipe_result) << "cannot create pipe";
+  pid_t pid = fork();
+  CHECK_GE(pid, 0) << "cannot fork";
+  if (pid == 0) {
+    close(pipe_fds[0]);
+    alarm(config.timeout);
+    solve_and_count(config, file_name, pipe_fds[1]);
+    close(pipe_fds[1]);
+    _exit(0);
+  }
+
+  close(pipe_fds[1]);
+  std::string output;
+  char buffer[4096];
+  ssize_t num_of_bytes;
+  while ((num_of_bytes = read(pipe_fds[0], buffer, sizeof(buffer))) != 0) {
+    if (num_of_bytes < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break;
+    }
+    output.append(buffer, num_of_bytes);
+  }
+  close(pipe_fds[0]);
+
+  int status = 0;
+  struct rusage usage;
+  while (wait4(pid, &status, 0, &usage) < 0 and errno == EINTR) {
+  }
+
+  rapidjson::Document result;
+  if (WIFEXITED(status) and WEXITSTATUS(status) == 0 and not result.Parse(output.c_str()).HasParseError()) {
+    result.AddMember("peak_rss_kb", static_cast<int64_t>(usage.ru_maxrss), result.GetAllocator());
+  } else {
+    result.SetObject();
+    bool is_timeout = WIFSIGNALED(status) and WTERMSIG(status) == SIGALRM;
+    result.AddMember("status", rapidjson::StringRef(is_timeout ? "timeout" : "error"), result.GetAllocator());
+  }
+
+  rapidjson::StringBuffer result_buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(result_buffer);
+  result.Accept(writer);
+  return result_buffer.GetString();
+}
+
+/**
+ * Keeps the fastest time of each phase and the largest memory over the repeated runs
+ */
+void merge_repeat(rapidjson::Value& result, const rapidjson::Value& other, rapidjson::Document::AllocatorType& allocator) {
+  if (std::string(other["status"].GetString()) != "ok") {
+    result.CopyFrom(other, allocator);
+    return;
+  }
+  if (std::string(result["status"].GetString()) != "ok") {
+    return;
+  }
+  for (auto it = result["time_ms"].MemberBegin(); it != result["time_ms"].MemberEnd(); ++it) {
+    if (other["time_ms"].HasMember(it->name)) {
+      it->value.SetDouble(std::min(it->value.GetDouble(), other["time_ms"][it->name].GetDouble()));
+    }
+  }
+  if (result.HasMember("peak_rss_kb")) {
+    result["peak_rss_kb"].SetInt64(std::max(result["peak_rss_kb"].GetInt64(), other["peak_rss_kb"].GetInt64()));
+  }
+}
+
+static std::string get_counts(const rapidjson::Value& benchmark) {
+  if (not benchmark.HasMember("counts")) {
+    return "";
+  }
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  benchmark["counts"].Accept(writer);
+  return buffer.GetString();
+}
+
+/**
+ * Reports benchmarks that got slower, changed their result or fail against the baseline
+ * @return 1 if there is a regression, 0 otherwise
+ */
+int compare_with_baseline(const Config& config, const rapidjson::Document& results) {
+  std::ifstream baseline_file(config.baseline_file);
+  std::stringstream baseline_json;
+  baseline_json << baseline_file.rdbuf();
+  rapidjson::Document baseline;
+  if (not baseline_file.good() or baseline.Parse(baseline_json.str().c_str()).HasParseError()
+      or not baseline.HasMember("benchmarks")) {
+    std::cerr << "cannot read baseline: " << config.baseline_file << std::endl;
+    return 2;
+  }
+
+  std::map<std::string, const rapidjson::Value*> baseline_benchmarks;
+  for (auto& benchmark : baseline["benchmarks"].GetArray()) {
+    baseline_benchmarks[std::string(benchmark["suite"].GetString()) + "/" + benchmark["file"].GetString()] = &benchmark;
+  }
+
+  unsigned num_of_regressions = 0;
+  for (auto& benchmark : results["benchmarks"].GetArray()) {
+    std::string name = std::string(benchmark["suite"].GetString()) + "/" + benchmark["file"].GetString();
+    auto it = baseline_benchmarks.find(name);
+    if (it == baseline_benchmarks.end()) {
+      continue;
+    }
+    const rapidjson::Value& old_benchmark = *it->second;
+    std::string status = benchmark["status"].GetString();
+    std::string old_status = old_benchmark["status"].GetString();
+    if (status != old_status) {
+      std::cerr << "regression " << name << ": status " << old_status << " -> " << status << std::endl;
+      ++num_of_regressions;
+      continue;
+    } else if (status != "ok") {
+      continue;
+    }
+
+    if (benchmark["sat"].GetBool() != old_benchmark["sat"].GetBool() or get_counts(benchmark) != get_counts(old_benchmark)) {
+      std::cerr << "regression " << name << ": result " << get_counts(old_benchmark) << " -> " << get_counts(benchmark) << std::endl;
+      ++num_of_regressions;
+    }
+    double time = benchmark["time_ms"]["total"].GetDouble();
+    double old_time = old_benchmark["time_ms"]["total"].GetDouble();
+    if (old_time >= config.min_time and time > old_time * (1 + config.tolerance)) {
+      std::cerr << "regression " << name << ": time " << old_time << " ms -> " << time << " ms" << std::endl;
+      ++num_of_regressions;
+    }
+  }
+
+  std::cerr << num_of_regressions << " regressions against " << config.baseline_file << std::endl;
+  return num_of_regressions == 0 ? 0 : 1;
+}
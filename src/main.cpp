@@ -8,6 +8,7 @@
  ============================================================================
  */
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <iostream>
@@ -23,6 +24,7 @@
 #include <glog/vlog_is_on.h>
 
 #include "Driver.h"
+#include "Server.h"
 #include "solver/options/Solver.h"
 #include "smt/ast.h"
 #include "solver/Value.h"
@@ -34,6 +36,8 @@
 //static const std::string get_default_log_dir();
 
 std::vector<unsigned long> parse_count_bounds(std::string);
+void report_count_sweep(const std::vector<unsigned long>& bounds, const std::vector<Vlab::Theory::BigInteger>& counts,
+                        std::chrono::steady_clock::duration sweep_time);
 
 int main(const int argc, const char **argv) {
   google::InstallFailureSignalHandler();
@@ -60,6 +64,11 @@ int main(const int argc, const char **argv) {
   std::vector<unsigned long> int_bounds;
   std::string count_variable {""};
   unsigned long num_models = 0;
+  bool is_sat_only = false;
+  bool is_serving = false;
+  std::string socket_path {""};
+  std::size_t num_of_workers = 1;
+  Vlab::Theory::SymbolicCounter::Method count_method = Vlab::Theory::SymbolicCounter::Method::ITERATIVE;
 
   for (int i = 1; i < argc; ++i) {
     if (argv[i] == std::string("-i") or argv[i] == std::string("--input-file")) {
@@ -97,6 +106,37 @@ int main(const int argc, const char **argv) {
     	driver.set_option(Vlab::Option::Name::FORCE_DNF_FORMULA);
     } else if (argv[i] == std::string("--count-bound-exact")) {
     	driver.set_option(Vlab::Option::Name::COUNT_BOUND_EXACT);
+    } else if (argv[i] == std::string("--count-by-squaring")) {
+      count_method = Vlab::Theory::SymbolicCounter::Method::MATRIX_EXPONENTIATION;
+    } else if (argv[i] == std::string("--count-by-recurrence")) {
+      count_method = Vlab::Theory::SymbolicCounter::Method::LINEAR_RECURRENCE;
+    } else if (argv[i] == std::string("--count-fixed-width")) {
+      count_method = Vlab::Theory::SymbolicCounter::Method::FIXED_WIDTH;
+    } else if (argv[i] == std::string("--count-modular")) {
+      count_method = Vlab::Theory::SymbolicCounter::Method::MODULAR;
+    } else if (argv[i] == std::string("--cache")) {
+      driver.set_option(Vlab::Option::Name::CACHE_PATH, std::string(argv[i + 1]));
+      ++i;
+    } else if (argv[i] == std::string("--threads")) {
+      driver.set_option(Vlab::Option::Name::NUM_OF_THREADS, std::stoi(argv[i + 1]));
+      ++i;
+    } else if (argv[i] == std::string("--sat-only")) {
+      is_sat_only = true;
+    } else if (argv[i] == std::string("--automaton-cache-size")) {
+      driver.set_option(Vlab::Option::Name::AUTOMATON_CACHE_SIZE, std::stoi(argv[i + 1]));
+      ++i;
+    } else if (argv[i] == std::string("--symbolic-arithmetic-threshold")) {
+      driver.set_option(Vlab::Option::Name::SYMBOLIC_ARITHMETIC_THRESHOLD, std::stoi(argv[i + 1]));
+      ++i;
+    } else if (argv[i] == std::string("--serve")) {
+      is_serving = true;
+    } else if (argv[i] == std::string("--serve-socket")) {
+      is_serving = true;
+      socket_path = argv[i + 1];
+      ++i;
+    } else if (argv[i] == std::string("--serve-workers")) {
+      num_of_workers = std::stoul(argv[i + 1]);
+      ++i;
     } else if (argv[i] == std::string("-bs") or argv[i] == std::string("--bound-str")) {
       std::string bounds_str {argv[i + 1]};
       str_bounds = parse_count_bounds(bounds_str);
@@ -137,7 +177,20 @@ int main(const int argc, const char **argv) {
       std::cout << std::setw(col) << "-bi or --bound-int <values>" << ": model count integer bit length bound e.g., -bs 10 or a set of bounds e.g., -bi \"4,8,16\"" << std::endl;
       std::cout << std::setw(col) << "-bv or --bound-var <values>" << ": model count integer bit length bound e.g., -b 10 or a set of bounds e.g., -b \"4,8,16\"" << std::endl;
       std::cout << std::setw(col) << "--count-variable <name>" << ": model counts projected variable instead of tuples e.g., --count-variable x" << std::endl;
+      std::cout << std::setw(col) << "--get-models <n>" << ": prints n models in length and lexicographic order, strings are bounded by -bs if given" << std::endl;
       std::cout << std::setw(col) << "--count-bound-exact" << ": model counts solutions of length exactly equal to given bound" << std::endl;
+      std::cout << std::setw(col) << "--count-by-squaring" << ": model counts with matrix exponentiation by successive squaring" << std::endl;
+      std::cout << std::setw(col) << "--count-by-recurrence" << ": model counts by evaluating the linear recurrence of the counts" << std::endl;
+      std::cout << std::setw(col) << "--count-fixed-width" << ": model counts with 64 bit arithmetic, big integers after overflow" << std::endl;
+      std::cout << std::setw(col) << "--cache <file>" << ": persistent cache of sat results and model counters" << std::endl;
+      std::cout << std::setw(col) << "--threads <n>" << ": number of threads used for counting, 0 uses all cores (default)" << std::endl;
+      std::cout << std::setw(col) << "--automaton-cache-size <MB>" << ": memory budget of the automata operation cache, 0 disables it (default 256)" << std::endl;
+      std::cout << std::setw(col) << "--symbolic-arithmetic-threshold <n>" << ": build arithmetic automata with at least n variables as bdds (default 8)" << std::endl;
+      std::cout << std::setw(col) << "--sat-only" << ": stops at the first sat disjunct, or with --force-dnf-formula at the first sat conjunction of the dnf, when nothing is counted" << std::endl;
+      std::cout << std::setw(col) << "--serve" << ": answers length prefixed queries on stdin with warm caches until stdin is closed, see Server.h" << std::endl;
+      std::cout << std::setw(col) << "--serve-socket <path>" << ": serves queries on a unix domain socket instead of stdin" << std::endl;
+      std::cout << std::setw(col) << "--serve-workers <n>" << ": number of queries solved at the same time in serve mode, 0 uses all cores (default 1)" << std::endl;
+      std::cout << std::setw(col) << "--count-modular" << ": model counts modulo word sized primes, reconstructed with CRT" << std::endl;
       std::cout << std::setw(col) << "--use-unsigned" << ": allows only positive integers" << std::endl;
       std::cout << std::setw(col) << "--use-signed" << ": allows positive and negative integers" << std::endl;
       std::cout << std::setw(col) << "--use-multitrack" << ": uses multitrack automata for strings" << std::endl;
@@ -173,12 +226,26 @@ int main(const int argc, const char **argv) {
 //  }
   /* log test end */
 
+  if (is_serving) {
+    Vlab::Server server(num_of_workers, count_method);
+    if (socket_path.empty()) {
+      server.Serve(0, 1);
+    } else {
+      server.ServeSocket(socket_path);
+    }
+    return 0;
+  }
+
   if (not in->good()) {
     LOG(FATAL) << "Cannot find input: ";
   }
 
   driver.test();
-  driver.Parse(in);
+  try {
+    driver.Parse(in);
+  } catch (const std::exception& e) {
+    LOG(FATAL) << e.what();
+  }
 
 #ifndef NDEBUG
   if (VLOG_IS_ON(30) and not output_root.empty()) {
@@ -186,6 +253,13 @@ int main(const int argc, const char **argv) {
   }
 #endif
 
+  // disjunctions may stop early only when nothing is counted or enumerated afterwards
+  const bool is_satisfiability_only = is_sat_only and num_models == 0 and count_variable.empty()
+      and str_bounds.empty() and int_bounds.empty();
+  if (is_satisfiability_only) {
+    driver.set_option(Vlab::Option::Name::ENABLE_SATISFIABILITY_ONLY);
+  }
+
   auto start = std::chrono::steady_clock::now();
   driver.InitializeSolver();
 
@@ -292,49 +366,46 @@ int main(const int argc, const char **argv) {
     LOG(INFO)<< "report is_sat: SAT time: " << std::chrono::duration <long double, std::milli> (solving_time).count() << " ms";
     if(num_models > 0) {
     	start = std::chrono::steady_clock::now();
-    	driver.GetModels(0,num_models);
+    	// models are bounded by the largest string bound if given
+    	std::vector<std::map<std::string, std::string>> models;
+    	if (str_bounds.empty()) {
+    	  models = driver.GetModels(num_models);
+    	} else {
+    	  models = driver.GetModels(*std::max_element(str_bounds.begin(), str_bounds.end()), num_models);
+    	}
     	end = std::chrono::steady_clock::now();
     	auto count_time = end-start;
-    	LOG(INFO) << "report get_models: " << num_models << " time: "
+    	for (auto& model : models) {
+    	  std::stringstream ss;
+    	  for (auto& var_entry : model) {
+    	    ss << var_entry.first << " = \"" << var_entry.second << "\" ";
+    	  }
+    	  LOG(INFO) << "report model: " << ss.str();
+    	}
+    	LOG(INFO) << "report get_models: " << models.size() << " time: "
     	                  << std::chrono::duration<long double, std::milli>(count_time).count() << " ms";
     }
 
-    if(not count_variable.empty()) {
+    if (is_satisfiability_only) {
+      // values of the variables are not collected
+    } else if(not count_variable.empty()) {
       LOG(INFO) << "report var: " << count_variable;
-      for (auto b : int_bounds) {
-        start = std::chrono::steady_clock::now();
-        auto count_result = driver.CountVariable(count_variable, b);
-        end = std::chrono::steady_clock::now();
-        auto count_time = end - start;
-        LOG(INFO) << "report bound: " << b << " count: " << count_result << " time: "
-                  << std::chrono::duration<long double, std::milli>(count_time).count() << " ms";
-      }
-      for (auto b : str_bounds) {
-        start = std::chrono::steady_clock::now();
-        auto count_result = driver.CountVariable(count_variable, b);
-        end = std::chrono::steady_clock::now();
-        auto count_time = end - start;
-        LOG(INFO) << "report bound: " << b << " count: " << count_result << " time: "
-                  << std::chrono::duration<long double, std::milli>(count_time).count() << " ms";
-        
-      }
+      std::vector<unsigned long> bounds = int_bounds;
+      bounds.insert(bounds.end(), str_bounds.begin(), str_bounds.end());
+      start = std::chrono::steady_clock::now();
+      auto count_results = driver.CountVariable(count_variable, bounds, count_method);
+      end = std::chrono::steady_clock::now();
+      report_count_sweep(bounds, count_results, end - start);
     } else {
-      for (auto b : int_bounds) {
-        start = std::chrono::steady_clock::now();
-        auto count = driver.CountInts(b);
-        end = std::chrono::steady_clock::now();
-        auto count_time = end - start;
-        LOG(INFO) << "report bound: " << b << " count: " << count << " time: "
-                  << std::chrono::duration<long double, std::milli>(count_time).count() << " ms";
-      }
-      for (auto b : str_bounds) {
-        start = std::chrono::steady_clock::now();
-        auto count = driver.CountStrs(b);
-        end = std::chrono::steady_clock::now();
-        auto count_time = end - start;
-        LOG(INFO) << "report bound: " << b << " count: " << count << " time: "
-                  << std::chrono::duration<long double, std::milli>(count_time).count() << " ms";
-      }
+      start = std::chrono::steady_clock::now();
+      auto count_results = driver.CountInts(int_bounds, count_method);
+      end = std::chrono::steady_clock::now();
+      report_count_sweep(int_bounds, count_results, end - start);
+
+      start = std::chrono::steady_clock::now();
+      count_results = driver.CountStrs(str_bounds, count_method);
+      end = std::chrono::steady_clock::now();
+      report_count_sweep(str_bounds, count_results, end - start);
     }
   } else {
     LOG(INFO) << "report is_sat: UNSAT time: " << std::chrono::duration <long double, std::milli> (solving_time).count() << " ms";
@@ -360,6 +431,19 @@ std::vector<unsigned long> parse_count_bounds(std::string bounds_str) {
   return bounds;
 }
 
+void report_count_sweep(const std::vector<unsigned long>& bounds, const std::vector<Vlab::Theory::BigInteger>& counts,
+                        std::chrono::steady_clock::duration sweep_time) {
+  if (bounds.empty()) {
+    return;
+  }
+  // bounds are counted together and share the count vector, only the sweep has a time
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    LOG(INFO) << "report bound: " << bounds[i] << " count: " << counts[i];
+  }
+  LOG(INFO) << "report bounds: " << bounds.size() << " time: "
+            << std::chrono::duration<long double, std::milli>(sweep_time).count() << " ms";
+}
+
 //static const std::string get_env_value(const char name[]) {
 //  const char* env;
 //  env = getenv(name);
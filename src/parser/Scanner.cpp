@@ -26,9 +26,11 @@ void Scanner::LexerOutput(const char* buf, int size) {
   yyout << std::setw(9) << Scanner::TAG << ": " << buf << std::endl;
 }
 
+/**
+ * The parser reports the error with its location and stops
+ */
 void Scanner::LexerError(const char* msg) {
-  std::cerr << std::setw(9) << Scanner::TAG << ": '" << yytext << "' at " << loc << " - " << msg << "\n";
-  std::exit(2);
+  throw Parser::syntax_error(loc, std::string(msg) + ": '" + yytext + "'");
 }
 
 } /* namespace SMT */
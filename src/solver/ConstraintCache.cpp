@@ -0,0 +1,201 @@
+/*
+ * ConstraintCache.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ConstraintCache.h"
+
+namespace Vlab {
+namespace Solver {
+
+const int ConstraintCache::VLOG_LEVEL = 12;
+
+const uint32_t ConstraintCache::RECORD_MAGIC = 0xABCCAC50;
+
+/**
+ * Record layout: magic (4 bytes), key length (4 bytes), key, canonical form length (8 bytes), canonical form,
+ * is sat (1 byte), has model counter (1 byte), model counter length (8 bytes), model counter.
+ */
+static const std::size_t RECORD_HEADER_SIZE = 2 * sizeof(uint32_t);
+static const std::size_t RECORD_BODY_HEADER_SIZE = 2 + sizeof(uint64_t);
+
+ConstraintCache::ConstraintCache(const std::string& file_path)
+    : file_path_ {file_path}, file_descriptor_ {-1}, data_ {nullptr}, mapped_size_ {0}, indexed_size_ {0} {
+  file_descriptor_ = open(file_path.c_str(), O_RDWR | O_CREAT, 0644);
+  if (file_descriptor_ < 0) {
+    LOG(ERROR) << "cannot open constraint cache: " << file_path << " (" << std::strerror(errno) << ")";
+    return;
+  }
+  Refresh();
+  DVLOG(VLOG_LEVEL) << "constraint cache " << file_path << " has " << index_.size() << " entries";
+}
+
+ConstraintCache::~ConstraintCache() {
+  Close();
+}
+
+std::string ConstraintCache::get_file_path() const {
+  return file_path_;
+}
+
+bool ConstraintCache::Find(const std::string& key, const std::string& canonical_form, Entry& entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_descriptor_ < 0) {
+    return false;
+  }
+  Refresh();
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    DVLOG(VLOG_LEVEL) << "cache miss: " << key;
+    return false;
+  }
+
+  const char* record = data_ + it->second;
+  uint64_t canonical_form_size = 0;
+  std::memcpy(&canonical_form_size, record, sizeof(uint64_t));
+  if (canonical_form_size != canonical_form.size()
+      or canonical_form.compare(0, canonical_form.size(), record + sizeof(uint64_t), canonical_form_size) != 0) {
+    LOG(WARNING) << "constraint cache key collision: " << key;
+    return false;
+  }
+
+  const char* body = record + sizeof(uint64_t) + canonical_form_size;
+  uint64_t model_counter_size = 0;
+  std::memcpy(&model_counter_size, body + 2, sizeof(uint64_t));
+  entry.is_sat = (body[0] != 0);
+  entry.has_model_counter = (body[1] != 0);
+  entry.model_counter.assign(body + RECORD_BODY_HEADER_SIZE, model_counter_size);
+  DVLOG(VLOG_LEVEL) << "cache hit: " << key;
+  return true;
+}
+
+void ConstraintCache::Store(const std::string& key, const std::string& canonical_form, const Entry& entry) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (file_descriptor_ < 0) {
+    return;
+  }
+
+  std::string record;
+  const uint32_t key_size = key.size();
+  const uint64_t canonical_form_size = canonical_form.size();
+  const uint64_t model_counter_size = entry.model_counter.size();
+  record.append(reinterpret_cast<const char*>(&RECORD_MAGIC), sizeof(uint32_t));
+  record.append(reinterpret_cast<const char*>(&key_size), sizeof(uint32_t));
+  record.append(key);
+  record.append(reinterpret_cast<const char*>(&canonical_form_size), sizeof(uint64_t));
+  record.append(canonical_form);
+  record.push_back(entry.is_sat ? 1 : 0);
+  record.push_back(entry.has_model_counter ? 1 : 0);
+  record.append(reinterpret_cast<const char*>(&model_counter_size), sizeof(uint64_t));
+  record.append(entry.model_counter);
+
+  if (flock(file_descriptor_, LOCK_EX) != 0) {
+    LOG(ERROR) << "cannot lock constraint cache: " << file_path_;
+    return;
+  }
+  struct stat file_stat;
+  fstat(file_descriptor_, &file_stat);
+  const ssize_t written = pwrite(file_descriptor_, record.data(), record.size(), file_stat.st_size);
+  if (written != static_cast<ssize_t>(record.size())) {
+    LOG(ERROR) << "cannot write constraint cache: " << file_path_;
+    // drop the partial record so that the next record starts at a record boundary
+    if (ftruncate(file_descriptor_, file_stat.st_size) != 0) {
+      LOG(ERROR) << "cannot truncate constraint cache: " << file_path_;
+    }
+  }
+  flock(file_descriptor_, LOCK_UN);
+  Refresh();
+}
+
+/**
+ * Maps the file again if it has grown since the last mapping and indexes the new records
+ */
+void ConstraintCache::Refresh() {
+  struct stat file_stat;
+  if (fstat(file_descriptor_, &file_stat) != 0) {
+    return;
+  }
+  const std::size_t file_size = file_stat.st_size;
+  if (file_size == mapped_size_) {
+    return;
+  }
+
+  if (data_ != nullptr) {
+    munmap(data_, mapped_size_);
+    data_ = nullptr;
+    mapped_size_ = 0;
+  }
+  if (file_size == 0) {
+    return;
+  }
+  void* data = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, file_descriptor_, 0);
+  if (data == MAP_FAILED) {
+    LOG(ERROR) << "cannot map constraint cache: " << file_path_;
+    return;
+  }
+  data_ = static_cast<char*>(data);
+  mapped_size_ = file_size;
+
+  while (ReadRecord(indexed_size_)) {
+  }
+}
+
+/**
+ * Indexes the record at the offset and moves the offset past it, fails on an incomplete record at the end of file
+ */
+bool ConstraintCache::ReadRecord(std::size_t& offset) {
+  if (offset + RECORD_HEADER_SIZE > mapped_size_) {
+    return false;
+  }
+  uint32_t magic = 0, key_size = 0;
+  std::memcpy(&magic, data_ + offset, sizeof(uint32_t));
+  std::memcpy(&key_size, data_ + offset + sizeof(uint32_t), sizeof(uint32_t));
+  if (magic != RECORD_MAGIC) {
+    LOG(ERROR) << "corrupted or incompatible constraint cache, cache is not used: " << file_path_ << " at "
+               << offset;
+    Close();
+    return false;
+  }
+
+  const std::size_t record_offset = offset + RECORD_HEADER_SIZE + key_size;
+  if (record_offset + sizeof(uint64_t) > mapped_size_) {
+    return false;
+  }
+  uint64_t canonical_form_size = 0;
+  std::memcpy(&canonical_form_size, data_ + record_offset, sizeof(uint64_t));
+  const std::size_t body_offset = record_offset + sizeof(uint64_t) + canonical_form_size;
+  if (body_offset + RECORD_BODY_HEADER_SIZE > mapped_size_) {
+    return false;
+  }
+  uint64_t model_counter_size = 0;
+  std::memcpy(&model_counter_size, data_ + body_offset + 2, sizeof(uint64_t));
+  const std::size_t end_offset = body_offset + RECORD_BODY_HEADER_SIZE + model_counter_size;
+  if (end_offset > mapped_size_) {
+    return false;
+  }
+
+  index_[std::string(data_ + offset + RECORD_HEADER_SIZE, key_size)] = record_offset;
+  offset = end_offset;
+  return true;
+}
+
+/**
+ * Unmaps and closes the file, later lookups miss and later stores are dropped
+ */
+void ConstraintCache::Close() {
+  index_.clear();
+  if (data_ != nullptr) {
+    munmap(data_, mapped_size_);
+    data_ = nullptr;
+    mapped_size_ = 0;
+  }
+  if (file_descriptor_ >= 0) {
+    close(file_descriptor_);
+    file_descriptor_ = -1;
+  }
+}
+
+} /* namespace Solver */
+} /* namespace Vlab */
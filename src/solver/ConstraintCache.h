@@ -0,0 +1,83 @@
+/*
+ * ConstraintCache.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_SOLVER_CONSTRAINTCACHE_H_
+#define SRC_SOLVER_CONSTRAINTCACHE_H_
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include <glog/logging.h>
+
+namespace Vlab {
+namespace Solver {
+
+/**
+ * Persistent store of solved constraints, keyed by the canonical script key.
+ * Records are appended to a single file that is memory mapped for lookups; later records of a key override earlier
+ * ones. Appends are guarded with a file lock so that several processes can share the same file.
+ * A record keeps the canonical form of its script, a hit is used only when the canonical forms are equal.
+ */
+class ConstraintCache {
+ public:
+  struct Entry {
+    bool is_sat = false;
+    bool has_model_counter = false;
+    /**
+     * cereal binary serialization of the model counter
+     */
+    std::string model_counter;
+  };
+
+  explicit ConstraintCache(const std::string& file_path);
+  virtual ~ConstraintCache();
+
+  std::string get_file_path() const;
+  bool Find(const std::string& key, const std::string& canonical_form, Entry& entry);
+  void Store(const std::string& key, const std::string& canonical_form, const Entry& entry);
+
+ protected:
+  ConstraintCache(const ConstraintCache&) = delete;
+  ConstraintCache& operator=(const ConstraintCache&) = delete;
+
+  void Refresh();
+  bool ReadRecord(std::size_t& offset);
+  void Close();
+
+  std::string file_path_;
+  int file_descriptor_;
+  char* data_;
+  std::size_t mapped_size_;
+  std::size_t indexed_size_;
+  /**
+   * Maps a key to the offset of the latest record of the key
+   */
+  std::map<std::string, std::size_t> index_;
+  std::mutex mutex_;
+
+ private:
+  static const int VLOG_LEVEL;
+  /**
+   * Changes with the record layout or the model counter serialization
+   */
+  static const uint32_t RECORD_MAGIC;
+};
+
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SRC_SOLVER_CONSTRAINTCACHE_H_ */
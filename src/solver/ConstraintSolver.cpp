@@ -19,6 +19,7 @@ ConstraintSolver::ConstraintSolver(Script_ptr script, SymbolTable_ptr symbol_tab
                                    ConstraintInformation_ptr constraint_information)
     : iteration_count_ { 0 },
       root_(script),
+      asserted_term_ { nullptr },
       symbol_table_(symbol_table),
       constraint_information_(constraint_information),
       arithmetic_constraint_solver_(script, symbol_table, constraint_information,
@@ -73,6 +74,7 @@ void ConstraintSolver::visitCommand(Command_ptr command) {
 void ConstraintSolver::visitAssert(Assert_ptr assert_command) {
   DVLOG(VLOG_LEVEL) << "visit: " << *assert_command;
 
+  asserted_term_ = assert_command->term;
   check_and_visit(assert_command->term);
 
   Value_ptr result = getTermValue(assert_command->term);
@@ -227,6 +229,10 @@ void ConstraintSolver::visitOr(Or_ptr or_term) {
 
   DVLOG(VLOG_LEVEL) << "visit children start: " << *or_term << "@" << or_term;
 
+  // only the sat bit of the assertion is asked, a satisfiable disjunct decides it
+  const bool can_stop_early = Option::Solver::SATISFIABILITY_ONLY and or_term == asserted_term_;
+  bool is_stopped_early = false;
+
   //if (constraint_information_->has_mixed_constraint(or_term)) {
   if(true) {
     for (auto& term : *(or_term->term_list)) {
@@ -242,11 +248,17 @@ void ConstraintSolver::visitOr(Or_ptr or_term) {
         clearTermValuesAndLocalLetVars();
       }
       is_satisfiable = is_satisfiable or is_scope_satisfiable;
+      is_stopped_early = can_stop_early and is_scope_satisfiable and are_values_satisfiable_at_scope(term);
       symbol_table_->pop_scope();
+      if (is_stopped_early) {
+        DVLOG(VLOG_LEVEL) << "satisfiable disjunct found, remaining disjuncts are skipped: " << *or_term << "@" << or_term;
+        is_satisfiable = true;
+        break;
+      }
     }
   }
 
-  if (is_component and is_satisfiable) {
+  if (is_component and is_satisfiable and not is_stopped_early) {
     if (constraint_information_->has_arithmetic_constraint(or_term)) {
       arithmetic_constraint_solver_.postVisitOr(or_term);
       is_satisfiable = arithmetic_constraint_solver_.get_term_value(or_term)->is_satisfiable();
@@ -452,6 +464,12 @@ void ConstraintSolver::visitNotEq(NotEq_ptr not_eq_term) {
     result = new Value(param_left->getIntConstant() not_eq param_right->getIntConstant());
   } else if (not (param_left->is_satisfiable() and param_right->is_satisfiable())) {
     result = new Value(false);
+  } else if (Value::Type::STRING_AUTOMATON == param_left->getType()
+      and Value::Type::STRING_AUTOMATON == param_right->getType() and param_left->isSingleValue()
+      and param_right->isSingleValue() and param_left->getStringAutomaton()->get_number_of_bdd_variables()
+          == param_right->getStringAutomaton()->get_number_of_bdd_variables()) {
+    // only emptiness of the intersection is needed, it is decided without building the intersection
+    result = new Value(param_left->getStringAutomaton()->IsIntersectionEmpty(param_right->getStringAutomaton()));
   } else {
     Value_ptr intersection = param_left->intersect(param_right);
     if (not intersection->is_satisfiable()) {
@@ -697,16 +715,14 @@ void ConstraintSolver::visitNotContains(NotContains_ptr not_contains_term) {
     contains_auto = nullptr;
   } else if (param_subject->isSingleValue()) {
     Theory::StringAutomaton_ptr sub_strings_auto = param_subject->getStringAutomaton()->SubStrings();
-    Theory::StringAutomaton_ptr difference_auto = param_search->getStringAutomaton()->Difference(sub_strings_auto);
-    delete sub_strings_auto;
-    sub_strings_auto = nullptr;
-    if (difference_auto->IsEmptyLanguage()) {
+    // only emptiness of the difference is needed, it is decided without building the difference
+    if (param_search->getStringAutomaton()->IsDifferenceEmpty(sub_strings_auto)) {
       result = new Value(Theory::StringAutomaton::MakePhi());
     } else {
       result = param_subject->clone();
     }
-    delete difference_auto;
-    difference_auto = nullptr;
+    delete sub_strings_auto;
+    sub_strings_auto = nullptr;
   } else {
     // TODO if param_subject is a suffix automaton (all the strings accepted is actually substrings of largest length string),
     // there can be a more precise calculation instead of just cloning the subject
@@ -743,16 +759,14 @@ void ConstraintSolver::visitNotBegins(NotBegins_ptr not_begins_term) {
     begins_auto = nullptr;
   } else if (param_subject->isSingleValue()) {
     Theory::StringAutomaton_ptr prefixes_auto = param_subject->getStringAutomaton()->Prefixes();
-    Theory::StringAutomaton_ptr difference_auto = param_search->getStringAutomaton()->Difference(prefixes_auto);
-    delete prefixes_auto;
-    prefixes_auto = nullptr;
-    if (difference_auto->IsEmptyLanguage()) {
+    // only emptiness of the difference is needed, it is decided without building the difference
+    if (param_search->getStringAutomaton()->IsDifferenceEmpty(prefixes_auto)) {
       result = new Value(Theory::StringAutomaton::MakePhi());
     } else {
       result = param_subject->clone();
     }
-    delete difference_auto;
-    difference_auto = nullptr;
+    delete prefixes_auto;
+    prefixes_auto = nullptr;
   } else {
     result = param_subject->clone();
   }
@@ -787,16 +801,14 @@ void ConstraintSolver::visitNotEnds(NotEnds_ptr not_ends_term) {
     ends_auto = nullptr;
   } else if (param_subject->isSingleValue()) {
     Theory::StringAutomaton_ptr suffixes_auto = param_subject->getStringAutomaton()->Suffixes();
-    Theory::StringAutomaton_ptr difference_auto = param_search->getStringAutomaton()->Difference(suffixes_auto);
-    delete suffixes_auto;
-    suffixes_auto = nullptr;
-    if (difference_auto->IsEmptyLanguage()) {
+    // only emptiness of the difference is needed, it is decided without building the difference
+    if (param_search->getStringAutomaton()->IsDifferenceEmpty(suffixes_auto)) {
       result = new Value(Theory::StringAutomaton::MakePhi());
     } else {
       result = param_subject->clone();
     }
-    delete difference_auto;
-    difference_auto = nullptr;
+    delete suffixes_auto;
+    suffixes_auto = nullptr;
   } else {
     result = param_subject->clone();
   }
@@ -1243,6 +1255,18 @@ void ConstraintSolver::visit_children_of(Term_ptr term) {
   path_trace_.pop_back();
 }
 
+/**
+ * Multi-track values of a disjunct are solved before its terms are visited, an empty one makes the disjunct unsat
+ */
+bool ConstraintSolver::are_values_satisfiable_at_scope(Visitable_ptr scope) {
+  for (auto& variable_entry : symbol_table_->get_values_at_scope(scope)) {
+    if (variable_entry.second != nullptr and not variable_entry.second->is_satisfiable()) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool ConstraintSolver::check_and_visit(Term_ptr term) {
   if ((Term::Type::OR not_eq term->type()) and (Term::Type::AND not_eq term->type())) {
     if (constraint_information_->has_arithmetic_constraint(term)) {  // if arithmetic constraint and has string terms
@@ -127,9 +127,11 @@ class ConstraintSolver: public SMT::Visitor {
   void visit_children_of(SMT::Term_ptr term);
   bool check_and_visit(SMT::Term_ptr term);
   bool process_mixed_integer_string_constraints_in(SMT::Term_ptr term);
+  bool are_values_satisfiable_at_scope(SMT::Visitable_ptr scope);
 
   int iteration_count_;
   SMT::Script_ptr root_;
+  SMT::Term_ptr asserted_term_;
   SymbolTable_ptr symbol_table_;
   ConstraintInformation_ptr constraint_information_;
 
@@ -13,14 +13,13 @@ namespace Solver {
 using namespace SMT;
 
 const int ConstraintSorter::VLOG_LEVEL = 13;
-std::string ConstraintSorter::TermNode::count_var;
 
 ConstraintSorter::ConstraintSorter(Script_ptr script, SymbolTable_ptr symbol_table)
         : root(script), symbol_table(symbol_table), term_node(nullptr) {
 
 	if(symbol_table->has_count_variable()) {
 		auto var = symbol_table->get_count_variable();
-		ConstraintSorter::TermNode::count_var = var->getName();
+		count_var = var->getName();
 	}
 }
 
@@ -107,9 +106,9 @@ void ConstraintSorter::visitAnd(And_ptr and_term) {
   std::vector<Term_ptr> unsorted_constraints;
 
   if(symbol_table->has_count_variable()) {
-		auto count_var = symbol_table->get_count_variable();
-		auto rep_count_var = symbol_table->get_representative_variable_of_at_scope(symbol_table->top_scope(),count_var);
-		ConstraintSorter::TermNode::count_var = rep_count_var->getName();
+		auto count_variable = symbol_table->get_count_variable();
+		auto rep_count_var = symbol_table->get_representative_variable_of_at_scope(symbol_table->top_scope(),count_variable);
+		count_var = rep_count_var->getName();
 	}
 
   for(auto iter = and_term->term_list->begin(); iter != and_term->term_list->end();) {
@@ -127,7 +126,7 @@ void ConstraintSorter::visitAnd(And_ptr and_term) {
 				term_node->setNode(*iter);
 			}
 			term_node->addMeToChildVariableNodes();
-			term_node->updateSymbolicVariableInfo();
+			term_node->updateSymbolicVariableInfo(count_var);
 			local_dependency_node_list.push_back(term_node);
 			iter++;
   	}
@@ -649,7 +648,7 @@ ConstraintSorter::TermNode_ptr ConstraintSorter::process_child_nodes(TermNode_pt
 
 void ConstraintSorter::sort_terms(std::vector<TermNode_ptr>& term_node_list) {
 	// if no count variable, just sort based on number of total variables in each term
-	if(ConstraintSorter::TermNode::count_var.empty()) {
+	if(count_var.empty()) {
 		std::stable_sort(term_node_list.begin(), term_node_list.end(),
 							[](TermNode_ptr left_node, TermNode_ptr right_node) -> bool {
 								return (left_node->numOfTotalVars() < right_node->numOfTotalVars());
@@ -786,7 +785,7 @@ int ConstraintSorter::TermNode::numOfRightVars() {
   return _right_child_node_list.size();
 }
 
-void ConstraintSorter::TermNode::updateSymbolicVariableInfo() {
+void ConstraintSorter::TermNode::updateSymbolicVariableInfo(const std::string& count_var) {
 	if(count_var.empty()) {
   	return;
   }
@@ -284,6 +284,10 @@ protected:
   SMT::Script_ptr root;
   SymbolTable_ptr symbol_table;
   TermNode_ptr term_node;
+  /**
+   * Representative of the count variable, empty when the script has none; per sorter, workers sort at the same time
+   */
+  std::string count_var;
 
   std::vector<TermNode_ptr> dependency_node_list;
   std::map<SMT::Variable_ptr, VariableNode_ptr> variable_nodes;
@@ -308,12 +312,10 @@ protected:
     int numOfTotalVars();
     int numOfLeftVars();
     int numOfRightVars();
-    void updateSymbolicVariableInfo();
+    void updateSymbolicVariableInfo(const std::string& count_var);
     bool hasSymbolicVarOnLeft();
     bool hasSymbolicVarOnRight();
     bool hasSymbolicVar();
-
-    static std::string count_var;
   protected:
     SMT::Term_ptr _node;
     bool _has_symbolic_var_on_left;
@@ -155,23 +155,29 @@ Term_ptr EquivalenceClass::get_representative_term() {
  * Do not change representative variable
  * Do not change representative term unless there is a constant
  */
-void EquivalenceClass::merge(EquivalenceClass_ptr other) {
+void EquivalenceClass::merge(EquivalenceClass_ptr other, const bool keep_other_representative) {
+  EquivalenceClass_ptr first = keep_other_representative ? other : this;
   bool can_update_representative_term_to_constant = false;
   bool can_update_representative_term_to_unclassified_term = false;
-  if (constants_.size() == 0) {
+  if (first->constants_.size() == 0) {
     can_update_representative_term_to_constant = true;
-    if (unclassified_terms_.size() == 0) {
+    if (first->unclassified_terms_.size() == 0) {
       can_update_representative_term_to_unclassified_term = true;
     }
   }
+  if (keep_other_representative) {
+    std::swap(representative_variable_, other->representative_variable_);
+    std::swap(representative_term_, other->representative_term_);
+    std::swap(rep_string, other->rep_string);
+  }
 
+  // members are moved, the other class is deleted after a merge
   variables_.insert(other->variables_.begin(), other->variables_.end());
-  for (auto c : other->constants_) {
-    constants_.insert(c->clone());
-  }
-  for (auto u : other->unclassified_terms_) {
-    unclassified_terms_.insert(u->clone());
-  }
+  constants_.insert(other->constants_.begin(), other->constants_.end());
+  unclassified_terms_.insert(other->unclassified_terms_.begin(), other->unclassified_terms_.end());
+  other->variables_.clear();
+  other->constants_.clear();
+  other->unclassified_terms_.clear();
 
   // if we do not have a constant but now if we do, update representative term
   if (can_update_representative_term_to_constant and constants_.size() > 0) {
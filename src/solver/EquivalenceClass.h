@@ -52,7 +52,11 @@ class EquivalenceClass {
   SMT::Variable_ptr get_representative_variable();
   SMT::Term_ptr get_representative_term();
 
-  void merge(EquivalenceClass_ptr other);
+  /**
+   * Moves the members of the other class into this one, the other class is left empty
+   * @param keep_other_representative representatives are chosen as if the other class absorbed this one
+   */
+  void merge(EquivalenceClass_ptr other, const bool keep_other_representative = false);
 
 
   friend std::ostream& operator<<(std::ostream& os, const EquivalenceClass& equiv_class);
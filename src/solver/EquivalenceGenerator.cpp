@@ -238,14 +238,25 @@ bool EquivalenceGenerator::is_equiv_of_bool_var_and_term(SMT::Term_ptr left_term
   return false;
 }
 
+/**
+ * The class with more variables absorbs the other one and keeps its identity, the representatives are still chosen as
+ * if the left class absorbed the right one. A variable is remapped only when its class at least doubles, which keeps
+ * long chains of variable equalities near linear.
+ */
 void EquivalenceGenerator::update_equiv_class_and_symbol_table(EquivalenceClass_ptr left_equiv,
                                                                EquivalenceClass_ptr right_equiv) {
 //  DVLOG(VLOG_LEVEL)<< "merge: " << *left_equiv << " U " << *right_equiv;
-  left_equiv->merge(right_equiv);
-  for (auto variable : right_equiv->get_variables()) {
-    symbol_table_->add_variable_equiv_class_mapping(variable, left_equiv);
+  if (left_equiv == right_equiv) {
+    return;
+  }
+  const bool is_right_larger = right_equiv->get_number_of_variables() > left_equiv->get_number_of_variables();
+  EquivalenceClass_ptr kept_equiv = is_right_larger ? right_equiv : left_equiv;
+  EquivalenceClass_ptr absorbed_equiv = is_right_larger ? left_equiv : right_equiv;
+  for (auto variable : absorbed_equiv->get_variables()) {
+    symbol_table_->add_variable_equiv_class_mapping(variable, kept_equiv);
   }
-  delete right_equiv;
+  kept_equiv->merge(absorbed_equiv, is_right_larger);
+  delete absorbed_equiv;
 }
 
 void EquivalenceGenerator::update_equiv_class_and_symbol_table(EquivalenceClass_ptr equiv, SMT::Variable_ptr variable) {
@@ -0,0 +1,291 @@
+/*
+ * IncrementalContext.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "IncrementalContext.h"
+
+namespace Vlab {
+namespace Solver {
+
+const int IncrementalContext::VLOG_LEVEL = 11;
+
+IncrementalContext::IncrementalContext()
+    : frames_(1) {
+}
+
+IncrementalContext::~IncrementalContext() {
+}
+
+bool IncrementalContext::Assert(const std::string& constraint, const SolveFunction& solve) {
+  error_.clear();
+  for (auto& command : SplitCommands(constraint)) {
+    auto symbols = GetSymbols(command);
+    if (symbols.empty()) {
+      continue;
+    }
+    const std::string& name = symbols.front();
+    unsigned levels = 0;
+    if (name == "declare-fun" or name == "declare-const" or name == "declare-variable") {
+      AddDeclaration(command, symbols);
+    } else if (name == "assert") {
+      AddAssertion(command, symbols, solve);
+    } else if (name == "push" or name == "pop") {
+      if (not GetLevels(symbols, levels)) {
+        AddError("invalid level count: " + command);
+      } else if (name == "push") {
+        Push(levels);
+      } else if (not Pop(levels)) {
+        AddError("cannot pop " + std::to_string(levels) + " levels, stack has " + std::to_string(num_of_levels()));
+      }
+    } else {
+      DVLOG(VLOG_LEVEL) << "ignored incremental command: " << command;
+    }
+  }
+  return is_sat();
+}
+
+void IncrementalContext::Push(unsigned levels) {
+  for (; levels > 0; --levels) {
+    frames_.push_back(frames_.back());
+  }
+}
+
+bool IncrementalContext::Pop(unsigned levels) {
+  if (levels >= frames_.size()) {
+    LOG(ERROR) << "cannot pop " << levels << " levels, stack has " << num_of_levels();
+    return false;
+  }
+  frames_.resize(frames_.size() - levels);
+  return true;
+}
+
+void IncrementalContext::Clear() {
+  frames_.clear();
+  frames_.resize(1);
+}
+
+bool IncrementalContext::is_sat() const {
+  for (auto& component : frames_.back().components) {
+    if (not component.is_sat) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t IncrementalContext::num_of_levels() const {
+  return frames_.size() - 1;
+}
+
+const std::string& IncrementalContext::get_error() const {
+  return error_;
+}
+
+std::string IncrementalContext::GetScript() const {
+  std::stringstream ss;
+  auto& frame = frames_.back();
+  for (auto& name : frame.declaration_order) {
+    ss << frame.declarations.at(name) << std::endl;
+  }
+  for (auto& component : frame.components) {
+    for (auto& assertion : component.assertions) {
+      ss << assertion << std::endl;
+    }
+  }
+  ss << "(check-sat)" << std::endl;
+  return ss.str();
+}
+
+/**
+ * Splits text into top level s-expressions, parentheses in string literals, regexes and quoted symbols are skipped
+ */
+std::vector<std::string> IncrementalContext::SplitCommands(const std::string& text) {
+  std::vector<std::string> commands;
+  int depth = 0;
+  std::size_t start = 0;
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    const char c = text[i];
+    if (c == ';') {
+      while (i < text.size() and text[i] != '\n') {
+        ++i;
+      }
+    } else if (c == '"' or c == '|' or (c == '/' and depth > 0)) {
+      const std::size_t end = text.find(c, i + 1);
+      i = (end == std::string::npos) ? text.size() : end;
+    } else if (c == '(') {
+      if (depth == 0) {
+        start = i;
+      }
+      ++depth;
+    } else if (c == ')') {
+      --depth;
+      if (depth == 0) {
+        commands.push_back(text.substr(start, i - start + 1));
+      }
+    }
+  }
+  return commands;
+}
+
+/**
+ * Symbols of a command in order, literals are skipped and quoted symbols are unquoted
+ */
+std::vector<std::string> IncrementalContext::GetSymbols(const std::string& command) {
+  std::vector<std::string> symbols;
+  std::string symbol;
+  for (std::size_t i = 0; i < command.size(); ++i) {
+    const char c = command[i];
+    if (c == '"' or c == '/' or c == '|') {
+      if (not symbol.empty()) {
+        symbols.push_back(symbol);
+        symbol.clear();
+      }
+      const std::size_t end = command.find(c, i + 1);
+      if (c == '|') {
+        symbols.push_back(command.substr(i + 1, end - i - 1));
+      }
+      i = (end == std::string::npos) ? command.size() : end;
+    } else if (c == '(' or c == ')' or std::isspace(static_cast<unsigned char>(c))) {
+      if (not symbol.empty()) {
+        symbols.push_back(symbol);
+        symbol.clear();
+      }
+    } else {
+      symbol.push_back(c);
+    }
+  }
+  if (not symbol.empty()) {
+    symbols.push_back(symbol);
+  }
+  return symbols;
+}
+
+bool IncrementalContext::GetLevels(const std::vector<std::string>& symbols, unsigned& levels) {
+  levels = 1;
+  if (symbols.size() < 2) {
+    return true;
+  }
+  const std::string& count = symbols[1];
+  // at most 9 digits, any stack is smaller than that
+  if (count.empty() or count.size() > 9 or count.find_first_not_of("0123456789") != std::string::npos) {
+    return false;
+  }
+  levels = static_cast<unsigned>(std::stoul(count));
+  return true;
+}
+
+void IncrementalContext::AddDeclaration(const std::string& command, const std::vector<std::string>& symbols) {
+  if (symbols.size() < 2) {
+    AddError("malformed declaration: " + command);
+    return;
+  }
+  auto& frame = frames_.back();
+  const std::string& variable_name = symbols[1];
+  if (frame.declarations.find(variable_name) == frame.declarations.end()) {
+    frame.declaration_order.push_back(variable_name);
+  }
+  frame.declarations[variable_name] = command;
+}
+
+/**
+ * Merges the components that share a variable with the assertion and solves the merged component unless one of them
+ * is already unsatisfiable. An assertion on a single variable of one solved component refines the solved state.
+ * A merge of several components is solved from scratch, their states are not combined.
+ * The frame is changed only after solving succeeds, a throwing solve function leaves the context as it was.
+ */
+void IncrementalContext::AddAssertion(const std::string& command, const std::vector<std::string>& symbols,
+                                      const SolveFunction& solve) {
+  auto& frame = frames_.back();
+  Component assertion;
+  assertion.assertions.push_back(command);
+  for (auto& symbol : symbols) {
+    if (frame.declarations.find(symbol) != frame.declarations.end()) {
+      assertion.variables.insert(symbol);
+    }
+  }
+
+  Component merged;
+  merged.variables = assertion.variables;
+  std::vector<Component> components;
+  std::size_t num_of_merged_components = 0;
+  bool is_state_shared = false;
+  for (auto& component : frame.components) {
+    bool is_shared = false;
+    for (auto& variable : component.variables) {
+      if (merged.variables.find(variable) != merged.variables.end()) {
+        is_shared = true;
+        break;
+      }
+    }
+    if (is_shared) {
+      merged.variables.insert(component.variables.begin(), component.variables.end());
+      merged.assertions.insert(merged.assertions.end(), component.assertions.begin(), component.assertions.end());
+      merged.is_sat = merged.is_sat and component.is_sat;
+      merged.state = component.state;
+      // frames of lower push levels hold the other references
+      is_state_shared = component.state.use_count() > 2;
+      ++num_of_merged_components;
+    } else {
+      components.push_back(component);
+    }
+  }
+  merged.assertions.push_back(command);
+  if (num_of_merged_components != 1) {
+    merged.state = nullptr;
+  }
+
+  // an unsatisfiable component is popped only together with the new assertion, solving can wait until then
+  bool has_unsat_component = false;
+  for (auto& component : components) {
+    has_unsat_component = has_unsat_component or not component.is_sat;
+  }
+
+  // a state shared with a lower push level must not change, the component is solved again instead
+  const bool is_refinable = assertion.variables.size() == 1 and merged.state != nullptr and not is_state_shared;
+  if (not merged.is_sat) {
+    DVLOG(VLOG_LEVEL) << "component is already unsatisfiable";
+  } else if (has_unsat_component) {
+    DVLOG(VLOG_LEVEL) << "another component is unsatisfiable, component is not solved";
+    merged.state = nullptr;
+  } else if (is_refinable and merged.state->Refine(*assertion.variables.begin(), GetScript(assertion))) {
+    DVLOG(VLOG_LEVEL) << "assertion is added to the solved component, " << components.size() << " components kept";
+    merged.is_sat = merged.state->is_sat();
+  } else {
+    DVLOG(VLOG_LEVEL) << "solving component with " << merged.assertions.size() << " assertions, "
+                      << components.size() << " components kept";
+    merged.state = solve(GetScript(merged));
+    merged.is_sat = merged.state->is_sat();
+  }
+
+  components.push_back(std::move(merged));
+  frame.components = std::move(components);
+}
+
+std::string IncrementalContext::GetScript(const Component& component) const {
+  std::stringstream ss;
+  auto& frame = frames_.back();
+  for (auto& name : frame.declaration_order) {
+    if (component.variables.find(name) != component.variables.end()) {
+      ss << frame.declarations.at(name) << std::endl;
+    }
+  }
+  for (auto& assertion : component.assertions) {
+    ss << assertion << std::endl;
+  }
+  ss << "(check-sat)" << std::endl;
+  return ss.str();
+}
+
+void IncrementalContext::AddError(const std::string& message) {
+  LOG(ERROR) << message;
+  if (not error_.empty()) {
+    error_ += "; ";
+  }
+  error_ += message;
+}
+
+} /* namespace Solver */
+} /* namespace Vlab */
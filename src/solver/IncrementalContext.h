@@ -0,0 +1,128 @@
+/*
+ * IncrementalContext.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_SOLVER_INCREMENTALCONTEXT_H_
+#define SRC_SOLVER_INCREMENTALCONTEXT_H_
+
+#include <cctype>
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+namespace Vlab {
+namespace Solver {
+
+/**
+ * Keeps the assertion stack of an incremental session.
+ * Assertions are grouped into components of assertions that share variables. A new assertion is merged with the
+ * components it shares variables with and only the merged component is solved again; results of the other
+ * components are kept. An assertion on a single variable of a solved component is added to the solved state of the
+ * component when the state can take it, the component is not solved again then. An unsatisfiable component keeps
+ * the session unsatisfiable until it is popped, components asserted meanwhile are solved when they are merged later.
+ */
+class IncrementalContext {
+ public:
+  /**
+   * Solved state of a component
+   */
+  class ComponentState {
+   public:
+    virtual ~ComponentState() {
+    }
+    virtual bool is_sat() = 0;
+    /**
+     * Intersects the solved state with the assertions of a script that declares only the given variable
+     * @return false when the state cannot take the assertions, the component is solved again then
+     * The state must not change when it throws.
+     */
+    virtual bool Refine(const std::string& variable_name, const std::string& script) = 0;
+  };
+  using ComponentState_ptr = std::shared_ptr<ComponentState>;
+
+  /**
+   * Solves a complete SMT-LIB script and returns its solved state
+   */
+  using SolveFunction = std::function<ComponentState_ptr(const std::string& script)>;
+
+  IncrementalContext();
+  virtual ~IncrementalContext();
+
+  /**
+   * Processes declare-fun, assert, push and pop commands in the given SMT-LIB text, other commands are ignored.
+   * Malformed commands are skipped and reported by get_error.
+   * @return satisfiability of all assertions in the stack
+   */
+  bool Assert(const std::string& constraint, const SolveFunction& solve);
+  void Push(unsigned levels = 1);
+  /**
+   * @return false and keeps the stack when there are fewer levels than given
+   */
+  bool Pop(unsigned levels = 1);
+  void Clear();
+
+  bool is_sat() const;
+  std::size_t num_of_levels() const;
+  /**
+   * @return errors of the last Assert call, empty when all commands are processed
+   */
+  const std::string& get_error() const;
+
+  /**
+   * @return script with all declarations and assertions in the stack
+   */
+  std::string GetScript() const;
+
+  static std::vector<std::string> SplitCommands(const std::string& text);
+  static std::vector<std::string> GetSymbols(const std::string& command);
+  /**
+   * Reads the level count of a push or pop command, 1 when it is not given
+   * @return false when the count is not a non-negative number
+   */
+  static bool GetLevels(const std::vector<std::string>& symbols, unsigned& levels);
+
+ protected:
+  struct Component {
+    std::set<std::string> variables;
+    std::vector<std::string> assertions;
+    bool is_sat = true;
+    /**
+     * nullptr when the component is not solved; frames of push levels share the state until it changes
+     */
+    ComponentState_ptr state;
+  };
+
+  struct Frame {
+    std::vector<std::string> declaration_order;
+    std::map<std::string, std::string> declarations;
+    std::vector<Component> components;
+  };
+
+  void AddDeclaration(const std::string& command, const std::vector<std::string>& symbols);
+  void AddAssertion(const std::string& command, const std::vector<std::string>& symbols, const SolveFunction& solve);
+  std::string GetScript(const Component& component) const;
+  void AddError(const std::string& message);
+
+  /**
+   * Frames of push levels, back is the current state
+   */
+  std::vector<Frame> frames_;
+  std::string error_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SRC_SOLVER_INCREMENTALCONTEXT_H_ */
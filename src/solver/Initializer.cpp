@@ -59,15 +59,20 @@ void Initializer::visitCommand(Command_ptr command) {
   switch (command->getType()) {
   case Command::Type::DECLARE_FUN: {
     visit_children_of(command);
-    CHECK_EQ(1, primitives_.size())<< "Expecting one symbol name.";
-    CHECK_EQ(1, sorts_.size())<< "Currently supports only functions with no arguments.";
+    // declarations come from the script, a wrong one is reported to the caller
+    if (primitives_.size() != 1) {
+      throw std::runtime_error("expecting one symbol name in a declaration");
+    }
+    if (sorts_.size() != 1) {
+      throw std::runtime_error("currently supports only functions with no arguments");
+    }
 
     Primitive_ptr primitive = primitives_.top();
     primitives_.pop();
     Sort_ptr sort = sorts_.top();
     sorts_.pop();
     if (sort->var_type == nullptr) {
-      LOG(FATAL) << "Type is not supported: " << primitive->getData() << "<" << sort->identifier->getName() << ">";
+      throw std::runtime_error("type is not supported: " + primitive->getData() + "<" + sort->identifier->getName() + ">");
     }
     Variable_ptr variable = new Variable(primitive, sort->var_type->getType());
     symbol_table_->add_variable(variable);
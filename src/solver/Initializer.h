@@ -13,6 +13,7 @@
 #include <iterator>
 #include <map>
 #include <stack>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -42,9 +42,69 @@ void ModelCounter::add_symbolic_counter(const Theory::SymbolicCounter& counter)
 }
 
 
-Theory::BigInteger ModelCounter::CountInts(const unsigned long bound) {
-  Theory::BigInteger result(1);
+Theory::BigInteger ModelCounter::CountInts(const unsigned long bound, const Theory::SymbolicCounter::Method method) {
+  if (not IsConstantIntsInBound(bound)) {
+    return 0; // no need to compute further
+  }
+
+  return CountSymbolic(std::vector<unsigned long> {bound}, false, method).front();
+}
+
+Theory::BigInteger ModelCounter::CountStrs(const unsigned long bound, const Theory::SymbolicCounter::Method method) {
+  return CountSymbolic(std::vector<unsigned long> {bound}, true, method).front();
+}
+
+Theory::BigInteger ModelCounter::Count(const unsigned long int_bound, const unsigned long str_bound,
+                                       const Theory::SymbolicCounter::Method method) {
+  return CountInts(int_bound, method) * CountStrs(str_bound, method);
+}
+
+std::vector<Theory::BigInteger> ModelCounter::CountInts(const std::vector<unsigned long>& bounds,
+                                                        const Theory::SymbolicCounter::Method method) {
+  std::vector<Theory::BigInteger> results = CountSymbolic(bounds, false, method);
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    if (not IsConstantIntsInBound(bounds[i])) {
+      results[i] = 0;
+    }
+  }
+  return results;
+}
+
+std::vector<Theory::BigInteger> ModelCounter::CountStrs(const std::vector<unsigned long>& bounds,
+                                                        const Theory::SymbolicCounter::Method method) {
+  return CountSymbolic(bounds, true, method);
+}
+
+std::vector<Theory::BigInteger> ModelCounter::CountAll(const std::vector<unsigned long>& bounds,
+                                                       const Theory::SymbolicCounter::Method method) {
+  std::vector<Theory::BigInteger> results = CountInts(bounds, method);
+  std::vector<Theory::BigInteger> str_results = CountStrs(bounds, method);
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    results[i] = results[i] * str_results[i];
+  }
+  return results;
+}
+
+std::vector<Theory::BigInteger> ModelCounter::CountRange(const unsigned long lower_bound, const unsigned long upper_bound,
+                                                         const unsigned long step,
+                                                         const Theory::SymbolicCounter::Method method) {
+  return CountAll(GetBoundsInRange(lower_bound, upper_bound, step), method);
+}
+
+std::vector<unsigned long> ModelCounter::GetBoundsInRange(const unsigned long lower_bound,
+                                                          const unsigned long upper_bound, const unsigned long step) {
+  CHECK_GT(step, 0) << "count range step must be positive";
+  std::vector<unsigned long> bounds;
+  for (unsigned long bound = lower_bound; bound <= upper_bound; bound += step) {
+    bounds.push_back(bound);
+    if (upper_bound - bound < step) {
+      break;
+    }
+  }
+  return bounds;
+}
 
+bool ModelCounter::IsConstantIntsInBound(const unsigned long bound) const {
   for (int i : constant_ints_) {
     Theory::BigInteger value(i);
     auto shift = bound;
@@ -59,66 +119,89 @@ Theory::BigInteger ModelCounter::CountInts(const unsigned long bound) {
     }
 
     if (not (value <= upper_bound and value >= lower_bound)) {
-     return 0; // no need to compute further
-    }
-  }
-
-
-  for (Theory::SymbolicCounter& counter : symbolic_counters_) {
-    if (Theory::SymbolicCounter::Type::STRING != counter.type()) {
-      result = result * counter.Count(bound);
+      return false;
     }
   }
+  return true;
+}
 
+Theory::BigInteger ModelCounter::CountUnconstraintInts(const unsigned long bound) const {
+  Theory::BigInteger result(1);
   if (unconstraint_int_vars_ > 0) {
    if (use_signed_integers_) {
-     result = result
-            * boost::multiprecision::pow(
+     result = boost::multiprecision::pow(
                 (boost::multiprecision::pow(
                     boost::multiprecision::cpp_int(2),
                     (2 * bound)) - 1),
                 unconstraint_int_vars_);
    } else {
-     result = result
-         * boost::multiprecision::pow(boost::multiprecision::cpp_int(2),
-                                      (unconstraint_int_vars_ * bound));
+     result = boost::multiprecision::pow(boost::multiprecision::cpp_int(2),
+                                         (unconstraint_int_vars_ * bound));
    }
   }
-
   return result;
 }
 
-Theory::BigInteger ModelCounter::CountStrs(const unsigned long bound) {
+Theory::BigInteger ModelCounter::CountUnconstraintStrs(const unsigned long bound) const {
   Theory::BigInteger result(1);
-
-  for (Theory::SymbolicCounter& counter : symbolic_counters_) {
-    if (Theory::SymbolicCounter::Type::STRING == counter.type()) {
-      result = result * counter.Count(bound);
-    }
-  }
-
   if (unconstraint_str_vars_ > 0) {
   	if(count_bound_exact_) {
   		Theory::BigInteger single_unconstraint_str_count = (boost::multiprecision::pow(
 				boost::multiprecision::cpp_int(256), bound));
-			result = result
-			 * boost::multiprecision::pow(single_unconstraint_str_count,
+			result = boost::multiprecision::pow(single_unconstraint_str_count,
 																		unconstraint_str_vars_);
   	} else {
 			Theory::BigInteger single_unconstraint_str_count = (boost::multiprecision::pow(
 				boost::multiprecision::cpp_int(256), (bound + 1)) - 1)
 						/ 255;
-			result = result
-			 * boost::multiprecision::pow(single_unconstraint_str_count,
+			result = boost::multiprecision::pow(single_unconstraint_str_count,
 																		unconstraint_str_vars_);
   	}
   }
-
   return result;
 }
 
-Theory::BigInteger ModelCounter::Count(const unsigned long int_bound, const unsigned long str_bound) {
-  return CountInts(int_bound) * CountStrs(str_bound);
+/**
+ * Multiplies counts of int or string symbolic counters and of unconstraint variables for each bound.
+ * Symbolic counters belong to independent components, each one is counted on its own thread; the unconstraint
+ * variable count is one more task. Counts of each bound are multiplied with a parallel product tree.
+ */
+std::vector<Theory::BigInteger> ModelCounter::CountSymbolic(const std::vector<unsigned long>& bounds,
+                                                            const bool count_strings,
+                                                            const Theory::SymbolicCounter::Method method) {
+  std::vector<Theory::SymbolicCounter*> counters;
+  for (Theory::SymbolicCounter& counter : symbolic_counters_) {
+    if ((Theory::SymbolicCounter::Type::STRING == counter.type()) == count_strings) {
+      counters.push_back(&counter);
+    }
+  }
+
+  // last row keeps the counts of unconstraint variables
+  std::vector<std::vector<Theory::BigInteger>> counts(counters.size() + 1);
+  const std::size_t num_of_tasks = counts.size();
+  Util::ThreadPool::GetInstance().ParallelFor(0, num_of_tasks, num_of_tasks,
+                                              [&](std::size_t start, std::size_t end) -> void {
+    for (std::size_t i = start; i < end; ++i) {
+      if (i < counters.size()) {
+        counts[i] = counters[i]->CountAll(bounds, method);
+      } else {
+        for (auto bound : bounds) {
+          counts[i].push_back(count_strings ? CountUnconstraintStrs(bound) : CountUnconstraintInts(bound));
+        }
+      }
+    }
+  });
+
+  std::vector<Theory::BigInteger> results(bounds.size());
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    std::vector<Theory::BigInteger> factors;
+    factors.reserve(num_of_tasks);
+    for (auto& component_counts : counts) {
+      factors.push_back(std::move(component_counts[i]));
+    }
+    results[i] = Util::Math::multiply_all_multi_thread(std::move(factors));
+  }
+  return results;
 }
 
 std::string ModelCounter::str() const {
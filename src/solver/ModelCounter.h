@@ -18,7 +18,9 @@
 
 #include "../cereal/types/vector.hpp"
 #include "../theory/SymbolicCounter.h"
+#include "../utils/Math.h"
 #include "../utils/Serialize.h"
+#include "../utils/ThreadPool.h"
 
 namespace Vlab {
 namespace Solver {
@@ -33,13 +35,32 @@ class ModelCounter {
   void set_num_of_unconstraint_str_vars(int n);
   void add_constant(int c);
   void add_symbolic_counter(const Theory::SymbolicCounter& counter);
-  Theory::BigInteger CountInts(const unsigned long bound);
-  Theory::BigInteger CountStrs(const unsigned long bound);
-  Theory::BigInteger Count(const unsigned long int_bound, const unsigned long str_bound);
+  Theory::BigInteger CountInts(const unsigned long bound,
+                               const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  Theory::BigInteger CountStrs(const unsigned long bound,
+                               const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  Theory::BigInteger Count(const unsigned long int_bound, const unsigned long str_bound,
+                           const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+
+  /**
+   * Count sweeps, each symbolic counter walks its count vector once for all the bounds.
+   */
+  std::vector<Theory::BigInteger> CountInts(const std::vector<unsigned long>& bounds,
+                                            const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountStrs(const std::vector<unsigned long>& bounds,
+                                            const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountAll(const std::vector<unsigned long>& bounds,
+                                           const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  std::vector<Theory::BigInteger> CountRange(const unsigned long lower_bound, const unsigned long upper_bound,
+                                             const unsigned long step,
+                                             const Theory::SymbolicCounter::Method method = Theory::SymbolicCounter::Method::ITERATIVE);
+  static std::vector<unsigned long> GetBoundsInRange(const unsigned long lower_bound, const unsigned long upper_bound,
+                                                     const unsigned long step);
 
   template <class Archive>
   void save(Archive& ar) const {
     ar(use_signed_integers_);
+    ar(count_bound_exact_);
     ar(unconstraint_int_vars_);
     ar(unconstraint_str_vars_);
     ar(constant_ints_);
@@ -49,6 +70,7 @@ class ModelCounter {
   template <class Archive>
   void load(Archive& ar) {
     ar(use_signed_integers_);
+    ar(count_bound_exact_);
     ar(unconstraint_int_vars_);
     ar(unconstraint_str_vars_);
     ar(constant_ints_);
@@ -57,6 +79,12 @@ class ModelCounter {
   std::string str() const;
   friend std::ostream& operator<<(std::ostream& os, const ModelCounter& mc);
  protected:
+  bool IsConstantIntsInBound(const unsigned long bound) const;
+  Theory::BigInteger CountUnconstraintInts(const unsigned long bound) const;
+  Theory::BigInteger CountUnconstraintStrs(const unsigned long bound) const;
+  std::vector<Theory::BigInteger> CountSymbolic(const std::vector<unsigned long>& bounds, const bool count_strings,
+                                                const Theory::SymbolicCounter::Method method);
+
   bool use_signed_integers_;
   bool count_bound_exact_;
   int unconstraint_int_vars_;
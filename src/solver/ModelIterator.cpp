@@ -0,0 +1,125 @@
+/*
+ * ModelIterator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ModelIterator.h"
+
+namespace Vlab {
+namespace Solver {
+
+const int ModelIterator::VLOG_LEVEL = 12;
+
+ModelIterator::ModelIterator(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values)
+    : has_next_ {false} {
+  Initialize(variable_values, false, 0);
+}
+
+ModelIterator::ModelIterator(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values, const unsigned long bound)
+    : has_next_ {false} {
+  Initialize(variable_values, true, bound);
+}
+
+ModelIterator::~ModelIterator() {
+}
+
+void ModelIterator::Initialize(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values, const bool has_bound,
+                               const unsigned long bound) {
+  for (const auto& variable_entry : variable_values) {
+    Value_ptr value = variable_entry.second;
+    if (value == nullptr) {
+      continue;
+    }
+    Group group;
+    switch (value->getType()) {
+      case Value::Type::STRING_AUTOMATON: {
+        auto string_auto = value->getStringAutomaton();
+        if (has_bound) {
+          // accepting states of multi-track automata are reached with an extra lambda transition
+          const unsigned long length_bound = (string_auto->GetNumTracks() > 1) ? bound + 1 : bound;
+          group.enumerator.reset(new Theory::ModelEnumerator(string_auto, length_bound));
+        } else {
+          group.enumerator.reset(new Theory::ModelEnumerator(string_auto));
+        }
+        group.decode = [string_auto](const std::vector<bool>& bits) {
+          return string_auto->GetModelFromBits(bits);
+        };
+      }
+        break;
+      case Value::Type::BINARYINT_AUTOMATON: {
+        auto binary_auto = value->getBinaryIntAutomaton();
+        if (has_bound) {
+          group.enumerator.reset(new Theory::ModelEnumerator(binary_auto, bound));
+        } else {
+          group.enumerator.reset(new Theory::ModelEnumerator(binary_auto));
+        }
+        group.decode = [binary_auto](const std::vector<bool>& bits) {
+          Model model;
+          for (auto& var_entry : binary_auto->GetModelFromBits(bits)) {
+            model[var_entry.first] = var_entry.second.str();
+          }
+          return model;
+        };
+      }
+        break;
+      case Value::Type::INT_CONSTANT: {
+        group.models.push_back({{variable_entry.first->getName(), std::to_string(value->getIntConstant())}});
+      }
+        break;
+      default:
+        DVLOG(VLOG_LEVEL) << "models of " << variable_entry.first->getName() << " are not enumerated";
+        continue;
+    }
+    groups_.push_back(std::move(group));
+  }
+
+  has_next_ = not groups_.empty();
+  for (auto& group : groups_) {
+    has_next_ = has_next_ and HasModel(group, 0);
+  }
+  positions_.resize(groups_.size(), 0);
+}
+
+bool ModelIterator::HasNext() const {
+  return has_next_;
+}
+
+ModelIterator::Model ModelIterator::Next() {
+  CHECK(has_next_) << "no more models";
+  Model model;
+  for (std::size_t i = 0; i < groups_.size(); ++i) {
+    const Model& group_model = groups_[i].models[positions_[i]];
+    model.insert(group_model.begin(), group_model.end());
+  }
+
+  has_next_ = false;
+  for (std::size_t i = 0; i < groups_.size(); ++i) {
+    if (HasModel(groups_[i], positions_[i] + 1)) {
+      ++positions_[i];
+      has_next_ = true;
+      break;
+    }
+    positions_[i] = 0;
+  }
+  return model;
+}
+
+bool ModelIterator::HasModel(Group& group, const std::size_t index) {
+  while (group.models.size() <= index and group.enumerator != nullptr and group.enumerator->HasNext()) {
+    const unsigned long length = group.enumerator->get_length();
+    Model model = group.decode(group.enumerator->Next());
+    if (group.seen_models.insert(model).second) {
+      group.models.push_back(model);
+      group.last_new_model_length = length;
+    } else if (length > group.last_new_model_length + group.enumerator->get_num_of_states()) {
+      DVLOG(VLOG_LEVEL) << "no new model after length " << group.last_new_model_length << ", group is done";
+      group.enumerator.reset();
+    }
+  }
+  return index < group.models.size();
+}
+
+} /* namespace Solver */
+} /* namespace Vlab */
@@ -0,0 +1,83 @@
+/*
+ * ModelIterator.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_SOLVER_MODELITERATOR_H_
+#define SRC_SOLVER_MODELITERATOR_H_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "../smt/ast.h"
+#include "../smt/typedefs.h"
+#include "../theory/ModelEnumerator.h"
+#include "Value.h"
+
+namespace Vlab {
+namespace Solver {
+
+/**
+ * Pulls models of a solved constraint one at a time.
+ * Each group of variables enumerates its own models lazily with a ModelEnumerator, models of the groups are combined
+ * like the digits of a counter where the first group changes fastest.
+ * A group stops once more lengths than its automaton has states pass without a new model; longer words of a finite
+ * set of models only repeat them, e.g. integers with more sign bits.
+ */
+class ModelIterator {
+ public:
+  using Model = std::map<std::string, std::string>;
+
+  /**
+   * Models of any length
+   * @param variable_values value of each group of variables, values are not copied and must outlive the iterator
+   */
+  ModelIterator(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values);
+  /**
+   * @param variable_values value of each group of variables, values are not copied and must outlive the iterator
+   * @param bound length bound of strings and bit length bound of integers
+   */
+  ModelIterator(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values, const unsigned long bound);
+  virtual ~ModelIterator();
+
+  bool HasNext() const;
+  Model Next();
+
+ protected:
+  struct Group {
+    std::unique_ptr<Theory::ModelEnumerator> enumerator;
+    std::function<Model(const std::vector<bool>&)> decode;
+    std::vector<Model> models;
+    std::set<Model> seen_models;
+    unsigned long last_new_model_length = 0;
+  };
+
+  void Initialize(const std::map<SMT::Variable_ptr, Value_ptr>& variable_values, const bool has_bound,
+                  const unsigned long bound);
+
+  /**
+   * Pulls models of a group until it has a model at the index, several words may decode to the same model
+   * @return false if the group has fewer models
+   */
+  static bool HasModel(Group& group, const std::size_t index);
+
+  bool has_next_;
+  std::vector<Group> groups_;
+  std::vector<std::size_t> positions_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SRC_SOLVER_MODELITERATOR_H_ */
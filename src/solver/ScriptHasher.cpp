@@ -0,0 +1,165 @@
+/*
+ * ScriptHasher.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ScriptHasher.h"
+
+#include <algorithm>
+
+namespace Vlab {
+namespace Solver {
+
+using namespace SMT;
+
+const int ScriptHasher::VLOG_LEVEL = 17;
+
+ScriptHasher::ScriptHasher(Script_ptr script, SymbolTable_ptr symbol_table)
+    : AstTraverser(script), symbol_table_(symbol_table) {
+  setCallbacks();
+}
+
+ScriptHasher::~ScriptHasher() {
+}
+
+void ScriptHasher::start() {
+  visitScript(root_);
+  add_declarations();
+  end();
+}
+
+void ScriptHasher::end() {
+  DVLOG(VLOG_LEVEL) << "canonical script: " << canonical_form_.str();
+  DVLOG(VLOG_LEVEL) << "script key: " << get_key();
+}
+
+void ScriptHasher::setCallbacks() {
+  auto term_pre_callback = [this] (Term_ptr term) -> bool {
+    canonical_form_ << "(" << term->str();
+    switch (term->type()) {
+      case Term::Type::QUALIDENTIFIER:
+        canonical_form_ << " " << get_canonical_name(dynamic_cast<QualIdentifier_ptr>(term));
+        return false;
+      case Term::Type::TERMCONSTANT:
+        canonical_form_ << " " << dynamic_cast<TermConstant_ptr>(term)->primitive->str();
+        return false;
+      case Term::Type::INDEXOF:
+        canonical_form_ << " " << static_cast<int>(dynamic_cast<IndexOf_ptr>(term)->getMode());
+        break;
+      case Term::Type::LASTINDEXOF:
+        canonical_form_ << " " << static_cast<int>(dynamic_cast<LastIndexOf_ptr>(term)->getMode());
+        break;
+      case Term::Type::SUBSTRING:
+        canonical_form_ << " " << static_cast<int>(dynamic_cast<SubString_ptr>(term)->getMode());
+        break;
+      default:
+        break;
+    }
+    return true;
+  };
+
+  auto term_post_callback = [this] (Term_ptr term) -> bool {
+    canonical_form_ << ")";
+    return true;
+  };
+
+  auto command_pre_callback = [this] (Command_ptr command) -> bool {
+    if (Command::Type::ASSERT == command->getType()) {
+      canonical_form_ << "(" << command->str();
+      return true;
+    }
+    return false;
+  };
+
+  auto command_post_callback = [this] (Command_ptr command) -> bool {
+    if (Command::Type::ASSERT == command->getType()) {
+      canonical_form_ << ")";
+    }
+    return true;
+  };
+
+  setTermPreCallback(term_pre_callback);
+  setTermPostCallback(term_post_callback);
+  setCommandPreCallback(command_pre_callback);
+  setCommandPostCallback(command_post_callback);
+}
+
+void ScriptHasher::add_context(const std::string& context) {
+  canonical_form_ << "[" << context << "]";
+}
+
+std::string ScriptHasher::get_canonical_form() const {
+  return canonical_form_.str();
+}
+
+std::string ScriptHasher::get_key() const {
+  const std::string data = canonical_form_.str();
+  const std::string reversed_data(data.rbegin(), data.rend());
+  std::stringstream ss;
+  ss << std::hex << std::setfill('0') << std::setw(16) << Hash(data, 0xcbf29ce484222325ULL) << std::setw(16)
+     << Hash(reversed_data, 0x84222325cbf29ce4ULL);
+  return ss.str();
+}
+
+/**
+ * Variable names are replaced with their order of first occurrence, variable type is kept.
+ */
+std::string ScriptHasher::get_canonical_name(QualIdentifier_ptr qi_term) {
+  const std::string name = qi_term->getVarName();
+  auto it = canonical_names_.find(name);
+  if (it != canonical_names_.end()) {
+    return it->second;
+  }
+
+  std::stringstream ss;
+  auto variable = symbol_table_->get_variable_unsafe(name);
+  if (variable == nullptr) {
+    ss << name; // not a declared variable
+  } else {
+    ss << "v" << canonical_names_.size() << ":" << static_cast<int>(variable->getType());
+  }
+  canonical_names_[name] = ss.str();
+  return ss.str();
+}
+
+/**
+ * Unconstrained variables change the model count, every declared variable is part of the canonical form.
+ * Variables that do not occur in the assertions are listed by sort only.
+ */
+void ScriptHasher::add_declarations() {
+  std::vector<std::string> declarations;
+  std::vector<int> unused_variable_types;
+  for (auto& entry : symbol_table_->get_variables()) {
+    auto it = canonical_names_.find(entry.first);
+    if (it != canonical_names_.end()) {
+      declarations.push_back(it->second);
+    } else {
+      unused_variable_types.push_back(static_cast<int>(entry.second->getType()));
+    }
+  }
+  std::sort(declarations.begin(), declarations.end());
+  std::sort(unused_variable_types.begin(), unused_variable_types.end());
+  for (auto& declaration : declarations) {
+    canonical_form_ << "(declare " << declaration << ")";
+  }
+  for (int type : unused_variable_types) {
+    canonical_form_ << "(declare _:" << type << ")";
+  }
+}
+
+/**
+ * FNV-1a
+ */
+uint64_t ScriptHasher::Hash(const std::string& data, uint64_t seed) {
+  uint64_t hash = seed;
+  for (unsigned char c : data) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+} /* namespace Solver */
+} /* namespace Vlab */
@@ -0,0 +1,68 @@
+/*
+ * ScriptHasher.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_SOLVER_SCRIPTHASHER_H_
+#define SRC_SOLVER_SCRIPTHASHER_H_
+
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "../smt/ast.h"
+#include "../smt/typedefs.h"
+#include "AstTraverser.h"
+#include "SymbolTable.h"
+
+namespace Vlab {
+namespace Solver {
+
+/**
+ * Computes a canonical form of the asserted terms and the declared variables where variables are renamed in the order
+ * of their first occurrence, scripts that differ only in variable names have the same canonical form and the same key.
+ */
+class ScriptHasher: public AstTraverser {
+public:
+  ScriptHasher(SMT::Script_ptr, SymbolTable_ptr);
+  virtual ~ScriptHasher();
+
+  void start() override;
+  void end() override;
+
+  void setCallbacks();
+
+  /**
+   * Adds a context string (e.g. solver options) that is hashed together with the script.
+   */
+  void add_context(const std::string& context);
+  std::string get_canonical_form() const;
+
+  /**
+   * @return 128 bit hash of the canonical form as 32 hex digits
+   */
+  std::string get_key() const;
+protected:
+  std::string get_canonical_name(SMT::QualIdentifier_ptr qi_term);
+  void add_declarations();
+  static uint64_t Hash(const std::string& data, uint64_t seed);
+
+  SymbolTable_ptr symbol_table_;
+  std::stringstream canonical_form_;
+  std::map<std::string, std::string> canonical_names_;
+
+private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SRC_SOLVER_SCRIPTHASHER_H_ */
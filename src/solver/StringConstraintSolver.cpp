@@ -127,6 +127,14 @@ void StringConstraintSolver::visitAnd(And_ptr and_term) {
   Value_ptr and_value = nullptr;
 
 
+  // conjuncts of a group are intersected at once when the last of them is solved, smallest automata first
+  std::map<std::string, std::size_t> num_of_group_terms;
+  for (auto term : *(and_term->term_list)) {
+    if (string_formula_generator_.get_term_formula(term) != nullptr and (dynamic_cast<Or_ptr>(term) == nullptr)) {
+      ++num_of_group_terms[string_formula_generator_.get_term_group_name(term)];
+    }
+  }
+  std::map<std::string, std::vector<Value_ptr>> group_term_values;
   for (auto term : *(and_term->term_list)) {
     auto formula = string_formula_generator_.get_term_formula(term);
     // Do not visit child or terms here, handle them in POSTVISIT AND
@@ -149,8 +157,17 @@ void StringConstraintSolver::visitAnd(And_ptr and_term) {
 					LOG(FATAL) << "Term has no group!";
 				}
 				//LOG(INFO) << *term << "@" << term << " has " << "term group name: " << term_group_name;
-				symbol_table_->IntersectValue(term_group_name,param);
-				is_satisfiable = symbol_table_->get_value(term_group_name)->is_satisfiable();
+				auto& term_values = group_term_values[term_group_name];
+				term_values.push_back(param);
+				term_values_.erase(term);
+				if (term_values.size() == num_of_group_terms[term_group_name]) {
+					symbol_table_->IntersectValues(term_group_name, term_values);
+					is_satisfiable = symbol_table_->get_value(term_group_name)->is_satisfiable();
+					for (auto value : term_values) {
+						delete value;
+					}
+					group_term_values.erase(term_group_name);
+				}
       }
       clear_term_value(term);
       if (not is_satisfiable) {
@@ -159,6 +176,13 @@ void StringConstraintSolver::visitAnd(And_ptr and_term) {
     }
   }
 
+  // groups left incomplete by an unsatisfiable term are not intersected
+  for (auto& entry : group_term_values) {
+    for (auto value : entry.second) {
+      delete value;
+    }
+  }
+
   DVLOG(VLOG_LEVEL) << "visit children of component end: " << *and_term << "@" << and_term;
 
   DVLOG(VLOG_LEVEL) << "post visit component start: " << *and_term << "@" << and_term;
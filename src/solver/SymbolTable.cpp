@@ -92,7 +92,9 @@ void SymbolTable::add_variable(Variable_ptr variable) {
 
 Variable_ptr SymbolTable::get_variable(std::string name) {
   auto it = variables_.find(name);
-  CHECK(it != variables_.end()) << "Variable is not found: " << name;
+  if (it == variables_.end()) {
+    throw std::runtime_error("variable is not declared: " + name);
+  }
   return it->second;
 }
 
@@ -211,9 +213,13 @@ EquivalenceClass_ptr SymbolTable::get_equivalence_class_of(Variable_ptr variable
     for (auto it = scope_stack_.rbegin(); it != scope_stack_.rend(); it++) {
       auto entry = variable_equivalence_table_[(*it)].find(variable);
       if (entry != variable_equivalence_table_[(*it)].end()) {
-        // clone equiv class from parent and put it to the current scope
+        // clone equiv class from parent and put it to the current scope, its variables that are not classified in the
+        // current scope share the clone
         auto equiv_class = entry->second->clone();
-        add_variable_equiv_class_mapping(variable, equiv_class);
+        auto& current_scope_table = variable_equivalence_table_[scope_stack_.back()];
+        for (auto class_variable : equiv_class->get_variables()) {
+          current_scope_table.insert(std::make_pair(class_variable, equiv_class));
+        }
         return equiv_class;
       }
     }
@@ -451,6 +457,27 @@ bool SymbolTable::IntersectValue(Variable_ptr variable, Value_ptr value) {
   return res;
 }
 
+bool SymbolTable::IntersectValues(std::string var_name, const std::vector<Value_ptr>& values) {
+  return IntersectValues(get_variable(var_name), values);
+}
+
+/**
+ * Intersects old value of the variable with all new values in one go and sets the
+ * intersection as newest value.
+ */
+bool SymbolTable::IntersectValues(Variable_ptr variable, const std::vector<Value_ptr>& values) {
+  std::vector<Value_ptr> operands;
+  Value_ptr variable_old_value = get_value(variable);
+  if (variable_old_value not_eq nullptr) {
+    operands.push_back(variable_old_value);
+  }
+  operands.insert(operands.end(), values.begin(), values.end());
+  Value_ptr variable_new_value = Value::intersect_all(operands);
+  bool res = set_value(variable, variable_new_value);
+  delete variable_new_value;
+  return res;
+}
+
 bool SymbolTable::UnionValue(std::string var_name, Value_ptr value) {
   return UnionValue(get_variable(var_name), value);
 }
@@ -14,6 +14,7 @@
 #include <map>
 #include <set>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -53,6 +54,9 @@ public:
   void clearLetScopes();
 
   void add_variable(SMT::Variable_ptr);
+  /**
+   * @throws std::runtime_error when the script does not declare the variable
+   */
   SMT::Variable_ptr get_variable(std::string name);
   SMT::Variable_ptr get_variable(SMT::Term_ptr);
   SMT::Variable_ptr get_variable_unsafe(std::string name);
@@ -101,6 +105,8 @@ public:
   bool set_value(SMT::Variable_ptr variable, Value_ptr value);
   bool IntersectValue(std::string var_name, Value_ptr value);
   bool IntersectValue(SMT::Variable_ptr variable, Value_ptr value);
+  bool IntersectValues(std::string var_name, const std::vector<Value_ptr>& values);
+  bool IntersectValues(SMT::Variable_ptr variable, const std::vector<Value_ptr>& values);
   bool UnionValue(std::string var_name, Value_ptr value);
   bool UnionValue(SMT::Variable_ptr variable, Value_ptr value);
 
@@ -9,6 +9,7 @@
 #define SOLVER_SYNTACTICOPTIMIZER_H_
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <functional>
 #include <initializer_list>
@@ -143,7 +144,7 @@ protected:
   SMT::Script_ptr root_;
   SymbolTable_ptr symbol_table_;
   std::function<void(SMT::Term_ptr&)> callback_;
-  static unsigned name_counter;
+  static std::atomic<unsigned> name_counter;
 private:
   static const int VLOG_LEVEL;
 };
@@ -14,7 +14,10 @@ using namespace SMT;
 
 const int SyntacticProcessor::VLOG_LEVEL = 20;
 
-SyntacticProcessor::SyntacticProcessor(Script_ptr script) : AstTraverser (script) {
+SyntacticProcessor::SyntacticProcessor(Script_ptr script, bool is_asserted_dnf_lazy)
+    : AstTraverser (script),
+      asserted_and_term_ {nullptr},
+      is_asserted_dnf_lazy_ {is_asserted_dnf_lazy} {
   setCallbacks();
 }
 
@@ -69,6 +72,7 @@ void SyntacticProcessor::convertAssertsToAnd() {
 
   commands->clear();
   and_term = new And(term_list);
+  asserted_and_term_ = and_term;
   current_assert = new Assert(and_term);
   commands->push_back(current_assert);
 }
@@ -96,7 +100,8 @@ void SyntacticProcessor::visitAnd(And_ptr and_term) {
   DVLOG(VLOG_LEVEL) << "post visit start: " << *and_term << "@" << and_term;
 
   bool converted_into_dnf = false;
-	if (Option::Solver::FORCE_DNF_FORMULA) {
+  // the driver may pick the disjuncts of the assertion lazily instead
+	if (Option::Solver::FORCE_DNF_FORMULA and not (is_asserted_dnf_lazy_ and and_term == asserted_and_term_)) {
 		converted_into_dnf = CheckAndConvertToDnf(and_term);
   }
 
@@ -124,7 +129,8 @@ void SyntacticProcessor::visitAnd(And_ptr and_term) {
 		and_term->term_list->insert(and_term->term_list->end(), or_terms.begin(), or_terms.end());
 	}
 
-  DVLOG(VLOG_LEVEL) << "post visit end: " << *and_term << "@" << and_term;
+  // the conversion into dnf deletes the and term, log the term that took its place
+  DVLOG(VLOG_LEVEL) << "post visit end: " << **top() << "@" << *top();
 }
 
 /**
@@ -484,6 +490,11 @@ void SyntacticProcessor::visitLastIndexOf(LastIndexOf_ptr last_index_of_term) {
   }
 }
 
+/**
+ * Conjunctions of the product are enumerated like the digits of a counter, the last disjunction changes fastest.
+ * The first conjunction a term appears in takes the term itself and the later ones take clones of it, partial
+ * products are never built, which leaves one clone per term of the result beyond the input terms.
+ */
 bool SyntacticProcessor::CheckAndConvertToDnf(And_ptr and_term) {
   std::vector<TermList> or_term_lists;
   for (auto iter = and_term->term_list->begin(); iter != and_term->term_list->end();) {
@@ -497,60 +508,74 @@ bool SyntacticProcessor::CheckAndConvertToDnf(And_ptr and_term) {
     }
   }
 
-  if (not ( or_term_lists.empty() )) {
-    DVLOG(VLOG_LEVEL) << "Transforming into DNF: '" << *and_term << "'";
-    std::vector<TermList> cartesian = {{}};
-    for (auto& term_list_1 : or_term_lists) {
-      std::vector<TermList> sub_product;
-        for (auto& term_list_2 : cartesian) {
-            for (auto& term_1 : term_list_1) {
-                TermList term_list_2_clone;
-                for (auto& term_2 : term_list_2) {
-                  term_list_2_clone.push_back(term_2->clone());
-                }
-                sub_product.push_back(term_list_2_clone);
-                sub_product.back().push_back(term_1->clone());
-            }
-        }
-        // avoid memory leak
-        for (auto& term_list : cartesian) {
-          for (auto term : term_list) {
-            delete term; term = nullptr;
-          }
-        }
-        for (auto& term : term_list_1) {
-          delete term; term = nullptr;
-        }
-        cartesian.clear();
-        cartesian.swap(sub_product);
-    }
+  if (or_term_lists.empty()) {
+    return false;
+  }
 
-    TermList_ptr or_term_list = new TermList();
-    for (auto& term_list : cartesian) {
-      for (auto term : *and_term->term_list) {
-        term_list.push_back(term->clone());
-      }
+  DVLOG(VLOG_LEVEL) << "Transforming into DNF: '" << *and_term << "'";
+  TermList common_terms = *and_term->term_list;
+  and_term->term_list->clear();
+  delete and_term;
 
-      TermList_ptr and_term_list = new TermList();
-      for (auto term : term_list) { // Associativity
-        if (And_ptr sub_and_term = dynamic_cast<And_ptr>(term)) {
-          and_term_list->insert(and_term_list->end(), sub_and_term->term_list->begin(), sub_and_term->term_list->end());
-        } else {
-          and_term_list->push_back(term);
-        }
-      }
+  std::vector<std::vector<bool>> is_used;
+  bool has_next = true;
+  for (auto& term_list : or_term_lists) {
+    is_used.push_back(std::vector<bool>(term_list.size(), false));
+    has_next = has_next and (not term_list.empty());
+  }
+  if (not has_next) { // an empty disjunction makes the product empty
+    for (auto& term_list : or_term_lists) {
+      common_terms.insert(common_terms.end(), term_list.begin(), term_list.end());
+    }
+    for (auto term : common_terms) {
+      delete term;
+    }
+  }
+  bool is_common_used = false;
+  TermList and_shells; // flattened sub conjunctions, deleted after their last clone
+  auto add_term = [&and_shells](Term_ptr term, TermList_ptr and_term_list) {
+    if (And_ptr sub_and_term = dynamic_cast<And_ptr>(term)) { // Associativity
+      and_term_list->insert(and_term_list->end(), sub_and_term->term_list->begin(), sub_and_term->term_list->end());
+      and_shells.push_back(sub_and_term);
+    } else {
+      and_term_list->push_back(term);
+    }
+  };
 
-      or_term_list->push_back(new And(and_term_list));
+  TermList_ptr or_term_list = new TermList();
+  std::vector<std::size_t> positions(or_term_lists.size(), 0);
+  while (has_next) {
+    TermList_ptr and_term_list = new TermList();
+    for (std::size_t i = 0; i < or_term_lists.size(); ++i) {
+      Term_ptr term = or_term_lists[i][positions[i]];
+      add_term(is_used[i][positions[i]] ? term->clone() : term, and_term_list);
+      is_used[i][positions[i]] = true;
+    }
+    for (auto term : common_terms) {
+      add_term(is_common_used ? term->clone() : term, and_term_list);
     }
+    is_common_used = true;
+    or_term_list->push_back(new And(and_term_list));
+
+    has_next = false;
+    for (std::size_t i = or_term_lists.size(); i-- > 0;) {
+      if (++positions[i] < or_term_lists[i].size()) {
+        has_next = true;
+        break;
+      }
+      positions[i] = 0;
+    }
+  }
 
-    delete and_term;
-    Or_ptr or_term = new Or(or_term_list);
-    Term_ptr* reference_term = top();
-    *reference_term = or_term;
-    return true;
+  for (auto term : and_shells) {
+    dynamic_cast<And_ptr>(term)->term_list->clear();
+    delete term;
   }
 
-  return false;
+  Or_ptr or_term = new Or(or_term_list);
+  Term_ptr* reference_term = top();
+  *reference_term = or_term;
+  return true;
 }
 
 void SyntacticProcessor::check_and_convert_numeral_to_char(TermConstant_ptr term_constant) {
@@ -30,7 +30,7 @@ namespace Solver {
 
 class SyntacticProcessor: AstTraverser {
 public:
-  SyntacticProcessor(SMT::Script_ptr script);
+  SyntacticProcessor(SMT::Script_ptr script, bool is_asserted_dnf_lazy = false);
   virtual ~SyntacticProcessor();
 
   void start();
@@ -49,6 +49,12 @@ protected:
   void check_and_convert_numeral_to_char(SMT::TermConstant_ptr);
   bool term_has_bool_result(SMT::Term_ptr);
 
+  /**
+   * Conjunction of the assertions, its disjunctions are left to the driver when its DNF is explored lazily
+   */
+  SMT::And_ptr asserted_and_term_;
+  const bool is_asserted_dnf_lazy_;
+
 private:
   static const int VLOG_LEVEL;
 };
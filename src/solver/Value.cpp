@@ -247,6 +247,37 @@ Value_ptr Value::intersect(Value_ptr other_value) const {
   return intersection_value;
 }
 
+Value_ptr Value::intersect_all(const std::vector<Value_ptr>& values) {
+  CHECK(not values.empty()) << "nothing to intersect";
+  const Type type = values[0]->type;
+  bool is_same_type = true;
+  for (auto value : values) {
+    is_same_type = is_same_type and (value->type == type);
+  }
+
+  if (is_same_type and Type::STRING_AUTOMATON == type) {
+    std::vector<Theory::StringAutomaton_ptr> autos;
+    for (auto value : values) {
+      autos.push_back(value->string_automaton);
+    }
+    return new Value(Theory::StringAutomaton::Intersect(autos));
+  } else if (is_same_type and Type::BINARYINT_AUTOMATON == type) {
+    std::vector<Theory::BinaryIntAutomaton_ptr> autos;
+    for (auto value : values) {
+      autos.push_back(value->binaryint_automaton);
+    }
+    return new Value(Theory::BinaryIntAutomaton::Intersect(autos));
+  }
+
+  Value_ptr intersection_value = values[0]->clone();
+  for (std::size_t i = 1; i < values.size(); ++i) {
+    Value_ptr old_value = intersection_value;
+    intersection_value = old_value->intersect(values[i]);
+    delete old_value;
+  }
+  return intersection_value;
+}
+
 Value_ptr Value::complement() const {
   Value_ptr complement_value = nullptr;
   switch (type) {
@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <glog/logging.h>
 
@@ -72,6 +73,12 @@ class Value {
 
   Value_ptr union_(Value_ptr other_value) const;
   Value_ptr intersect(Value_ptr other_value) const;
+  /**
+   * Intersects several values at once, automata are multiplied in the order of their sizes
+   * @param values
+   * @return
+   */
+  static Value_ptr intersect_all(const std::vector<Value_ptr>& values);
   Value_ptr complement() const;
   Value_ptr difference(Value_ptr other_value) const;
 
@@ -22,8 +22,11 @@ bool Solver::ENABLE_LEN_IMPLICATIONS = true;
 bool Solver::ENABLE_SORTING_HEURISTICS = false;
 bool Solver::FORCE_DNF_FORMULA = false;
 bool Solver::COUNT_BOUND_EXACT = false;
+int Solver::NUM_OF_THREADS = 0;
+bool Solver::SATISFIABILITY_ONLY = false;
 
 std::string Solver::OUTPUT_PATH         = ".";
 std::string Solver::SCRIPT_PATH         = ".";
+std::string Solver::CACHE_PATH          = "";
 } /* namespace Option */
 } /* namespace Vlab */
@@ -34,7 +34,13 @@ enum class Name: int {
 	COUNT_BOUND_EXACT,
   REGEX_FLAG,
   OUTPUT_PATH,
-  SCRIPT_PATH
+  SCRIPT_PATH,
+  NUM_OF_THREADS,
+  CACHE_PATH,
+  AUTOMATON_CACHE_SIZE,
+  SYMBOLIC_ARITHMETIC_THRESHOLD,
+  ENABLE_SATISFIABILITY_ONLY,
+  DISABLE_SATISFIABILITY_ONLY
 };
 
 class Solver {
@@ -46,10 +52,27 @@ public:
   static bool ENABLE_IMPLICATIONS;
   static bool ENABLE_LEN_IMPLICATIONS;
   static bool ENABLE_SORTING_HEURISTICS;
+  /**
+   * The DNF of the assertion is explored one conjunction at a time, see Driver::SolveDisjunctsLazily
+   */
   static bool FORCE_DNF_FORMULA;
   static bool COUNT_BOUND_EXACT;
+  /**
+   * Threads used for counting, 0 uses all hardware threads
+   */
+  static int NUM_OF_THREADS;
+  /**
+   * Only the satisfiability of the assertions is asked, a top level disjunction stops at its first satisfiable
+   * disjunct and values of the variables are not collected. With FORCE_DNF_FORMULA the exploration of the DNF stops at
+   * its first satisfiable conjunction instead
+   */
+  static bool SATISFIABILITY_ONLY;
   static std::string OUTPUT_PATH;
   static std::string SCRIPT_PATH;
+  /**
+   * File of the persistent constraint cache, caching is disabled when empty
+   */
+  static std::string CACHE_PATH;
 };
 
 } /* namespace Option */
@@ -12,12 +12,16 @@ namespace Theory {
 
 const int Automaton::VLOG_LEVEL = 9;
 
-int Automaton::name_counter = 0;
+std::atomic<int> Automaton::name_counter {0};
 int Automaton::next_state = 0;
 
-unsigned long Automaton::next_id = 0;
+std::atomic<unsigned long> Automaton::next_id {0};
+
+std::atomic<int> Automaton::max_num_of_states_ {0};
+std::atomic<unsigned> Automaton::max_num_of_bdd_nodes_ {0};
 
 std::unordered_map<int, int*> Automaton::bdd_variable_indices;
+std::mutex Automaton::bdd_variable_indices_mutex;
 bool Automaton::count_bound_exact_;
 
 const std::string Automaton::Name::NONE = "none";
@@ -32,17 +36,22 @@ Automaton::Automaton(Automaton::Type type)
 }
 
 Automaton::Automaton(Automaton::Type type, DFA_ptr dfa, int num_of_variables)
-        : type_(type), is_counter_cached_{false}, dfa_(dfa), num_of_bdd_variables_(num_of_variables), id_(Automaton::next_id++) { }
+        : type_(type), is_counter_cached_{false}, dfa_(dfa), num_of_bdd_variables_(num_of_variables), id_(Automaton::next_id++) {
+  UpdateStatistics(dfa_);
+}
 
 Automaton::Automaton(const Automaton& other)
         : type_(other.type_), is_counter_cached_{false}, dfa_(nullptr), num_of_bdd_variables_(other.num_of_bdd_variables_), id_(Automaton::next_id++) {
+          DFAContext dfa_context;
           if (other.dfa_)
           {
             dfa_ = dfaCopy(other.dfa_);
           }
+          UpdateStatistics(dfa_);
 }
 
 Automaton::~Automaton() {
+	DFAContext dfa_context;
 	if(dfa_ != nullptr) {
 		dfaFree(dfa_);
 	}
@@ -98,6 +107,29 @@ bool Automaton::IsEmptyLanguage() const {
   return result;
 }
 
+bool Automaton::IsIntersectionEmpty(Automaton_ptr other_automaton) const {
+  if (this->num_of_bdd_variables_ != other_automaton->num_of_bdd_variables_) {
+    LOG(FATAL) << "number of variables does not match between both automaton!";
+  }
+  bool result = DFAIsIntersectionEmpty({this->dfa_, other_automaton->dfa_});
+  DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->IsIntersectionEmpty(" << other_automaton->id_ << ") " << std::boolalpha
+                    << result;
+  return result;
+}
+
+bool Automaton::IsDifferenceEmpty(Automaton_ptr other_automaton) const {
+  DFAContext dfa_context;
+  if (this->num_of_bdd_variables_ != other_automaton->num_of_bdd_variables_) {
+    LOG(FATAL) << "number of variables does not match between both automaton!";
+  }
+  dfaNegation(other_automaton->dfa_); // efficient
+  bool result = DFAIsIntersectionEmpty({this->dfa_, other_automaton->dfa_});
+  dfaNegation(other_automaton->dfa_); // restore back
+  DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->IsDifferenceEmpty(" << other_automaton->id_ << ") " << std::boolalpha
+                    << result;
+  return result;
+}
+
 bool Automaton::IsOnlyAcceptingEmptyInput() const {
   bool result = DFAIsMinimizedOnlyAcceptingEmptyInput(this->dfa_);
   DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->IsOnlyAcceptingEmptyInput() " << std::boolalpha << result;
@@ -187,6 +219,7 @@ Automaton_ptr Automaton::Difference(Automaton_ptr other_automaton) {
 }
 
 Automaton_ptr Automaton::Concat(Automaton_ptr other_automaton) {
+	DFAContext dfa_context;
 	if(this->num_of_bdd_variables_ != other_automaton->num_of_bdd_variables_) {
 		LOG(FATAL) << "number of variables does not match between both automaton!";
 	}
@@ -292,23 +325,28 @@ BigInteger Automaton::CountByMatrixMultiplication(unsigned long bound) {
   return result;
 }
 
+/**
+ * Counts with the linear recurrence of the count matrix.
+ * Count matrix is built either for exact or up to bound counting, the other one is derived from the recurrence.
+ */
 BigInteger Automaton::SymbolicCount(int bound, bool count_less_than_or_equal_to_bound) {
-  std::stringstream cmd;
-  std::string str_result;
-  std::string tmp_math_file = Option::Theory::TMP_PATH + "/math_script.m";
-  std::ofstream out_file(tmp_math_file.c_str());
-
-  generateMatrixScript(bound, out_file, count_less_than_or_equal_to_bound);
-//  generateGFScript(bound, out_file, count_less_than_or_equal_to_bound);
-  cmd << "math -script " << tmp_math_file;
-  try {
-    DVLOG(VLOG_LEVEL) << "run_cmd(`" << cmd.str() << "`)";
-    str_result = Util::Cmd::run_cmd(cmd.str());
-  } catch (std::string& e) {
-    LOG(ERROR) << e;
+  if (not is_counter_cached_) {
+    SetSymbolicCounter();
+  }
+
+  const LinearRecurrence& recurrence = counter_.GetLinearRecurrence();
+  BigInteger power = counter_.GetPower(bound);
+  BigInteger result;
+  if (count_bound_exact_ and count_less_than_or_equal_to_bound) {
+    result = recurrence.PartialSums().Evaluate(power);
+  } else if (not count_bound_exact_ and not count_less_than_or_equal_to_bound and power > 0) {
+    result = recurrence.Evaluate(power) - recurrence.Evaluate(power - 1);
+  } else {
+    result = recurrence.Evaluate(power);
   }
 
-  return BigInteger (str_result);
+  DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->SymbolicCount(" << bound << ") : " << result;
+  return result;
 }
 
 BigInteger Automaton::SymbolicCount(double bound, bool count_less_than_or_equal_to_bound) {
@@ -328,43 +366,8 @@ std::map<std::string,std::vector<std::string>> Automaton::GetModelsWithinBound(i
 //	LOG(INFO) << "bound : " << bound;
 //	LOG(INFO) << "models: " << num_models;
 
-	// compute BFS for unweighted graph (dfa)
-	std::queue<int> states_to_process;
-	std::vector<int> distances(this->dfa_->ns,INT_MAX);
-	std::set<int> final_states;
-
-	std::vector<int> shortest_accepting_path(this->dfa_->ns,INT_MAX);
-	for(int start_state = 0; start_state < this->dfa_->ns; start_state++) {
-		distances[start_state] = 0;
-		states_to_process.push(start_state);
-
-		while(not states_to_process.empty()) {
-			int s = states_to_process.front();
-			states_to_process.pop();
-			// mark final states for later
-			if(this->dfa_->f[s] == 1) {
-				final_states.insert(s);
-			}
-
-			for(auto iter : getNextStates(s)) {
-				if(distances[iter] == INT_MAX) {
-					states_to_process.push(iter);
-					distances[iter] = distances[s] + 1;
-				}
-			}
-		}
-
-		int shortest = INT_MAX;
-		for(auto final : final_states) {
-			if(distances[final] < shortest) {
-				shortest = distances[final];
-			}
-		}
-		shortest_accepting_path[start_state] = shortest;
-
-
-		distances = std::vector<int>(this->dfa_->ns,INT_MAX);
-	}
+	// one backward bfs from the accepting states gives the shortest accepted suffix of each state
+	std::vector<int> shortest_accepting_path = GetDistancesToAcceptingStates();
 
 //	for(int i = 0; i < this->dfa_->ns; i++) {
 //		LOG(INFO) << "shortest path for state " << i << " = " << shortest_accepting_path[i];
@@ -606,6 +609,35 @@ std::map<std::string,std::vector<std::string>> Automaton::GetModelsWithinBound(i
 	return variable_values;
 }
 
+std::vector<int> Automaton::GetDistancesToAcceptingStates() {
+  std::vector<std::vector<int>> previous_states(this->dfa_->ns);
+  for (int s = 0; s < this->dfa_->ns; ++s) {
+    for (int next_state : getNextStates(s)) {
+      previous_states[next_state].push_back(s);
+    }
+  }
+
+  std::vector<int> distances(this->dfa_->ns, INT_MAX);
+  std::queue<int> states_to_process;
+  for (int s = 0; s < this->dfa_->ns; ++s) {
+    if (this->dfa_->f[s] == 1) {
+      distances[s] = 0;
+      states_to_process.push(s);
+    }
+  }
+  while (not states_to_process.empty()) {
+    int s = states_to_process.front();
+    states_to_process.pop();
+    for (int previous_state : previous_states[s]) {
+      if (distances[previous_state] == INT_MAX) {
+        distances[previous_state] = distances[s] + 1;
+        states_to_process.push(previous_state);
+      }
+    }
+  }
+  return distances;
+}
+
 void Automaton::SetCountBoundExact(bool value) {
 	count_bound_exact_ = value;
 }
@@ -828,6 +860,7 @@ bool Automaton::getAnAcceptingWord(NextState& state, std::map<int, bool>& is_sta
 }
 
 char* Automaton::getAnExample(bool accepting) {
+  DFAContext dfa_context;
   return dfaMakeExample(this->dfa_, 1, num_of_bdd_variables_, (unsigned*)GetBddVariableIndices(num_of_bdd_variables_));
 }
 
@@ -836,6 +869,7 @@ std::ostream& operator<<(std::ostream& os, const Automaton& automaton) {
 }
 
 void Automaton::CleanUp() {
+	std::lock_guard<std::mutex> lock(bdd_variable_indices_mutex);
 	for(auto &it : bdd_variable_indices) {
 		delete[] it.second;
 		it.second = nullptr;
@@ -843,20 +877,177 @@ void Automaton::CleanUp() {
 	bdd_variable_indices.clear();
 }
 
+int Automaton::GetMaxNumOfStates() {
+  return max_num_of_states_.load();
+}
+
+unsigned Automaton::GetMaxNumOfBddNodes() {
+  return max_num_of_bdd_nodes_.load();
+}
+
+void Automaton::ResetStatistics() {
+  max_num_of_states_ = 0;
+  max_num_of_bdd_nodes_ = 0;
+}
+
+void Automaton::UpdateStatistics(const DFA_ptr dfa) {
+  if (dfa == nullptr) {
+    return;
+  }
+  int num_of_states = max_num_of_states_.load();
+  while (dfa->ns > num_of_states and not max_num_of_states_.compare_exchange_weak(num_of_states, dfa->ns)) {
+  }
+  const unsigned num_of_bdd_nodes = bdd_size(dfa->bddm);
+  unsigned max_num_of_bdd_nodes = max_num_of_bdd_nodes_.load();
+  while (num_of_bdd_nodes > max_num_of_bdd_nodes
+      and not max_num_of_bdd_nodes_.compare_exchange_weak(max_num_of_bdd_nodes, num_of_bdd_nodes)) {
+  }
+}
+
 bool Automaton::DFAIsMinimizedEmtpy(const DFA_ptr minimized_dfa) {
     return (minimized_dfa->ns == 1 && minimized_dfa->f[minimized_dfa->s] == -1)? true : false;
 }
 
-// TODO implement general is empty function
 bool Automaton::DFAIsEmpty(const DFA_ptr dfa) {
-  bool result = false;
-  for (int s = 0; s < dfa->ns; ++s) {
-    if (DFAIsAcceptingState(dfa, s)) {
-      // check if the accepting state is reachable
-      LOG(FATAL) << "Not implemented";
+  return DFAIsIntersectionEmpty({dfa});
+}
+
+bool Automaton::DFAIsIntersectionEmpty(const std::vector<DFA_ptr>& dfas) {
+  DFAContext dfa_context;
+  const std::size_t num_of_dfas = dfas.size();
+  unsigned l, r, index; // BDD traversal variables
+
+  // states that can reach an accepting state, computed backwards over the successors
+  std::vector<std::vector<bool>> is_live_state (num_of_dfas);
+  for (std::size_t i = 0; i < num_of_dfas; ++i) {
+    DFA_ptr dfa = dfas[i];
+    std::vector<std::vector<int>> predecessors (dfa->ns);
+    std::stack<int> live_states;
+    is_live_state[i].resize(dfa->ns, false);
+    for (int s = 0; s < dfa->ns; ++s) {
+      if (DFAIsAcceptingState(dfa, s)) {
+        is_live_state[i][s] = true;
+        live_states.push(s);
+      }
+      std::stack<unsigned> nodes;
+      std::set<unsigned> next_states;
+      std::unordered_set<unsigned> visited_nodes;
+      nodes.push(dfa->q[s]);
+      while (not nodes.empty()) {
+        const unsigned node = nodes.top();
+        nodes.pop();
+        if (not visited_nodes.insert(node).second) {
+          continue;
+        }
+        LOAD_lri(&dfa->bddm->node_table[node], l, r, index);
+        if (index == BDD_LEAF_INDEX) {
+          next_states.insert(l);
+        } else {
+          nodes.push(l);
+          nodes.push(r);
+        }
+      }
+      for (unsigned next_state : next_states) {
+        predecessors[next_state].push_back(s);
+      }
+    }
+    while (not live_states.empty()) {
+      const int s = live_states.top();
+      live_states.pop();
+      for (int p : predecessors[s]) {
+        if (not is_live_state[i][p]) {
+          is_live_state[i][p] = true;
+          live_states.push(p);
+        }
+      }
+    }
+    if (not is_live_state[i][dfa->s]) {
+      return true;
     }
   }
-  return result;
+
+  auto is_live = [&is_live_state, num_of_dfas](const std::vector<int>& tuple) {
+    for (std::size_t i = 0; i < num_of_dfas; ++i) {
+      if (not is_live_state[i][tuple[i]]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  auto is_accepting = [&dfas, num_of_dfas](const std::vector<int>& tuple) {
+    for (std::size_t i = 0; i < num_of_dfas; ++i) {
+      if (not DFAIsAcceptingState(dfas[i], tuple[i])) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<int> initial_tuple (num_of_dfas);
+  for (std::size_t i = 0; i < num_of_dfas; ++i) {
+    initial_tuple[i] = dfas[i]->s;
+  }
+  if (is_accepting(initial_tuple)) {
+    return false;
+  }
+
+  std::set<std::vector<int>> visited {initial_tuple};
+  std::queue<std::vector<int>> worklist;
+  worklist.push(initial_tuple);
+  bool is_accepting_tuple_reached = false;
+
+  // a tuple of bdd nodes leads to the same successors wherever it is reached, shared sub-bdds are walked once
+  std::set<std::vector<unsigned>> expanded_nodes;
+
+  // walks the transition bdds of all dfas together, branching on the smallest variable index first
+  std::function<void(std::vector<unsigned>&)> expand = [&](std::vector<unsigned>& nodes) {
+    if (not expanded_nodes.insert(nodes).second) {
+      return;
+    }
+    unsigned min_index = BDD_LEAF_INDEX;
+    for (std::size_t i = 0; i < num_of_dfas; ++i) {
+      index = bdd_ifindex(dfas[i]->bddm, nodes[i]);
+      if (index != BDD_LEAF_INDEX and (min_index == BDD_LEAF_INDEX or index < min_index)) {
+        min_index = index;
+      }
+    }
+
+    if (min_index == BDD_LEAF_INDEX) {
+      std::vector<int> next_tuple (num_of_dfas);
+      for (std::size_t i = 0; i < num_of_dfas; ++i) {
+        next_tuple[i] = bdd_leaf_value(dfas[i]->bddm, nodes[i]);
+      }
+      if (is_live(next_tuple) and visited.insert(next_tuple).second) {
+        is_accepting_tuple_reached = is_accepting(next_tuple);
+        worklist.push(next_tuple);
+      }
+      return;
+    }
+
+    for (int branch = 0; branch < 2 and not is_accepting_tuple_reached; ++branch) {
+      std::vector<unsigned> next_nodes (nodes);
+      for (std::size_t i = 0; i < num_of_dfas; ++i) {
+        if (bdd_ifindex(dfas[i]->bddm, nodes[i]) == min_index) {
+          next_nodes[i] = (branch == 0) ? bdd_else(dfas[i]->bddm, nodes[i]) : bdd_then(dfas[i]->bddm, nodes[i]);
+        }
+      }
+      expand(next_nodes);
+    }
+  };
+
+  while (not worklist.empty() and not is_accepting_tuple_reached) {
+    std::vector<int> tuple = worklist.front();
+    worklist.pop();
+    std::vector<unsigned> nodes (num_of_dfas);
+    for (std::size_t i = 0; i < num_of_dfas; ++i) {
+      nodes[i] = dfas[i]->q[tuple[i]];
+    }
+    expand(nodes);
+  }
+
+  DVLOG(VLOG_LEVEL) << "product explored " << visited.size() << " tuples, " << expanded_nodes.size()
+                    << " node tuples, " << std::boolalpha << is_accepting_tuple_reached;
+  return not is_accepting_tuple_reached;
 }
 
 bool Automaton::DFAIsMinimizedOnlyAcceptingEmptyInput(const DFA_ptr minimized_dfa) {
@@ -910,6 +1101,7 @@ bool Automaton::DFAIsOneStepAway(const DFA_ptr dfa, const int from_state, const
 }
 
 bool Automaton::DFAIsEqual(const DFA_ptr dfa1, const DFA_ptr dfa2) {
+  DFAContext dfa_context;
   DFA_ptr impl_1 = dfaProduct(dfa1, dfa2, dfaIMPL);
   DFA_ptr impl_2 = dfaProduct(dfa2, dfa1, dfaIMPL);
   DFA_ptr result_dfa = dfaProduct(impl_1,impl_2,dfaAND);
@@ -937,6 +1129,7 @@ int Automaton::DFAGetSinkState(const DFA_ptr dfa) {
 }
 
 DFA_ptr Automaton::DFAMakePhi(const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   char statuses[1] {'-'};
   dfaSetup(1, number_of_bdd_variables, GetBddVariableIndices(number_of_bdd_variables));
   dfaAllocExceptions(0);
@@ -949,6 +1142,7 @@ DFA_ptr Automaton::DFAMakePhi(const int number_of_bdd_variables) {
  * @returns a dfa that accepts any input including an accepting initial state
  */
 DFA_ptr Automaton::DFAMakeAny(const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   char statuses[1] {'+'};
   dfaSetup(1, number_of_bdd_variables, GetBddVariableIndices(number_of_bdd_variables));
   dfaAllocExceptions(0);
@@ -961,6 +1155,7 @@ DFA_ptr Automaton::DFAMakeAny(const int number_of_bdd_variables) {
  * @returns a dfa that accepts any input except initial state is not accepting
  */
 DFA_ptr Automaton::DFAMakeAnyButNotEmpty(const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   char statuses[2] { '-', '+' };
   dfaSetup(2, number_of_bdd_variables, GetBddVariableIndices(number_of_bdd_variables));
   dfaAllocExceptions(0);
@@ -971,6 +1166,7 @@ DFA_ptr Automaton::DFAMakeAnyButNotEmpty(const int number_of_bdd_variables) {
 }
 
 DFA_ptr Automaton::DFAMakeEmpty(const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   char statuses[2] { '+', '-' };
   dfaSetup(2, number_of_bdd_variables, GetBddVariableIndices(number_of_bdd_variables));
   dfaAllocExceptions(0);
@@ -981,26 +1177,87 @@ DFA_ptr Automaton::DFAMakeEmpty(const int number_of_bdd_variables) {
 }
 
 DFA_ptr Automaton::DFAComplement(const DFA_ptr dfa) {
+  DFAContext dfa_context;
   DFA_ptr complement_dfa = dfaCopy(dfa);
   dfaNegation(complement_dfa);
   return complement_dfa;
 }
 
 DFA_ptr Automaton::DFAUnion(const DFA_ptr dfa1, const DFA_ptr dfa2) {
-  DFA_ptr union_dfa = dfaProduct(dfa1, dfa2, dfaOR);
-  DFA_ptr minimized_dfa = dfaMinimize(union_dfa);
-  dfaFree(union_dfa);
-  return minimized_dfa;
+  DFAContext dfa_context;
+  return AutomatonCache::GetInstance().Apply(AutomatonCache::Operation::UNION, dfa1, dfa2, 0, [dfa1, dfa2]() {
+    DFA_ptr union_dfa = dfaProduct(dfa1, dfa2, dfaOR);
+    DFA_ptr minimized_dfa = dfaMinimize(union_dfa);
+    dfaFree(union_dfa);
+    return minimized_dfa;
+  });
 }
 
 DFA_ptr Automaton::DFAIntersect(const DFA_ptr dfa1, const DFA_ptr dfa2) {
-  DFA_ptr intersect_dfa = dfaProduct(dfa1, dfa2, dfaAND);
-  DFA_ptr minimized_dfa = dfaMinimize(intersect_dfa);
-  dfaFree(intersect_dfa);
-  return minimized_dfa;
+  DFAContext dfa_context;
+  return AutomatonCache::GetInstance().Apply(AutomatonCache::Operation::INTERSECT, dfa1, dfa2, 0, [dfa1, dfa2]() {
+    DFA_ptr intersect_dfa = dfaProduct(dfa1, dfa2, dfaAND);
+    DFA_ptr minimized_dfa = dfaMinimize(intersect_dfa);
+    dfaFree(intersect_dfa);
+    return minimized_dfa;
+  });
+}
+
+DFA_ptr Automaton::DFAIntersect(const std::vector<DFA_ptr>& dfas) {
+  DFAContext dfa_context;
+  CHECK(not dfas.empty()) << "nothing to intersect";
+  for (auto dfa : dfas) {
+    if (DFAIsMinimizedEmtpy(dfa)) {
+      return dfaCopy(dfa);
+    }
+  }
+  if (dfas.size() == 1) {
+    return dfaCopy(dfas[0]);
+  }
+
+  struct Operand {
+    std::size_t size;
+    DFA_ptr dfa;
+    bool is_intermediate;
+  };
+  auto is_larger = [](const Operand& operand1, const Operand& operand2) {
+    return operand1.size > operand2.size;
+  };
+  std::priority_queue<Operand, std::vector<Operand>, decltype(is_larger)> operands (is_larger);
+  for (auto dfa : dfas) {
+    operands.push({AutomatonCache::GetSize(dfa), dfa, false});
+  }
+
+  while (operands.size() > 1) {
+    Operand operand1 = operands.top();
+    operands.pop();
+    Operand operand2 = operands.top();
+    operands.pop();
+    DFA_ptr intersect_dfa = DFAIntersect(operand1.dfa, operand2.dfa);
+    DVLOG(VLOG_LEVEL) << "intersect " << operand1.dfa->ns << " x " << operand2.dfa->ns << " states -> "
+                      << intersect_dfa->ns;
+    if (operand1.is_intermediate) {
+      dfaFree(operand1.dfa);
+    }
+    if (operand2.is_intermediate) {
+      dfaFree(operand2.dfa);
+    }
+    if (DFAIsMinimizedEmtpy(intersect_dfa)) {
+      while (not operands.empty()) {
+        if (operands.top().is_intermediate) {
+          dfaFree(operands.top().dfa);
+        }
+        operands.pop();
+      }
+      return intersect_dfa;
+    }
+    operands.push({AutomatonCache::GetSize(intersect_dfa), intersect_dfa, true});
+  }
+  return operands.top().dfa;
 }
 
 DFA_ptr Automaton::DFADifference(const DFA_ptr dfa1, DFA_ptr dfa2) {
+  DFAContext dfa_context;
   dfaNegation(dfa2); // efficient
   DFA_ptr difference_dfa = Automaton::DFAIntersect(dfa1, dfa2);
   dfaNegation(dfa2); // restore back
@@ -1008,6 +1265,7 @@ DFA_ptr Automaton::DFADifference(const DFA_ptr dfa1, DFA_ptr dfa2) {
 }
 
 DFA_ptr Automaton::DFAProjectAway(const DFA_ptr dfa, const int index) {
+  DFAContext dfa_context;
   DFA_ptr projected_dfa = dfaProject(dfa, (unsigned)index);
   DFA_ptr minimized_dfa = dfaMinimize(projected_dfa);
   dfaFree(projected_dfa);
@@ -1015,22 +1273,173 @@ DFA_ptr Automaton::DFAProjectAway(const DFA_ptr dfa, const int index) {
 }
 
 DFA_ptr Automaton::DFAProjectAway(const DFA_ptr dfa, std::vector<int> map, const std::vector<int> indices) {
-	DFA_ptr temp,result_dfa = dfa;
-	int flag = 0;
+  return Automaton::DFAProjectAway(dfa, map.size(), indices, &map[0]);
+}
 
-	for(auto index : indices) {
-		temp = dfaProject(result_dfa,(unsigned)index);
-		if(flag)
-			dfaFree(result_dfa);
-		result_dfa = dfaMinimize(temp);
-		flag = 1;
-		dfaFree(temp);
-	}
-	dfaReplaceIndices(result_dfa,&map[0]);
-	return result_dfa;
+DFA_ptr Automaton::DFAProjectAway(const DFA_ptr dfa, const int number_of_bdd_variables, const std::vector<int>& indices,
+                                  const int* indices_map) {
+  DFAContext dfa_context;
+  std::vector<bool> is_projected (number_of_bdd_variables, false);
+  for (auto index : indices) {
+    CHECK(index >= 0 and index < number_of_bdd_variables) << "invalid bdd variable index: " << index;
+    is_projected[index] = true;
+  }
+  auto get_new_index = [indices_map](const int index) -> int {
+    return indices_map == nullptr ? index : indices_map[index];
+  };
+  // bdds of the result are built in the variable order of the given dfa, the renaming has to keep that order
+  int last_new_index = -1;
+  for (int i = 0; i < number_of_bdd_variables; ++i) {
+    if (not is_projected[i]) {
+      CHECK_LT(last_new_index, get_new_index(i)) << "index map does not preserve the bdd variable order";
+      last_new_index = get_new_index(i);
+    }
+  }
+
+  std::map<std::vector<int>, int> subset_ids;
+  std::vector<std::vector<int>> subsets;
+  auto get_subset_id = [&subset_ids, &subsets](std::vector<int>& subset) -> int {
+    std::sort(subset.begin(), subset.end());
+    subset.erase(std::unique(subset.begin(), subset.end()), subset.end());
+    auto it = subset_ids.find(subset);
+    if (it != subset_ids.end()) {
+      return it->second;
+    }
+    const int id = subsets.size();
+    subset_ids[subset] = id;
+    subsets.push_back(subset);
+    return id;
+  };
+
+  // quantified bdds are hash-consed here first, the number of subsets has to be known before the result dfa is made
+  using ProjectedNode = std::tuple<int, int, int>;  // (new index, low, high), a leaf is (-1, subset id, subset id)
+  std::map<ProjectedNode, int> projected_node_ids;
+  std::vector<ProjectedNode> projected_nodes;
+  auto get_projected_node_id = [&projected_node_ids, &projected_nodes](const ProjectedNode& node) -> int {
+    auto it = projected_node_ids.find(node);
+    if (it != projected_node_ids.end()) {
+      return it->second;
+    }
+    const int id = projected_nodes.size();
+    projected_node_ids[node] = id;
+    projected_nodes.push_back(node);
+    return id;
+  };
+
+  // existentially quantifies the projected variables over the disjunction of the given bdd nodes
+  bdd_manager* bddm = dfa->bddm;
+  std::map<std::vector<bdd_ptr>, int> quantified;
+  std::function<int(const std::vector<bdd_ptr>&)> quantify;
+  quantify = [&](const std::vector<bdd_ptr>& nodes) -> int {
+    // a node testing a projected variable stands for both of its children
+    std::set<bdd_ptr> remaining_nodes;
+    std::set<bdd_ptr> visited (nodes.begin(), nodes.end());
+    std::vector<bdd_ptr> worklist (nodes.begin(), nodes.end());
+    while (not worklist.empty()) {
+      bdd_ptr node = worklist.back();
+      worklist.pop_back();
+      if (not bdd_is_leaf(bddm, node) and bdd_ifindex(bddm, node) < (unsigned)number_of_bdd_variables
+          and is_projected[bdd_ifindex(bddm, node)]) {
+        for (bdd_ptr child : {bdd_else(bddm, node), bdd_then(bddm, node)}) {
+          if (visited.insert(child).second) {
+            worklist.push_back(child);
+          }
+        }
+      } else {
+        remaining_nodes.insert(node);
+      }
+    }
+
+    std::vector<bdd_ptr> key (remaining_nodes.begin(), remaining_nodes.end());
+    auto it = quantified.find(key);
+    if (it != quantified.end()) {
+      return it->second;
+    }
+
+    unsigned split_index = UINT_MAX;
+    for (auto node : key) {
+      if (not bdd_is_leaf(bddm, node)) {
+        split_index = std::min(split_index, bdd_ifindex(bddm, node));
+      }
+    }
+
+    int node_id = -1;
+    if (split_index == UINT_MAX) {
+      std::vector<int> targets;
+      for (auto node : key) {
+        targets.push_back(bdd_leaf_value(bddm, node));
+      }
+      const int subset_id = get_subset_id(targets);
+      node_id = get_projected_node_id(std::make_tuple(-1, subset_id, subset_id));
+    } else {
+      std::vector<bdd_ptr> low_nodes, high_nodes;
+      for (auto node : key) {
+        if (not bdd_is_leaf(bddm, node) and bdd_ifindex(bddm, node) == split_index) {
+          low_nodes.push_back(bdd_else(bddm, node));
+          high_nodes.push_back(bdd_then(bddm, node));
+        } else {
+          low_nodes.push_back(node);
+          high_nodes.push_back(node);
+        }
+      }
+      const int low = quantify(low_nodes);
+      const int high = quantify(high_nodes);
+      node_id = low;
+      if (low != high) {
+        node_id = get_projected_node_id(std::make_tuple(get_new_index(split_index), low, high));
+      }
+    }
+    quantified[key] = node_id;
+    return node_id;
+  };
+
+  std::vector<int> start_subset {dfa->s};
+  get_subset_id(start_subset);
+  std::vector<int> subset_roots;
+  for (std::size_t id = 0; id < subsets.size(); ++id) {
+    std::vector<bdd_ptr> roots;
+    for (auto state : subsets[id]) {
+      roots.push_back(dfa->q[state]);
+    }
+    subset_roots.push_back(quantify(roots));
+  }
+
+  const int number_of_states = subsets.size();
+  unsigned max_states_allowed = 0x80000000;
+  unsigned mona_check = 8 * number_of_states;
+  CHECK_LE(mona_check, max_states_allowed);  // otherwise, MONA infinite loops
+
+  DFA_ptr projected_dfa = dfaMake(number_of_states);
+  projected_dfa->s = 0;
+  // children always have smaller ids than their parents, nodes are emitted in id order
+  std::vector<bdd_ptr> emitted_nodes (projected_nodes.size());
+  for (std::size_t id = 0; id < projected_nodes.size(); ++id) {
+    const ProjectedNode& node = projected_nodes[id];
+    if (std::get<0>(node) == -1) {
+      emitted_nodes[id] = bdd_find_leaf_hashed_add_root(projected_dfa->bddm, std::get<1>(node));
+    } else {
+      emitted_nodes[id] = bdd_find_node_hashed_add_root(projected_dfa->bddm, emitted_nodes[std::get<1>(node)],
+                                                        emitted_nodes[std::get<2>(node)], std::get<0>(node));
+    }
+  }
+  for (int i = 0; i < number_of_states; ++i) {
+    projected_dfa->q[i] = emitted_nodes[subset_roots[i]];
+    projected_dfa->f[i] = -1;
+    for (auto state : subsets[i]) {
+      if (DFAIsAcceptingState(dfa, state)) {
+        projected_dfa->f[i] = 1;
+        break;
+      }
+    }
+  }
+
+  DFA_ptr minimized_dfa = dfaMinimize(projected_dfa);
+  dfaFree(projected_dfa);
+  return minimized_dfa;
 }
 
 DFA_ptr Automaton::DFAProjectAwayAndReMap(const DFA_ptr dfa, const int number_of_bdd_variables, const int index) {
+  DFAContext dfa_context;
   DFA_ptr projected_dfa = dfaProject(dfa, (unsigned)index);
   if (index < (unsigned)(number_of_bdd_variables - 1)) {
     int* indices_map = new int[number_of_bdd_variables];
@@ -1050,24 +1459,32 @@ DFA_ptr Automaton::DFAProjectAwayAndReMap(const DFA_ptr dfa, const int number_of
 }
 
 DFA_ptr Automaton::DFAProjectTo(const DFA_ptr dfa, const int number_of_bdd_variables, const int index) {
-  DFA_ptr projected_dfa = dfaCopy(dfa);
-  for (int i = 0 ; i < number_of_bdd_variables; ++i) {
-    if (i != index) {
-      DFA_ptr tmp_dfa = projected_dfa;
-      projected_dfa = Automaton::DFAProjectAway(tmp_dfa, i);
-      dfaFree(tmp_dfa);
-    }
+  return Automaton::DFAProjectTo(dfa, number_of_bdd_variables, std::vector<int> {index});
+}
+
+DFA_ptr Automaton::DFAProjectTo(const DFA_ptr dfa, const int number_of_bdd_variables, const std::vector<int> indices) {
+  std::vector<bool> is_kept (number_of_bdd_variables, false);
+  for (auto index : indices) {
+    is_kept[index] = true;
   }
 
+  std::vector<int> projected_indices;
   int* indices_map = CreateBddVariableIndices(number_of_bdd_variables);
-  indices_map[index] = 0;
-  indices_map[0] = index;
-  dfaReplaceIndices(projected_dfa, indices_map);
+  for (int i = 0, j = 0; i < number_of_bdd_variables; ++i) {
+    if (is_kept[i]) {
+      indices_map[i] = j++;
+    } else {
+      projected_indices.push_back(i);
+    }
+  }
+
+  DFA_ptr projected_dfa = Automaton::DFAProjectAway(dfa, number_of_bdd_variables, projected_indices, indices_map);
   delete[] indices_map;
   return projected_dfa;
 }
 
 DFA_ptr Automaton::DFAMakeAcceptingAnyWithInRange(const int start, const int end, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   CHECK((start >= 0) && (end >= start));
   // 1 initial state and 1 sink state
   const int number_of_states = end + 2;
@@ -1097,6 +1514,7 @@ DFA_ptr Automaton::DFAMakeAcceptingAnyWithInRange(const int start, const int end
 }
 
 DFA_ptr Automaton::DFAMakeAcceptingAnyAfterLength(const int length, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   CHECK(length >= 0);
   // 1 initial state
   const int number_of_states = length + 1;
@@ -1121,6 +1539,7 @@ DFA_ptr Automaton::DFAMakeAcceptingAnyAfterLength(const int length, const int nu
 }
 
 std::set<std::string> Automaton::DFAGetTransitionsFromTo(DFA_ptr dfa, const int from, const int to, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   const int* bdd_indices = GetBddVariableIndices(number_of_bdd_variables);
   std::set<std::string> transitions;
   paths pp = make_paths(dfa->bddm, dfa->q[from]);
@@ -1149,6 +1568,14 @@ std::set<std::string> Automaton::DFAGetTransitionsFromTo(DFA_ptr dfa, const int
 }
 
 DFA_ptr Automaton::DFAConcat(const DFA_ptr dfa1, const DFA_ptr dfa2, const int number_of_bdd_variables) {
+  return AutomatonCache::GetInstance().Apply(AutomatonCache::Operation::CONCAT, dfa1, dfa2, number_of_bdd_variables,
+                                             [dfa1, dfa2, number_of_bdd_variables]() {
+    return ComputeDFAConcat(dfa1, dfa2, number_of_bdd_variables);
+  });
+}
+
+DFA_ptr Automaton::ComputeDFAConcat(const DFA_ptr dfa1, const DFA_ptr dfa2, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   //LOG(FATAL) << "I'm broken, fix me! Use StringAutomaton::concat instead";
 
 	if (DFAIsMinimizedEmtpy(dfa1) or DFAIsMinimizedEmtpy(dfa2)) {
@@ -1434,6 +1861,7 @@ DFA_ptr Automaton::DFAConcat(const DFA_ptr dfa1, const DFA_ptr dfa2, const int n
 }
 
 int* Automaton::GetBddVariableIndices(const int number_of_bdd_variables) {
+  std::lock_guard<std::mutex> lock(bdd_variable_indices_mutex);
   auto it = bdd_variable_indices.find(number_of_bdd_variables);
   if (it != bdd_variable_indices.end())
   {
@@ -1530,6 +1958,7 @@ std::vector<char> Automaton::getReservedWord(char last_char, int length, bool ex
 }
 
 void Automaton::Minimize() {
+  DFAContext dfa_context;
   DFA_ptr tmp = this->dfa_;
   this->dfa_ = dfaMinimize(tmp);
   dfaFree(tmp);
@@ -1537,6 +1966,7 @@ void Automaton::Minimize() {
 }
 
 void Automaton::ProjectAway(unsigned index) {
+  DFAContext dfa_context;
   DFA_ptr tmp = this->dfa_;
   this->dfa_ = dfaProject(tmp, index);
   dfaFree(tmp);
@@ -1573,6 +2003,7 @@ bool Automaton::hasIncomingTransition(int state) {
  * @returns true if a start state is reachable from an accepting state, false otherwise
  */
 bool Automaton::TEMPisStartStateReachableFromAnAcceptingState(DFA_ptr dfa) {
+  DFAContext dfa_context;
   paths state_paths, pp;
   for (int i = 0; i < dfa->ns; i++) {
     if (DFAIsAcceptingState(dfa,i)) {
@@ -1687,12 +2118,16 @@ std::set<int> Automaton::getNextStates(int state) {
   unsigned p, l, r, index; // BDD traversal variables
   std::set<int> next_states;
   std::stack<unsigned> nodes;
+  std::set<unsigned> visited; // bdd nodes are shared, each is expanded once
 
   p = this->dfa_->q[state];
   nodes.push(p);
   while (not nodes.empty()) {
     p = nodes.top();
     nodes.pop();
+    if (not visited.insert(p).second) {
+      continue;
+    }
     LOAD_lri(&this->dfa_->bddm->node_table[p], l, r, index);
     if (index == BDD_LEAF_INDEX) {
       next_states.insert(l);
@@ -1864,129 +2299,6 @@ void Automaton::decide_counting_schema(Eigen::SparseMatrix<BigInteger>& count_ma
   }
 }
 
-void Automaton::generateGFScript(int bound, std::ostream& out, bool count_less_than_or_equal_to_bound) {
-  LOG(FATAL) << "Refactor me with CountMatrix or add SparseCountMatrix";
-//  AdjacencyList adjacency_count_list = getAdjacencyCountList();
-//  unsigned node_size = adjacency_count_list.size();
-//  unsigned updated_node_size = node_size + 1;
-//  adjacency_count_list.resize(updated_node_size);
-//
-//  Node artificial;
-//
-//  // add a self-loop if we count up to bound (bound inclusive)
-//  if (count_less_than_or_equal_to_bound) {
-//    artificial.first = node_size;
-//    artificial.second = 1;
-//    adjacency_count_list[node_size].push_back(artificial);
-//  }
-//
-//  for (int i = 0; (unsigned)i < node_size; i++) {
-//    if (is_accepting_state(i)) {
-//      artificial.first = i;
-//      artificial.second = 1;
-//      adjacency_count_list[node_size].push_back(artificial);
-//    }
-//  }
-//
-//  out << "bound = " << bound + 2 << ";\n";
-//  out << "ID = IdentityMatrix[" << updated_node_size << "];\n\n";
-//  out << "A = SparseArray[ { ";
-//  std::string row_seperator = "";
-//  std::string col_seperator = "";
-//  int c = 0;
-//  for (auto& transitions : adjacency_count_list) {
-//    out << row_seperator;
-//    row_seperator = "";
-//    col_seperator = "";
-//    for(auto& node : transitions) {
-//      out << col_seperator;
-//      out << "{" << node.first + 1 << ", " << c + 1 << "} -> " << node.second;
-//      col_seperator = ", ";
-//      row_seperator = ", ";
-//    }
-//    c++;
-//  }
-//  out << "}];\n\n";
-//  out << "X = ID - A t;\n\n";
-//  out << "Xsubmatrix = X[[ {";
-//  std::string seperator = "";
-//  for(unsigned i = 1; i < updated_node_size; i++) {
-//    out << seperator << i;
-//    seperator = ",";
-//  }
-//  out << "},{";
-//  for(unsigned i = 1; i < updated_node_size - 1; i++){
-//    out << i << ",";
-//  }
-//
-//  out << updated_node_size << "}";
-//
-//  out << "]];\n";
-//
-//  out << "b = CoefficientList[-Det[Xsubmatrix],t];\n";
-//  out << "c = CoefficientList[Det[X],t];\n";
-//  out << "maxLen = Max[Map[Length, {b,c}]]\n";
-//  out << "bPadLen = Max[0, maxLen - Length[b]];\n";
-//  out << "cPadLen = Max[0, maxLen - Length[c]];\n";
-//  out << "b = ArrayPad[b, {0, bPadLen}];\n";
-//  out << "c = ArrayPad[c, {0, cPadLen}];\n";
-//  out << "p = -c[[ Range[2,maxLen] ]] / c[[1]];\n";
-//  out << "a = Table[0,{maxLen}];\n";
-//  out << "a[[1]] = b[[1]]/c[[1]];\n";
-//  out << "For[ i = 2, i <= maxLen, i++, a[[i]] = (b[[i]] - Total[c[[2;;i]]*a[[i-1;;1;;-1]]]) / c[[1]] ];\n";
-//  out << "numPaths = LinearRecurrence[p,a,{bound,bound}][[1]];\n";
-//  out << "Print[N[numPaths]];";
-//
-//  out << std::endl;
-}
-
-void Automaton::generateMatrixScript(int bound, std::ostream& out, bool count_less_than_or_equal_to_bound) {
-  LOG(FATAL) << "Refactor me with CountMatrix or add SparseCountMatrix";
-//  AdjacencyList adjacency_count_list = getAdjacencyCountList();
-//  unsigned node_size = adjacency_count_list.size();
-//  unsigned updated_node_size = node_size + 1;
-//  adjacency_count_list.resize(updated_node_size);
-//
-//  Node artificial;
-//
-//  // add a self-loop if we count up to bound (bound inclusive)
-//  if (count_less_than_or_equal_to_bound) {
-//    artificial.first = node_size;
-//    artificial.second = 1;
-//    adjacency_count_list[node_size].push_back(artificial);
-//  }
-//
-//  for (int i = 0; (unsigned)i < node_size; i++) {
-//    if (is_accepting_state(i)) {
-//      artificial.first = i;
-//      artificial.second = 1;
-//      adjacency_count_list[node_size].push_back(artificial);
-//    }
-//  }
-//
-//  out << "A = SparseArray[{";
-//  std::string row_seperator = "";
-//  std::string col_seperator = "";
-//  int c = 0;
-//  for (auto& transitions : adjacency_count_list) {
-//    out << row_seperator;
-//    row_seperator = "";
-//    col_seperator = "";
-//    for(auto& node : transitions) {
-//      out << col_seperator;
-//      out << "{" << node.first + 1 << ", " << c + 1 << "} -> " << node.second;
-//      col_seperator = ", ";
-//      row_seperator = ", ";
-//    }
-//    c++;
-//  }
-//  out << "}];\n";
-//  // state indexes are off by one
-//  out << "numPaths = MatrixPower[A, " << bound + 2 << "][[" << this->dfa_->s + 1 << ", " << this->dfa_->ns + 1 << "]];\n";
-//  out << "Print[N[numPaths]];";
-//  out << std::endl;
-}
-
 /**
  * TODO Reimplement, combine with toDot
  *
@@ -2137,6 +2449,7 @@ void Automaton::toDotAscii(bool print_sink, std::ostream& out) {
 }
 
 void Automaton::ToDot(std::ostream& out, bool print_sink) {
+  DFAContext dfa_context;
   paths state_paths, pp;
   trace_descr tp;
   int i, j, k, l;
@@ -2265,6 +2578,7 @@ void Automaton::add_print_label(std::ostream& out) {
 }
 
 void Automaton::toBDD(std::ostream& out) {
+  DFAContext dfa_context;
   Table *table = tableInit();
 
   /* remove all marks in a->bddm */
@@ -2330,6 +2644,7 @@ void Automaton::toBDD(std::ostream& out) {
 }
 
 void Automaton::exportDfa(std::string file_name) {
+  DFAContext dfa_context;
   char* file_name_ptr = &*file_name.begin();
   // order 0 for boolean variables
   // we dont care about variable names but they are used in
@@ -2346,6 +2661,7 @@ void Automaton::exportDfa(std::string file_name) {
 }
 
 DFA_ptr Automaton::importDFA(std::string file_name) {
+  DFAContext dfa_context;
   char **names = new char*[this->num_of_bdd_variables_];
   int ** orders = new int*[this->num_of_bdd_variables_];
   return dfaImport(&*file_name.begin(), &names, orders);
@@ -2810,6 +3126,7 @@ void Automaton::getLowerUpperCaseCharsPrePost(char* transitions, int var, char**
 }
 
 DFA* Automaton::dfaPrePostToLowerUpperCaseHelper(DFA* M, int var, int* oldIndices, boolean lowerCase, boolean preImage){
+	DFAContext dfa_context;
 	DFA *result;
 	paths state_paths, pp;
 	trace_descr tp;
@@ -2920,18 +3237,22 @@ DFA* Automaton::dfaPrePostToLowerUpperCaseHelper(DFA* M, int var, int* oldIndice
 }
 
 DFA* Automaton::dfaToLowerCase(DFA* M, int var, int* indices){
+	DFAContext dfa_context;
 	return dfaPrePostToLowerUpperCaseHelper(M, var, indices, TRUE, FALSE);
 }
 
 DFA* Automaton::dfaToUpperCase(DFA* M, int var, int* indices){
+	DFAContext dfa_context;
 	return dfaPrePostToLowerUpperCaseHelper(M, var, indices, FALSE, FALSE);
 }
 
 DFA* Automaton::dfaPreToLowerCase(DFA* M, int var, int* indices){
+	DFAContext dfa_context;
 	return dfaPrePostToLowerUpperCaseHelper(M, var, indices, FALSE, TRUE);
 }
 
 DFA* Automaton::dfaPreToUpperCase(DFA* M, int var, int* indices){
+	DFAContext dfa_context;
 	return dfaPrePostToLowerUpperCaseHelper(M, var, indices, TRUE, TRUE);
 }
 
@@ -2941,6 +3262,7 @@ DFA* Automaton::dfaPreToUpperCase(DFA* M, int var, int* indices){
  */
 
 DFA_ptr Automaton::DFAExtendExtrabit(DFA_ptr M, int var) {
+	DFAContext dfa_context;
 	DFA_ptr result_dfa = nullptr,temp_dfa = nullptr;
 	trace_descr tp;
 	paths state_paths, pp;
@@ -3025,35 +3347,15 @@ int Automaton::check_emptiness(DFA_ptr M1, int var, int* indices) {
 		return false;
     if (M1->ns == 1 && M1->f[M1->s] == -1)
         return true;
-
-
-	char *satisfyingexample = NULL;
-	int i;
-	unsigned *uindices = (unsigned *) malloc((var+1) * sizeof(unsigned));
-
-	//conver int to unsigned
-	for (i = 0; i < var; i++)
-		uindices[i] = (indices[i] <= 0 ? 0 : indices[i]);
-	uindices[i] = '\0';
-
-	satisfyingexample = dfaMakeExample(M1, 1, var, uindices);
-
-	mem_free(uindices);
-    int result = ((satisfyingexample == NULL) ? 1 : 0);
-    free(satisfyingexample);
-    return result;
+	return DFAIsIntersectionEmpty({M1}) ? 1 : 0;
 }
 
 int Automaton::check_intersection(DFA_ptr M1, DFA_ptr M2, int var, int* indices) {
-	DFA *M;
-	int result;
-	M = DFAIntersect(M1, M2);
-	result = 1 - check_emptiness(M, var, indices);
-	dfaFree(M);
-	return result;
+	return DFAIsIntersectionEmpty({M1, M2}) ? 0 : 1;
 }
 
 int Automaton::check_equivalence(DFA_ptr M1, DFA_ptr M2, int var, int* indices) {
+	DFAContext dfa_context;
 	DFA *M[4];
 	int result, i;
 
@@ -3136,6 +3438,7 @@ char * Automaton::getSharp0WithExtraBit(int k) {
 }
 
 DFA *Automaton::dfaSharpStringWithExtraBit(int var, int *indices) {
+	DFAContext dfa_context;
 
 	char *sharp1;
 	sharp1 = getSharp1WithExtraBit(var);
@@ -3167,6 +3470,7 @@ char * Automaton::getArbitraryStringWithExtraBit(int k) {
 
 // A DFA that accepts all strings (Sigma*) except 11111111 and 111111110
 DFA * Automaton::dfaAllStringASCIIExceptReserveWords(int var, int *indices) {
+	DFAContext dfa_context;
 
 	dfaSetup(2, var, indices);
 	dfaAllocExceptions(2);
@@ -3187,6 +3491,7 @@ DFA * Automaton::dfaAllStringASCIIExceptReserveWords(int var, int *indices) {
 }
 
 DFA_ptr Automaton::dfa_star_M_star(DFA *M, int var, int *indices) {
+	DFAContext dfa_context;
 	DFA *result;
 	DFA *tmpM;
 	paths state_paths, pp;
@@ -3340,6 +3645,7 @@ DFA_ptr Automaton::dfa_star_M_star(DFA *M, int var, int *indices) {
 }
 
 DFA_ptr Automaton::dfa_general_replace_extrabit(DFA* M1, DFA* M2, DFA* M3, int var, int* indices){
+	DFAContext dfa_context;
 	DFA_ptr result;
 	DFA_ptr M1_bar;
 	DFA_ptr M2_bar;
@@ -3378,6 +3684,7 @@ DFA_ptr Automaton::dfa_general_replace_extrabit(DFA* M1, DFA* M2, DFA* M3, int v
 
 
 DFA_ptr Automaton::dfa_replace_step1_duplicate(DFA *M, int var, int *indices) {
+	DFAContext dfa_context;
 	DFA* result;
 		DFA *temp;
 	paths state_paths, pp;
@@ -3539,6 +3846,7 @@ DFA_ptr Automaton::dfa_replace_step1_duplicate(DFA *M, int var, int *indices) {
 }
 
 DFA_ptr Automaton::dfa_replace_step2_match_compliment(DFA *M, int var, int *indices) {
+	DFAContext dfa_context;
 	DFA *result;
 		DFA *temp;
 	DFA *M_neg;
@@ -3749,6 +4057,7 @@ DFA_ptr Automaton::dfa_replace_step2_match_compliment(DFA *M, int var, int *indi
 
 DFA_ptr Automaton::dfa_replace_step3_general_replace(DFA *M, DFA* Mr, int var, int *indices)
 {
+  DFAContext dfa_context;
   DFA *result0 = NULL;
   DFA *result1 = NULL;
   DFA *result2 = NULL;
@@ -3799,6 +4108,7 @@ DFA_ptr Automaton::dfa_replace_step3_general_replace(DFA *M, DFA* Mr, int var, i
 //Replace any c \in {sharp1} \vee bar \vee {sharp2} with \epsilon (Assume 00000000000)
 DFA_ptr Automaton::dfa_replace_delete(DFA *M, int var, int *oldindices)
 {
+      DFAContext dfa_context;
       DFA *result = NULL;
   DFA *tmpM2 = NULL;
   DFA *tmpM1 = NULL;
@@ -3947,6 +4257,7 @@ DFA_ptr Automaton::dfa_replace_delete(DFA *M, int var, int *oldindices)
 //for all i, if pairs[i]!=NULL, add path to each state in pairs[i]
 DFA * Automaton::dfa_replace_M_dot(DFA *M, DFA* Mr, int var, int *oldindices)
 {
+  DFAContext dfa_context;
   DFA *result = NULL;
   DFA *tmpM = NULL;
   int aux=0;
@@ -4111,6 +4422,7 @@ DFA * Automaton::dfa_replace_M_dot(DFA *M, DFA* Mr, int var, int *oldindices)
 //where Mr is the replacement, whihc can be an arbitrary DFA accepting words >1
 DFA_ptr Automaton::dfa_replace_M_arbitrary(DFA *M, DFA *Mr, int var, int *oldindices)
 {
+  DFAContext dfa_context;
   DFA *result = NULL;
   DFA *tmpM = NULL;
   int aux=0;
@@ -4365,6 +4677,7 @@ struct int_list_type **Automaton::get_match_exclude_self(DFA *M, int var, int *i
 }
 
 int Automaton::exist_sharp1_path(DFA *M, int start, int var) {
+	DFAContext dfa_context;
 	paths state_paths, pp;
 	trace_descr tp;
 	int j, sink;
@@ -4435,6 +4748,7 @@ int* Automaton::allocateAscIIIndexWithExtraBit(int length) {
 //reachable states from \bar* sharp0;
 struct int_list_type * Automaton::reachable_closure(DFA *M, int start, int var,
 		int *indices) {
+	DFAContext dfa_context;
 
 	paths state_paths, pp;
 	trace_descr tp;
@@ -4614,6 +4928,7 @@ int* Automaton::allocateArbitraryIndex(int length) {
 
 // A DFA that accepts only one arbitrary character
 DFA * Automaton::dfaDot(int var, int *indices){
+   DFAContext dfa_context;
 
    dfaSetup(3,var,indices);
 
@@ -4630,6 +4945,7 @@ DFA * Automaton::dfaDot(int var, int *indices){
 }
 
 int Automaton::count_accepted_chars(DFA* M){
+  DFAContext dfa_context;
   paths state_paths, pp;
   int k=0;
   int sink = find_sink(M);
@@ -4644,6 +4960,7 @@ int Automaton::count_accepted_chars(DFA* M){
 
 
 void Automaton::set_accepted_chars(DFA* M,char** apath, int numchars, int var, int* indices){
+  DFAContext dfa_context;
 
   paths state_paths, pp;
   trace_descr tp;
@@ -4704,6 +5021,7 @@ int Automaton::get_number_of_sharp1_state(struct int_list_type **pairs, int size
 //to: the destination of the outgoing edge
 
 void Automaton::initial_out_info(DFA* M, int* num, int* final, char*** bin, int** to, int var, int aux, int* indices){
+  DFAContext dfa_context;
 
   int i, j, k;
   paths state_paths, pp;
@@ -4768,6 +5086,7 @@ void Automaton::initial_out_info(DFA* M, int* num, int* final, char*** bin, int*
 }//end initial_out_info
 
 DFA_ptr Automaton::dfa_pre_replace_str(DFA* M1, DFA* M2, char *str, int var, int* indices){
+  DFAContext dfa_context;
 
   DFA *result=NULL;
   DFA *M3 = dfa_construct_string(str, var, indices);
@@ -4783,6 +5102,7 @@ DFA_ptr Automaton::dfa_pre_replace_str(DFA* M1, DFA* M2, char *str, int var, int
 }
 
 DFA * Automaton::dfa_construct_string(char *reg, int var, int *indices) {
+	DFAContext dfa_context;
 	int i;
 	char *finals;
 	char* binChar;
@@ -4822,6 +5142,7 @@ I.e., Output M' so that L(M')={ w0c0w1c1w2c2w3 | c0c1c2 \in L(M), wi \in L(Mr) }
 
 DFA * Automaton::dfa_insert_M_dot(DFA *M, DFA* Mr, int var, int *indices)
 {
+  DFAContext dfa_context;
   DFA *result = NULL;
   DFA *tmpM = NULL;
 
@@ -4933,6 +5254,7 @@ DFA * Automaton::dfa_insert_M_dot(DFA *M, DFA* Mr, int var, int *indices)
 
 DFA * Automaton::dfa_insert_M_arbitrary(DFA *M, DFA *Mr, int var, int *indices)
 {
+  DFAContext dfa_context;
   DFA *result = NULL;
   DFA *tmpM = NULL;
 
@@ -5104,6 +5426,7 @@ DFA * Automaton::dfa_insert_M_arbitrary(DFA *M, DFA *Mr, int var, int *indices)
 
 DFA * Automaton::dfa_insert_everywhere(DFA *M, DFA* Mr, int var, int *indices)
 {
+  DFAContext dfa_context;
   DFA *result1 = NULL;
   DFA *result2 = NULL;
   DFA *result = NULL;
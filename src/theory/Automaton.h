@@ -10,8 +10,10 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <random>
 #include <ctime>
+#include <climits>
 #include <cmath>
 #include <cstdlib>
 #include <cstring>
@@ -19,11 +21,14 @@
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <stack>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 #include <queue>
@@ -34,7 +39,6 @@
 #include <mona/dfa.h>
 #include <mona/mem.h>
 
-#include "../utils/Cmd.h"
 #include "../utils/Math.h"
 #include "../boost/multiprecision/cpp_int.hpp"
 #include "../Eigen/SparseCore"
@@ -43,6 +47,8 @@
 #include "options/Theory.h"
 #include "SymbolicCounter.h"
 #include "Formula.h"
+#include "AutomatonCache.h"
+#include "DFAContext.h"
 
 namespace Vlab {
 namespace Theory {
@@ -98,6 +104,21 @@ public:
    */
   bool IsEmptyLanguage() const;
 
+  /**
+   * Checks if the intersection with the other automaton accepts nothing without computing the intersection
+   * @param other_automaton
+   * @return
+   */
+  bool IsIntersectionEmpty(Automaton_ptr other_automaton) const;
+
+  /**
+   * Checks if the difference with the other automaton accepts nothing, i.e., the language is included in the other
+   * one, without computing the difference
+   * @param other_automaton
+   * @return
+   */
+  bool IsDifferenceEmpty(Automaton_ptr other_automaton) const;
+
   /**
    * Checks if only the initial state is accepting and any input is rejected
    * @return
@@ -209,6 +230,13 @@ public:
   virtual BigInteger SymbolicCount(int bound, bool count_less_than_or_equal_to_bound = true);
   virtual BigInteger SymbolicCount(double bound, bool count_less_than_or_equal_to_bound = true);
   virtual std::map<std::string,std::vector<std::string>> GetModelsWithinBound(int num_models, int bound);
+
+  /**
+   * Computes length of a shortest accepted word read from each state with a single backward bfs from the accepting
+   * states
+   * @return distances indexed by state, INT_MAX for states that cannot reach an accepting state
+   */
+  std::vector<int> GetDistancesToAcceptingStates();
   SymbolicCounter GetSymbolicCounter();
   static void SetCountBoundExact(bool value);
 
@@ -235,8 +263,18 @@ public:
 
   friend std::ostream& operator<<(std::ostream& os, const Automaton& automaton);
 
+  /**
+   * Frees the bdd variable indices cache, no automaton can be in use by any thread
+   */
   static void CleanUp();
 
+  /**
+   * Largest number of states and bdd nodes of the dfas wrapped by automata since the last reset
+   */
+  static int GetMaxNumOfStates();
+  static unsigned GetMaxNumOfBddNodes();
+  static void ResetStatistics();
+
 protected:
 
   /**
@@ -253,6 +291,15 @@ protected:
    */
   static bool DFAIsEmpty(const DFA_ptr dfa);
 
+  /**
+   * Checks if the intersection of the dfas accepts nothing.
+   * Explores the product on the fly and stops at the first reachable accepting tuple, the product is never built or
+   * minimized. Tuples with a state that cannot reach an accepting state are not expanded.
+   * @param dfas
+   * @return
+   */
+  static bool DFAIsIntersectionEmpty(const std::vector<DFA_ptr>& dfas);
+
   /**
    * Checks if a minimzed dfa only accepts the initial state without any input
    * @param minimized_dfa
@@ -365,6 +412,15 @@ protected:
    */
   static DFA_ptr DFAIntersect(const DFA_ptr dfa1, const DFA_ptr dfa2);
 
+  /**
+   * Generates a dfa with the intersection of the given dfas.
+   * Two smallest operands are intersected first, so a large dfa is multiplied with the product of the small ones only
+   * once. Stops as soon as an operand or an intermediate product is empty.
+   * @param dfas
+   * @return a new dfa, operands are not freed
+   */
+  static DFA_ptr DFAIntersect(const std::vector<DFA_ptr>& dfas);
+
   /**
    * Generates a dfa that accepts strings that are accepted by dfa1 but not by dfa2
    * @param dfa1
@@ -385,6 +441,19 @@ protected:
 	 */
 	static DFA_ptr DFAProjectAway(const DFA_ptr dfa, std::vector<int> map, const std::vector<int> indices);
 
+  /**
+   * Projects all the bdd variables in the given indices away at once; the variables are quantified on the bdds of the
+   * state subsets, followed by one minimization.
+   * @param dfa
+   * @param number_of_bdd_variables
+   * @param indices bdd variables to project away
+   * @param indices_map if given, remaining bdd variable i is renamed to indices_map[i], the order of the remaining
+   * variables must be kept
+   * @returns a minimized dfa
+   */
+  static DFA_ptr DFAProjectAway(const DFA_ptr dfa, const int number_of_bdd_variables, const std::vector<int>& indices,
+                                const int* indices_map = nullptr);
+
   /**
    * Generates a dfa where the bdd variable in the given index of the given dfa projected away and the index mapping is done again
    * @param dfa
@@ -448,6 +517,11 @@ protected:
 	 */
   static DFA_ptr DFAConcat(const DFA_ptr dfa1, const DFA_ptr dfa2, const int number_of_bdd_variables);
 
+  /**
+   * Concatenation without the operation cache, see DFAConcat
+   */
+  static DFA_ptr ComputeDFAConcat(const DFA_ptr dfa1, const DFA_ptr dfa2, const int number_of_bdd_variables);
+
 
   bool isAcceptingSingleWord();
   // TODO update it to work for non-accepting inputs
@@ -497,8 +571,6 @@ protected:
 
   virtual void SetSymbolicCounter();
   virtual void decide_counting_schema(Eigen::SparseMatrix<BigInteger>& mm);
-  void generateGFScript(int bound, std::ostream& out = std::cout, bool count_less_than_or_equal_to_bound = true);
-  void generateMatrixScript(int bound, std::ostream& out = std::cout, bool count_less_than_or_equal_to_bound = true);
 
 
   bool isCyclic(int state, std::map<int, bool>& is_discovered, std::map<int, bool>& is_stack_member);
@@ -617,12 +689,18 @@ protected:
   static DFA *dfa_insert_M_arbitrary(DFA *M, DFA *Mr, int var, int *indices);
   static DFA *dfa_insert_everywhere(DFA *M, DFA* Mr, int var, int *indices);
 
-  static unsigned long next_id;
+  static std::atomic<unsigned long> next_id;
+
+  static void UpdateStatistics(const DFA_ptr dfa);
+  static std::atomic<int> max_num_of_states_;
+  static std::atomic<unsigned> max_num_of_bdd_nodes_;
 
   /**
-   * Bdd variable indices cache used in MONA dfa manipulation
+   * Bdd variable indices cache used in MONA dfa manipulation, shared by all threads; arrays are never moved or freed
+   * while solving
    */
   static std::unordered_map<int, int*> bdd_variable_indices;
+  static std::mutex bdd_variable_indices_mutex;
 
   /**
    * Automaton id used for debuggin purposes
@@ -654,7 +732,7 @@ protected:
 private:
   char* getAnExample(bool accepting=true); // MONA version
   // for debugging
-  static int name_counter;
+  static std::atomic<int> name_counter;
   static const int VLOG_LEVEL;
 };
 
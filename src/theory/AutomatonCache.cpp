@@ -0,0 +1,279 @@
+/*
+ * AutomatonCache.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "AutomatonCache.h"
+
+#include "DFAContext.h"
+#include "options/Theory.h"
+
+namespace Vlab {
+namespace Theory {
+
+const int AutomatonCache::VLOG_LEVEL = 12;
+
+static const std::size_t BYTES_PER_MEGABYTE = 1024 * 1024;
+
+static uint64_t Mix(uint64_t hash, const uint64_t value) {
+  hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  hash ^= hash >> 30;
+  hash *= 0xbf58476d1ce4e5b9ULL;
+  hash ^= hash >> 27;
+  hash *= 0x94d049bb133111ebULL;
+  hash ^= hash >> 31;
+  return hash;
+}
+
+static AutomatonCache::Fingerprint Mix(const AutomatonCache::Fingerprint& fingerprint, const uint64_t value) {
+  return {Mix(fingerprint.first, value), Mix(fingerprint.second, ~value)};
+}
+
+AutomatonCache& AutomatonCache::GetInstance() {
+  static AutomatonCache instance;
+  return instance;
+}
+
+AutomatonCache::AutomatonCache()
+    : memory_budget_ {Option::Theory::AUTOMATON_CACHE_SIZE * BYTES_PER_MEGABYTE},
+      memory_usage_ {0},
+      num_of_hits_ {0},
+      num_of_misses_ {0} {
+}
+
+AutomatonCache::~AutomatonCache() {
+  Clear();
+}
+
+DFA_ptr AutomatonCache::Apply(const Operation operation, const DFA_ptr dfa1, const DFA_ptr dfa2,
+                              const int number_of_bdd_variables, std::function<DFA_ptr()> compute) {
+  if (get_memory_budget() == 0) {
+    return compute();
+  }
+
+  const Fingerprint fingerprint1 = GetFingerprint(dfa1);
+  const Fingerprint fingerprint2 = GetFingerprint(dfa2);
+  std::string key (1 + 4 * sizeof(uint64_t) + sizeof(int), '\0');
+  key[0] = static_cast<char>(operation);
+  char* data = &key[1];
+  for (const uint64_t part : {fingerprint1.first, fingerprint1.second, fingerprint2.first, fingerprint2.second}) {
+    std::memcpy(data, &part, sizeof(uint64_t));
+    data += sizeof(uint64_t);
+  }
+  std::memcpy(data, &number_of_bdd_variables, sizeof(int));
+  return Apply(key, {dfa1, dfa2}, compute);
+}
+
+DFA_ptr AutomatonCache::Apply(const std::string& key, std::function<DFA_ptr()> compute) {
+  return Apply(key, {}, compute);
+}
+
+DFA_ptr AutomatonCache::Apply(const std::string& key, const std::vector<DFA_ptr>& operands,
+                              std::function<DFA_ptr()> compute) {
+  if (get_memory_budget() == 0) {
+    return compute();
+  }
+
+  DFA_ptr result_dfa = Find(key, operands);
+  if (result_dfa != nullptr) {
+    return result_dfa;
+  }
+  // computed without holding the lock, operations use the cache recursively
+  result_dfa = compute();
+  Store(key, operands, result_dfa);
+  return result_dfa;
+}
+
+std::size_t AutomatonCache::get_memory_budget() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memory_budget_;
+}
+
+void AutomatonCache::set_memory_budget(const std::size_t memory_budget) {
+  DFAContext dfa_context;
+  std::lock_guard<std::mutex> lock(mutex_);
+  memory_budget_ = memory_budget;
+  Evict(memory_budget_);
+}
+
+std::size_t AutomatonCache::get_memory_usage() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memory_usage_;
+}
+
+std::size_t AutomatonCache::get_num_of_entries() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+unsigned long AutomatonCache::get_num_of_hits() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_of_hits_;
+}
+
+unsigned long AutomatonCache::get_num_of_misses() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_of_misses_;
+}
+
+void AutomatonCache::Clear() {
+  DFAContext dfa_context;
+  std::lock_guard<std::mutex> lock(mutex_);
+  Evict(0);
+}
+
+AutomatonCache::Fingerprint AutomatonCache::GetFingerprint(const DFA_ptr dfa) {
+  std::unordered_map<bdd_ptr, Fingerprint> bdd_fingerprints;
+  std::function<Fingerprint(const bdd_ptr)> get_bdd_fingerprint = [&](const bdd_ptr node) -> Fingerprint {
+    auto it = bdd_fingerprints.find(node);
+    if (it != bdd_fingerprints.end()) {
+      return it->second;
+    }
+    Fingerprint node_fingerprint;
+    if (bdd_is_leaf(dfa->bddm, node)) {
+      node_fingerprint = Mix(Fingerprint(1, 1), bdd_leaf_value(dfa->bddm, node));
+    } else {
+      const Fingerprint then_fingerprint = get_bdd_fingerprint(bdd_then(dfa->bddm, node));
+      const Fingerprint else_fingerprint = get_bdd_fingerprint(bdd_else(dfa->bddm, node));
+      node_fingerprint = Mix(Fingerprint(2, 2), bdd_ifindex(dfa->bddm, node));
+      node_fingerprint = Mix(node_fingerprint, then_fingerprint.first ^ (then_fingerprint.second << 1));
+      node_fingerprint = Mix(node_fingerprint, else_fingerprint.first ^ (else_fingerprint.second << 1));
+    }
+    bdd_fingerprints[node] = node_fingerprint;
+    return node_fingerprint;
+  };
+
+  Fingerprint fingerprint = Mix(Fingerprint(0, 0), dfa->ns);
+  fingerprint = Mix(fingerprint, dfa->s);
+  for (int s = 0; s < dfa->ns; ++s) {
+    const Fingerprint state_fingerprint = get_bdd_fingerprint(dfa->q[s]);
+    fingerprint = Mix(fingerprint, static_cast<uint64_t>(dfa->f[s] + 1));
+    fingerprint = Mix(fingerprint, state_fingerprint.first ^ (state_fingerprint.second << 1));
+  }
+  return fingerprint;
+}
+
+bool AutomatonCache::IsEqual(const DFA_ptr dfa1, const DFA_ptr dfa2) {
+  if (dfa1 == dfa2) {
+    return true;
+  }
+  if (dfa1->ns != dfa2->ns or dfa1->s != dfa2->s) {
+    return false;
+  }
+  for (int s = 0; s < dfa1->ns; ++s) {
+    if (dfa1->f[s] != dfa2->f[s]) {
+      return false;
+    }
+  }
+
+  // nodes are matched one to one, a node of the first dfa is compared once
+  std::unordered_map<bdd_ptr, bdd_ptr> matched_nodes;
+  std::vector<std::pair<bdd_ptr, bdd_ptr>> pending_nodes;
+  for (int s = 0; s < dfa1->ns; ++s) {
+    pending_nodes.push_back({dfa1->q[s], dfa2->q[s]});
+  }
+  while (not pending_nodes.empty()) {
+    const bdd_ptr node1 = pending_nodes.back().first;
+    const bdd_ptr node2 = pending_nodes.back().second;
+    pending_nodes.pop_back();
+    auto it = matched_nodes.find(node1);
+    if (it != matched_nodes.end()) {
+      if (it->second != node2) {
+        return false;
+      }
+      continue;
+    }
+    matched_nodes[node1] = node2;
+
+    const bool is_leaf = bdd_is_leaf(dfa1->bddm, node1);
+    if (is_leaf != static_cast<bool>(bdd_is_leaf(dfa2->bddm, node2))) {
+      return false;
+    }
+    if (is_leaf) {
+      if (bdd_leaf_value(dfa1->bddm, node1) != bdd_leaf_value(dfa2->bddm, node2)) {
+        return false;
+      }
+    } else {
+      if (bdd_ifindex(dfa1->bddm, node1) != bdd_ifindex(dfa2->bddm, node2)) {
+        return false;
+      }
+      pending_nodes.push_back({bdd_then(dfa1->bddm, node1), bdd_then(dfa2->bddm, node2)});
+      pending_nodes.push_back({bdd_else(dfa1->bddm, node1), bdd_else(dfa2->bddm, node2)});
+    }
+  }
+  return true;
+}
+
+std::size_t AutomatonCache::GetSize(const DFA_ptr dfa) {
+  return sizeof(DFA) + dfa->ns * (sizeof(bdd_ptr) + sizeof(int)) + bdd_size(dfa->bddm) * sizeof(bdd_record);
+}
+
+DFA_ptr AutomatonCache::Find(const std::string& key, const std::vector<DFA_ptr>& operands) {
+  DFAContext dfa_context;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    ++num_of_misses_;
+    return nullptr;
+  }
+  const auto& stored_operands = it->second->operands;
+  bool is_equal = (stored_operands.size() == operands.size());
+  for (std::size_t i = 0; is_equal and i < operands.size(); ++i) {
+    is_equal = IsEqual(stored_operands[i], operands[i]);
+  }
+  if (not is_equal) {
+    LOG(WARNING) << "automaton cache key collision, result is computed";
+    ++num_of_misses_;
+    return nullptr;
+  }
+  ++num_of_hits_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+  return dfaCopy(it->second->dfa);
+}
+
+void AutomatonCache::Store(const std::string& key, const std::vector<DFA_ptr>& operands, const DFA_ptr dfa) {
+  std::size_t size = GetSize(dfa) + key.size();
+  for (auto operand : operands) {
+    size += GetSize(operand);
+  }
+  DFAContext dfa_context;
+  std::lock_guard<std::mutex> lock(mutex_);
+  // on a key collision the stored entry is kept
+  if (size > memory_budget_ or index_.find(key) != index_.end()) {
+    return;
+  }
+  std::vector<DFA_ptr> operand_copies;
+  for (auto operand : operands) {
+    operand_copies.push_back(dfaCopy(operand));
+  }
+  entries_.push_front({key, operand_copies, dfaCopy(dfa), size});
+  index_[key] = entries_.begin();
+  memory_usage_ += size;
+  Evict(memory_budget_);
+  DVLOG(VLOG_LEVEL) << "cached dfa with " << dfa->ns << " states, " << entries_.size() << " entries use "
+                    << memory_usage_ << " bytes";
+}
+
+void AutomatonCache::Evict(const std::size_t memory_budget) {
+  while (memory_usage_ > memory_budget and not entries_.empty()) {
+    Entry& entry = entries_.back();
+    memory_usage_ -= entry.size;
+    Free(entry);
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+void AutomatonCache::Free(Entry& entry) {
+  for (auto operand : entry.operands) {
+    dfaFree(operand);
+  }
+  entry.operands.clear();
+  dfaFree(entry.dfa);
+  entry.dfa = nullptr;
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,158 @@
+/*
+ * AutomatonCache.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_AUTOMATONCACHE_H_
+#define SRC_THEORY_AUTOMATONCACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+#include <mona/bdd.h>
+#include <mona/dfa.h>
+
+namespace Vlab {
+namespace Theory {
+
+using DFA_ptr = DFA*;
+
+/**
+ * Process wide memo table of automata operations.
+ * Operations on dfas are keyed by the structural fingerprints of the operands, factories are keyed by their
+ * arguments. Entries keep copies of their operands, a hit is used only when the operands are structurally equal to
+ * the stored ones so that a fingerprint collision cannot return a wrong result.
+ * Results are kept in least recently used order and evicted when the memory budget is exceeded.
+ * The cache owns its dfas, callers always get a copy.
+ */
+class AutomatonCache {
+ public:
+  enum class Operation
+    : int {
+      INTERSECT = 0, UNION, CONCAT, STRING_CONCAT
+  };
+
+  using Fingerprint = std::pair<uint64_t, uint64_t>;
+
+  static AutomatonCache& GetInstance();
+
+  /**
+   * Returns the result of the operation on the given dfas, computes it only if it is not in the cache.
+   * @param operation
+   * @param dfa1
+   * @param dfa2
+   * @param number_of_bdd_variables
+   * @param compute computes the result, the cache takes the ownership of the returned dfa
+   * @return a dfa owned by the caller
+   */
+  DFA_ptr Apply(const Operation operation, const DFA_ptr dfa1, const DFA_ptr dfa2, const int number_of_bdd_variables,
+                std::function<DFA_ptr()> compute);
+
+  /**
+   * Returns the dfa built by a factory, computes it only if it is not in the cache.
+   * @param key identifies the factory and its arguments
+   * @param compute
+   * @return a dfa owned by the caller
+   */
+  DFA_ptr Apply(const std::string& key, std::function<DFA_ptr()> compute);
+
+  /**
+   * Returns the result computed from the given dfas, the key identifies the computation.
+   * @param key
+   * @param operands dfas the result is computed from, a hit requires equal operands
+   * @param compute
+   * @return a dfa owned by the caller
+   */
+  DFA_ptr Apply(const std::string& key, const std::vector<DFA_ptr>& operands, std::function<DFA_ptr()> compute);
+
+  /**
+   * Memory budget in bytes, 0 disables the cache.
+   */
+  std::size_t get_memory_budget() const;
+  void set_memory_budget(const std::size_t memory_budget);
+  std::size_t get_memory_usage() const;
+  std::size_t get_num_of_entries() const;
+  unsigned long get_num_of_hits() const;
+  unsigned long get_num_of_misses() const;
+
+  void Clear();
+
+  /**
+   * Hashes the states, accepting statuses and the transition bdds of the dfa.
+   * Same dfas built with the same bdd variable ordering have the same fingerprint.
+   * @param dfa
+   * @return
+   */
+  static Fingerprint GetFingerprint(const DFA_ptr dfa);
+
+  /**
+   * Compares the states, accepting statuses and the transition bdds of the dfas, the dfas may use different bdd
+   * managers.
+   * @param dfa1
+   * @param dfa2
+   * @return true if the dfas are structurally equal
+   */
+  static bool IsEqual(const DFA_ptr dfa1, const DFA_ptr dfa2);
+
+  /**
+   * Approximate memory used by a dfa.
+   * @param dfa
+   * @return size in bytes
+   */
+  static std::size_t GetSize(const DFA_ptr dfa);
+
+ protected:
+  AutomatonCache();
+  virtual ~AutomatonCache();
+  AutomatonCache(const AutomatonCache&) = delete;
+  AutomatonCache& operator=(const AutomatonCache&) = delete;
+
+  struct Entry {
+    std::string key;
+    /**
+     * copies of the operands
+     */
+    std::vector<DFA_ptr> operands;
+    DFA_ptr dfa;
+    std::size_t size;
+  };
+
+  DFA_ptr Find(const std::string& key, const std::vector<DFA_ptr>& operands);
+  void Store(const std::string& key, const std::vector<DFA_ptr>& operands, const DFA_ptr dfa);
+  void Free(Entry& entry);
+  /**
+   * Frees least recently used entries until the budget is met, caller holds a dfa context and the lock
+   */
+  void Evict(const std::size_t memory_budget);
+
+  std::size_t memory_budget_;
+  std::size_t memory_usage_;
+  unsigned long num_of_hits_;
+  unsigned long num_of_misses_;
+
+  /**
+   * Most recently used entry is at the front
+   */
+  std::list<Entry> entries_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+  mutable std::mutex mutex_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_AUTOMATONCACHE_H_ */
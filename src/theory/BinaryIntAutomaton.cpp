@@ -15,6 +15,15 @@ namespace Theory {
 
 const int BinaryIntAutomaton::VLOG_LEVEL = 9;
 
+const BinaryIntAutomaton::CarryState BinaryIntAutomaton::SINK_CARRY_STATE {0, -1};
+
+/**
+ * Division by 2 rounded towards negative infinity
+ */
+static int FloorHalf(const int value) {
+  return (value >= 0) ? value / 2 : (value - 1) / 2;
+}
+
 BinaryIntAutomaton::BinaryIntAutomaton(bool is_natural_number)
     : Automaton(Automaton::Type::BINARYINT),
       is_natural_number_ { is_natural_number },
@@ -143,6 +152,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeAutomaton(int value, std::string
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeAutomaton(SemilinearSet_ptr semilinear_set, std::string var_name,
                                                          ArithmeticFormula_ptr formula, bool add_leading_zeros) {
+  DFAContext dfa_context;
   DVLOG(VLOG_LEVEL) << "BinaryIntAutomaton::MakeAutomaton("<< *semilinear_set << ", " << var_name;
 
   int var_index = formula->GetVariableIndex(var_name);
@@ -328,6 +338,7 @@ bool BinaryIntAutomaton::HasNegative1() {
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::Complement() {
+  DFAContext dfa_context;
   DFA_ptr complement_dfa = dfaCopy(this->dfa_);
 
   dfaNegation(complement_dfa);
@@ -362,6 +373,40 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::Intersect(BinaryIntAutomaton_ptr othe
   return intersect_auto;
 }
 
+BinaryIntAutomaton_ptr BinaryIntAutomaton::Intersect(const std::vector<BinaryIntAutomaton_ptr>& autos) {
+  CHECK(not autos.empty()) << "nothing to intersect";
+  if (autos.size() == 1) {
+    return autos[0]->clone();
+  }
+  std::vector<DFA_ptr> dfas;
+  for (auto binary_auto : autos) {
+    dfas.push_back(binary_auto->dfa_);
+  }
+  auto intersect_dfa = Automaton::DFAIntersect(dfas);
+  // folds the formulas of all operands as the binary version does for two, operands without a formula are skipped
+  ArithmeticFormula_ptr intersect_formula = nullptr;
+  for (auto binary_auto : autos) {
+    if (binary_auto->formula_ == nullptr) {
+      continue;
+    }
+    if (intersect_formula == nullptr) {
+      intersect_formula = binary_auto->formula_->clone();
+    } else {
+      auto next_formula = intersect_formula->Intersect(binary_auto->formula_);
+      delete intersect_formula;
+      intersect_formula = next_formula;
+    }
+  }
+  if (intersect_formula != nullptr) {
+    intersect_formula->ResetCoefficients();
+    intersect_formula->SetType(ArithmeticFormula::Type::INTERSECT);
+  }
+  auto intersect_auto = new BinaryIntAutomaton(intersect_dfa, intersect_formula, autos[0]->is_natural_number_);
+
+  DVLOG(VLOG_LEVEL) << intersect_auto->id_ << " = Intersect(" << autos.size() << " automata)";
+  return intersect_auto;
+}
+
 BinaryIntAutomaton_ptr BinaryIntAutomaton::Union(BinaryIntAutomaton_ptr other_auto) {
   auto union_dfa = Automaton::DFAUnion(this->dfa_, other_auto->dfa_);
   ArithmeticFormula_ptr union_formula = nullptr;
@@ -756,6 +801,28 @@ std::map<std::string, int> BinaryIntAutomaton::GetAnAcceptingIntForEachVar() {
   return var_values;
 }
 
+std::map<std::string, BigInteger> BinaryIntAutomaton::GetModelFromBits(const std::vector<bool>& bits) {
+  const std::size_t length = bits.size() / num_of_bdd_variables_;
+  std::map<std::string, BigInteger> var_values;
+  for (auto& var_entry : formula_->GetVariableCoefficientMap()) {
+    const int var_index = formula_->GetVariableIndex(var_entry.first);
+    BigInteger value = 0;
+    std::size_t num_of_value_bits = length;
+    if (not is_natural_number_ and length > 0) {
+      // two's complement, sign bit is read first
+      --num_of_value_bits;
+      if (bits[num_of_value_bits * num_of_bdd_variables_ + var_index]) {
+        value = -1;
+      }
+    }
+    for (std::size_t k = num_of_value_bits; k > 0; --k) {
+      value = value * 2 + (bits[(k - 1) * num_of_bdd_variables_ + var_index] ? 1 : 0);
+    }
+    var_values[var_entry.first] = value;
+  }
+  return var_values;
+}
+
 void BinaryIntAutomaton::decide_counting_schema(Eigen::SparseMatrix<BigInteger>& count_matrix) {
   if (is_natural_number_) {
     counter_.set_type(SymbolicCounter::Type::BINARYUNSIGNEDINT);
@@ -764,40 +831,33 @@ void BinaryIntAutomaton::decide_counting_schema(Eigen::SparseMatrix<BigInteger>&
   }
 }
 
+/**
+ * Counts with the linear recurrence of the count matrix, sign bit is handled by the counter type.
+ * Each value within the bit bound has exactly one encoding of that length, so the values that need exactly the bound
+ * are the ones that do not fit in one bit less.
+ */
 BigInteger BinaryIntAutomaton::SymbolicCount(double bound, bool count_less_than_or_equal_to_bound) {
-  std::stringstream cmd;
-  std::string str_result;
-  std::string tmp_result_file = Option::Theory::TMP_PATH + "/arith_result.dot";
-  std::string math_script_path = Option::Theory::SCRIPT_PATH + "/count.m";
-
-  std::ofstream outfile(tmp_result_file.c_str());
-  if (!outfile.good()) {
-    std::cout << "cannot open file: " << tmp_result_file << std::endl;
-    exit(2);
+  if (not is_counter_cached_) {
+    SetSymbolicCounter();
   }
 
-  this->ToDot(outfile, false);
-
-  cmd << "math -script " << math_script_path << " " << tmp_result_file << " ";
-
-  if (not is_natural_number_) {
-    ++bound;  // consider sign bit
+  if (bound < 0) {
+    return 0;
   }
-
-  if (std::floor(bound) == bound) {
-    cmd << static_cast<int>(bound);
-  } else {
-    cmd << bound;
+  const unsigned long bit_bound = static_cast<unsigned long>(std::floor(bound));
+  if (bit_bound != bound) {
+    LOG(WARNING) << "bit bound " << bound << " is not a whole number, counting with " << bit_bound << " bits";
   }
 
-  try {
-    DVLOG(VLOG_LEVEL) << "run_cmd(`" << cmd.str() << "`)";
-    str_result = Util::Cmd::run_cmd(cmd.str());
-  } catch (std::string& e) {
-    LOG(ERROR)<< e;
+  const LinearRecurrence& recurrence = counter_.GetLinearRecurrence();
+  BigInteger result = recurrence.Evaluate(counter_.GetPower(bit_bound));
+  if (not count_less_than_or_equal_to_bound and bit_bound > 0) {
+    result -= recurrence.Evaluate(counter_.GetPower(bit_bound - 1));
   }
 
-  return BigInteger(str_result);
+  DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->SymbolicCount(" << bound << ", " << count_less_than_or_equal_to_bound
+                    << ") : " << result;
+  return result;
 }
 
 std::map<std::string,std::vector<std::string>> BinaryIntAutomaton::GetModelsWithinBound(int num_models, int bound) {
@@ -820,43 +880,8 @@ std::map<std::string,std::vector<std::string>> BinaryIntAutomaton::GetModelsWith
 //	LOG(INFO) << "num_models : " << num_models;
 //	LOG(INFO) << "bound      : " << bound;
 
-  // compute BFS for unweighted graph (dfa)
-  std::queue<int> states_to_process;
-  std::vector<int> distances(this->dfa_->ns,INT_MAX);
-  std::set<int> final_states;
-
-  std::vector<int> shortest_accepting_path(this->dfa_->ns,INT_MAX);
-  for(int start_state = 0; start_state < this->dfa_->ns; start_state++) {
-  	distances[start_state] = 0;
-		states_to_process.push(start_state);
-
-		while(not states_to_process.empty()) {
-			int s = states_to_process.front();
-			states_to_process.pop();
-			// mark final states for later
-			if(this->dfa_->f[s] == 1) {
-				final_states.insert(s);
-			}
-
-			for(auto iter : getNextStates(s)) {
-				if(distances[iter] == INT_MAX) {
-					states_to_process.push(iter);
-					distances[iter] = distances[s] + 1;
-				}
-			}
-		}
-
-		int shortest = INT_MAX;
-		for(auto final : final_states) {
-			if(distances[final] < shortest) {
-				shortest = distances[final];
-			}
-		}
-		shortest_accepting_path[start_state] = shortest;
-
-
-		distances = std::vector<int>(this->dfa_->ns,INT_MAX);
-  }
+  // one backward bfs from the accepting states gives the shortest accepted suffix of each state
+  std::vector<int> shortest_accepting_path = GetDistancesToAcceptingStates();
 
 //  for(int i = 0; i < this->dfa_->ns; i++) {
 //  	LOG(INFO) << "shortest path for state " << i << " = " << shortest_accepting_path[i];
@@ -1237,6 +1262,7 @@ std::map<std::string,std::vector<std::string>> BinaryIntAutomaton::GetModelsWith
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeBoolean(ArithmeticFormula_ptr formula) {
+	DFAContext dfa_context;
 
 	auto boolean_variables = formula->GetBooleans();
 
@@ -1275,6 +1301,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeBoolean(ArithmeticFormula_ptr for
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntGraterThanOrEqualToZero(std::vector<int> indexes,
                                                                           int number_of_variables) {
+  DFAContext dfa_context;
   int* bin_variable_indices = GetBddVariableIndices(number_of_variables);
   int number_of_states = 3;
   char statuses[3] { '-', '+', '-' };
@@ -1323,6 +1350,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeEquality(ArithmeticFormula_ptr fo
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntEquality(ArithmeticFormula_ptr formula) {
+  DFAContext dfa_context;
   if (not formula->Simplify()) {
     auto equality_auto = BinaryIntAutomaton::MakePhi(formula, false);
     DVLOG(VLOG_LEVEL) << equality_auto->id_ << " = MakeIntEquality(" << *formula << ")";
@@ -1350,6 +1378,28 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntEquality(ArithmeticFormula_ptr
     min = constant;
   }
 
+  if (UseSymbolicConstruction(formula)) {
+    const bool is_equality = (ArithmeticFormula::Type::EQ == formula->GetType());
+    // flag is set when the carry is reached with a self loop, only those states are accepting for equality
+    auto equality_dfa = MakeCarryDFA(formula, CarryState(constant, 0),
+        [](const CarryState& state, const int sum) {
+          const int result = state.first + sum;
+          if (result & 1) {
+            return SINK_CARRY_STATE;
+          }
+          return CarryState(result / 2, (result / 2 == state.first) ? 1 : 0);
+        },
+        [is_equality](const CarryState& state) {
+          if (state == SINK_CARRY_STATE) {
+            return not is_equality;
+          }
+          return (state.second == 1) == is_equality;
+        });
+    auto equality_auto = new BinaryIntAutomaton(equality_dfa, formula, false);
+    DVLOG(VLOG_LEVEL) << equality_auto->id_ << " = MakeIntEquality(" << *formula << ")";
+    return equality_auto;
+  }
+
   const int num_of_states = 2 * (max - min + 2);
   const int sink_state = num_of_states - 2;
   const int shifted_initial_state = num_of_states - 1;
@@ -1507,6 +1557,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntEquality(ArithmeticFormula_ptr
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeNaturalNumberEquality(ArithmeticFormula_ptr formula) {
+  DFAContext dfa_context;
   if (not formula->Simplify()) {
     auto equality_auto = BinaryIntAutomaton::MakePhi(formula, true);
     DVLOG(VLOG_LEVEL) << equality_auto->id_ << " = MakeNaturalNumberEquality(" << *formula << ")";
@@ -1534,6 +1585,27 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeNaturalNumberEquality(ArithmeticF
     min = constant;
   }
 
+  if (UseSymbolicConstruction(formula)) {
+    const bool is_equality = (ArithmeticFormula::Type::EQ == formula->GetType());
+    auto equality_dfa = MakeCarryDFA(formula, CarryState(constant, 0),
+        [](const CarryState& state, const int sum) {
+          const int result = state.first + sum;
+          if (result & 1) {
+            return SINK_CARRY_STATE;
+          }
+          return CarryState(result / 2, 0);
+        },
+        [is_equality](const CarryState& state) {
+          if (state == SINK_CARRY_STATE) {
+            return not is_equality;
+          }
+          return (state.first == 0) == is_equality;
+        });
+    auto equality_auto = new BinaryIntAutomaton(equality_dfa, formula, true);
+    DVLOG(VLOG_LEVEL) << equality_auto->id_ << " = MakeNaturalNumberEquality(" << *formula << ")";
+    return equality_auto;
+  }
+
   const int num_of_states = max - min + 3;
   const int sink_state = num_of_states - 2;
   const int shifted_initial_state = num_of_states - 1;
@@ -1684,6 +1756,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeLessThan(ArithmeticFormula_ptr fo
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntLessThan(ArithmeticFormula_ptr formula) {
+  DFAContext dfa_context;
   formula->Simplify();
 
   auto coeffs_map = formula->GetVariableCoefficientMap();
@@ -1707,6 +1780,30 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntLessThan(ArithmeticFormula_ptr
     min = constant;
   }
 
+  if (UseSymbolicConstruction(formula)) {
+    // flag is set when repeating the last bit as the sign bit leaves a negative result
+    auto less_than_dfa = MakeCarryDFA(formula, CarryState(constant, 0),
+        [](const CarryState& state, const int sum) {
+          int result = state.first + sum;
+          const int target = FloorHalf(result);
+          int write1 = result & 1;
+          int label1 = state.first, label2 = target;
+          while (label1 != label2) {
+            label1 = label2;
+            result = label1 + sum;
+            label2 = FloorHalf(result);
+            write1 = result & 1;
+          }
+          return CarryState(target, write1);
+        },
+        [](const CarryState& state) {
+          return state.second == 1;
+        });
+    auto less_than_auto = new BinaryIntAutomaton(less_than_dfa, formula, false);
+    DVLOG(VLOG_LEVEL) << less_than_auto->id_ << " = MakeIntLessThan(" << *formula << ")";
+    return less_than_auto;
+  }
+
   const int num_of_states = 2 * (max - min + 1);
 
   unsigned max_states_allowed = 0x80000000;
@@ -1844,6 +1941,7 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeIntLessThan(ArithmeticFormula_ptr
 }
 
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeNaturalNumberLessThan(ArithmeticFormula_ptr formula) {
+  DFAContext dfa_context;
   formula->Simplify();
 
   auto coeffs_map = formula->GetVariableCoefficientMap();
@@ -1867,6 +1965,19 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeNaturalNumberLessThan(ArithmeticF
     min = constant;
   }
 
+  if (UseSymbolicConstruction(formula)) {
+    auto less_than_dfa = MakeCarryDFA(formula, CarryState(constant, 0),
+        [](const CarryState& state, const int sum) {
+          return CarryState(FloorHalf(state.first + sum), 0);
+        },
+        [](const CarryState& state) {
+          return state.first < 0;
+        });
+    auto less_than_auto = new BinaryIntAutomaton(less_than_dfa, formula, true);
+    DVLOG(VLOG_LEVEL) << less_than_auto->id_ << " = MakeNaturalNumberLessThan(" << *formula << ")";
+    return less_than_auto;
+  }
+
   const int num_of_states = max - min + 2;
   const int shifted_initial_state = num_of_states - 1;
 
@@ -2037,7 +2148,130 @@ BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeGreaterThanOrEqual(ArithmeticForm
   return greater_than_or_equal_auto;
 }
 
+bool BinaryIntAutomaton::UseSymbolicConstruction(ArithmeticFormula_ptr formula) {
+  if (not formula->GetBooleans().empty()) {
+    return false;
+  }
+  int active_num_variables = 0;
+  for (int coeff : formula->GetCoefficients()) {
+    if (coeff != 0) {
+      ++active_num_variables;
+    }
+  }
+  return active_num_variables >= Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD;
+}
+
+DFA_ptr BinaryIntAutomaton::MakeCarryDFA(ArithmeticFormula_ptr formula, const CarryState initial_state,
+                                         std::function<CarryState(const CarryState&, const int)> next_state,
+                                         std::function<bool(const CarryState&)> is_accepting) {
+  DFAContext dfa_context;
+  auto coeffs = formula->GetCoefficients();
+  const int number_of_variables = coeffs.size();
+
+  // all sums of coefficients a transition can see
+  std::set<int> sums {0};
+  for (int coeff : coeffs) {
+    if (coeff != 0) {
+      std::set<int> next_sums (sums);
+      for (int sum : sums) {
+        next_sums.insert(sum + coeff);
+      }
+      sums.swap(next_sums);
+    }
+  }
+
+  std::map<CarryState, int> state_ids;
+  std::vector<CarryState> states;
+  auto get_state_id = [&state_ids, &states](const CarryState& state) -> int {
+    auto it = state_ids.find(state);
+    if (it != state_ids.end()) {
+      return it->second;
+    }
+    const int id = states.size();
+    state_ids[state] = id;
+    states.push_back(state);
+    return id;
+  };
+
+  std::vector<std::map<int, int>> transitions;  // state -> sum -> state
+  bool is_initial_state_in_cycle = false;
+  get_state_id(initial_state);
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    const CarryState current_state = states[i];
+    std::map<int, int> sum_transitions;
+    for (int sum : sums) {
+      CarryState target = SINK_CARRY_STATE;
+      if (current_state != SINK_CARRY_STATE) {
+        target = next_state(current_state, sum);
+      }
+      const int to_state = get_state_id(target);
+      is_initial_state_in_cycle = is_initial_state_in_cycle or (to_state == 0);
+      sum_transitions[sum] = to_state;
+    }
+    transitions.push_back(sum_transitions);
+  }
+
+  // hack to avoid an accepting initial state
+  int number_of_states = states.size();
+  if (is_initial_state_in_cycle) {
+    const int shifted_initial_state = number_of_states++;
+    transitions.push_back(transitions[0]);
+    for (auto& sum_transitions : transitions) {
+      for (auto& entry : sum_transitions) {
+        if (entry.second == 0) {
+          entry.second = shifted_initial_state;
+        }
+      }
+    }
+  }
+
+  unsigned max_states_allowed = 0x80000000;
+  unsigned mona_check = 8 * number_of_states;
+  CHECK_LE(mona_check, max_states_allowed);  // otherwise, MONA infinite loops
+
+  DFA_ptr carry_dfa = dfaMake(number_of_states);
+  carry_dfa->s = 0;
+  for (int i = 0; i < number_of_states; ++i) {
+    const auto& sum_transitions = transitions[i];
+    std::map<std::pair<int, int>, bdd_ptr> nodes;  // (variable, partial sum) -> bdd node
+    std::function<bdd_ptr(int, int)> make_node = [&](int variable, const int partial_sum) -> bdd_ptr {
+      while (variable < number_of_variables and coeffs[variable] == 0) {
+        ++variable;
+      }
+      if (variable == number_of_variables) {
+        return bdd_find_leaf_hashed_add_root(carry_dfa->bddm, sum_transitions.at(partial_sum));
+      }
+      auto key = std::make_pair(variable, partial_sum);
+      auto it = nodes.find(key);
+      if (it != nodes.end()) {
+        return it->second;
+      }
+      bdd_ptr low = make_node(variable + 1, partial_sum);
+      bdd_ptr high = make_node(variable + 1, partial_sum + coeffs[variable]);
+      bdd_ptr node = low;
+      if (low != high) {
+        node = bdd_find_node_hashed_add_root(carry_dfa->bddm, low, high, variable);
+      }
+      nodes[key] = node;
+      return node;
+    };
+    carry_dfa->q[i] = make_node(0, 0);
+
+    if (i == 0) {
+      carry_dfa->f[i] = -1;
+    } else {
+      const CarryState& state = (i < (int)states.size()) ? states[i] : initial_state;
+      carry_dfa->f[i] = is_accepting(state) ? 1 : -1;
+    }
+  }
+
+  DFA_ptr minimized_dfa = dfaMinimize(carry_dfa);
+  dfaFree(carry_dfa);
+  return minimized_dfa;
+}
+
 BinaryIntAutomaton_ptr BinaryIntAutomaton::MakeTrimHelperAuto(int var_index, int number_of_variables) {
+  DFAContext dfa_context;
   char statuses[5] = { '-', '+', '+', '-', '-' };
   char* exception = new char[number_of_variables + 1];
   for (int i = 0; i < number_of_variables; i++) {
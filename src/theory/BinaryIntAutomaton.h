@@ -14,9 +14,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <set>
 #include <sstream>
 #include <stack>
 #include <string>
@@ -28,7 +30,6 @@
 #include <mona/bdd.h>
 #include <mona/dfa.h>
 
-#include "../utils/Cmd.h"
 #include "../utils/List.h"
 #include "ArithmeticFormula.h"
 #include "Automaton.h"
@@ -71,6 +72,10 @@ public:
   bool HasNegative1();
   BinaryIntAutomaton_ptr Complement();
   BinaryIntAutomaton_ptr Intersect(BinaryIntAutomaton_ptr);
+  /**
+   * Intersects all automata at once, see Automaton::DFAIntersect for the order of the products
+   */
+  static BinaryIntAutomaton_ptr Intersect(const std::vector<BinaryIntAutomaton_ptr>& autos);
   BinaryIntAutomaton_ptr Union(BinaryIntAutomaton_ptr);
   BinaryIntAutomaton_ptr Difference(BinaryIntAutomaton_ptr);
   BinaryIntAutomaton_ptr Exists(std::string var_name);
@@ -84,7 +89,14 @@ public:
 
   std::map<std::string, int> GetAnAcceptingIntForEachVar();
 
-  BigInteger SymbolicCount(double bound, bool count_less_than_or_equal_to_bound = false) override;
+  /**
+   * Decodes an accepted word, e.g., one given by ModelEnumerator, into the values of the variables
+   * @param bits least significant bits first, sign bits are in the last transition for integers
+   * @return value of each variable of the formula
+   */
+  std::map<std::string, BigInteger> GetModelFromBits(const std::vector<bool>& bits);
+
+  BigInteger SymbolicCount(double bound, bool count_less_than_or_equal_to_bound = true) override;
   std::map<std::string,std::vector<std::string>> GetModelsWithinBound(int num_models, int bound) override;
 
 protected:
@@ -101,6 +113,32 @@ protected:
   static BinaryIntAutomaton_ptr MakeGreaterThan(ArithmeticFormula_ptr, bool is_natural_number);
   static BinaryIntAutomaton_ptr MakeGreaterThanOrEqual(ArithmeticFormula_ptr, bool is_natural_number);
   static BinaryIntAutomaton_ptr MakeTrimHelperAuto(int var_index, int number_of_variables);
+
+  /**
+   * Carry of a linear arithmetic automaton and a flag specific to the kind of the automaton
+   */
+  using CarryState = std::pair<int, int>;
+  static const CarryState SINK_CARRY_STATE;
+
+  /**
+   * Symbolic construction is used for formulas without booleans that have enough variables
+   */
+  static bool UseSymbolicConstruction(ArithmeticFormula_ptr formula);
+
+  /**
+   * Builds the transitions of each carry state directly as a bdd over the variables of the formula; a bdd node is
+   * identified by a variable and the partial sum of the coefficients above it, so the size is polynomial in the number
+   * of variables instead of enumerating every assignment.
+   * A transition into the initial state is redirected to a copy of it so that the initial state is never accepting.
+   * @param formula
+   * @param initial_state
+   * @param next_state carry state reached with the given sum of coefficients of the bits that are 1
+   * @param is_accepting
+   * @return a minimized dfa
+   */
+  static DFA_ptr MakeCarryDFA(ArithmeticFormula_ptr formula, const CarryState initial_state,
+                              std::function<CarryState(const CarryState&, const int)> next_state,
+                              std::function<bool(const CarryState&)> is_accepting);
   static void ComputeBinaryStates(std::vector<BinaryState_ptr>& binary_states,
           SemilinearSet_ptr semilinear_set);
   static void AddBinaryState(std::vector<BinaryState_ptr>& binary_states,
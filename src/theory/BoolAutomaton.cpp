@@ -71,6 +71,7 @@ BoolAutomaton_ptr BoolAutomaton::makeFalse(int num_of_variables,int* variable_in
 }
 
 void BoolAutomaton::toDot() {
+  DFAContext dfa_context;
   dfaPrintGraphviz(dfa, 0, nullptr);
 }
 
@@ -0,0 +1,39 @@
+/*
+ * DFAContext.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "DFAContext.h"
+
+namespace Vlab {
+namespace Theory {
+
+thread_local unsigned DFAContext::depth_ = 0;
+
+DFAContext::DFAContext() {
+  if (depth_ == 0) {
+    GetMutex().lock();
+  }
+  ++depth_;
+}
+
+DFAContext::~DFAContext() {
+  --depth_;
+  if (depth_ == 0) {
+    GetMutex().unlock();
+  }
+}
+
+bool DFAContext::IsHeld() {
+  return depth_ > 0;
+}
+
+std::mutex& DFAContext::GetMutex() {
+  static std::mutex mona_mutex;
+  return mona_mutex;
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
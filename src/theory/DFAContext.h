@@ -0,0 +1,46 @@
+/*
+ * DFAContext.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_DFACONTEXT_H_
+#define SRC_THEORY_DFACONTEXT_H_
+
+#include <mutex>
+
+namespace Vlab {
+namespace Theory {
+
+/**
+ * MONA keeps the dfa under construction (dfaSetup, dfaAllocExceptions, dfaStoreException, dfaStoreState, dfaBuild)
+ * and the state of several dfa and bdd operations in globals. A thread holds a context while it calls MONA;
+ * contexts nest within a thread and exclude each other across threads, so drivers in different threads can solve
+ * concurrently in one process.
+ */
+class DFAContext {
+ public:
+  DFAContext();
+  ~DFAContext();
+  DFAContext(const DFAContext&) = delete;
+  DFAContext& operator=(const DFAContext&) = delete;
+
+  /**
+   * @return true if the calling thread holds a context
+   */
+  static bool IsHeld();
+
+ private:
+  static std::mutex& GetMutex();
+
+  /**
+   * Number of contexts the thread holds, MONA is locked by the outermost one
+   */
+  static thread_local unsigned depth_;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_DFACONTEXT_H_ */
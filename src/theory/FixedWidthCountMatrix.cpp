@@ -0,0 +1,246 @@
+/*
+ * FixedWidthCountMatrix.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "FixedWidthCountMatrix.h"
+
+namespace Vlab {
+namespace Theory {
+
+using uint128_t = unsigned __int128;
+
+const int FixedWidthCountMatrix::VLOG_LEVEL = 9;
+
+const std::size_t FixedWidthCountMatrix::PARALLEL_THRESHOLD = 1 << 15;
+
+FixedWidthCountMatrix::FixedWidthCountMatrix(const Eigen::SparseMatrix<BigInteger>& matrix)
+    : is_fixed_width_ {true}, size_ (matrix.rows()), max_row_sum_ {0} {
+  const BigInteger max_value = std::numeric_limits<uint64_t>::max();
+  std::vector<BigInteger> row_sums(size_, 0);
+
+  row_offsets_.resize(size_ + 1, 0);
+  for (int column = 0; column < matrix.outerSize(); ++column) {
+    for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(matrix, column); it; ++it) {
+      ++row_offsets_[it.row() + 1];
+    }
+  }
+  for (std::size_t row = 0; row < size_; ++row) {
+    row_offsets_[row + 1] += row_offsets_[row];
+  }
+
+  std::vector<std::size_t> next(row_offsets_.begin(), row_offsets_.end() - 1);
+  columns_.resize(row_offsets_[size_]);
+  big_values_.resize(row_offsets_[size_]);
+  values_.resize(row_offsets_[size_], 0);
+  for (int column = 0; column < matrix.outerSize(); ++column) {
+    for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(matrix, column); it; ++it) {
+      const std::size_t entry = next[it.row()]++;
+      columns_[entry] = column;
+      big_values_[entry] = it.value();
+      row_sums[it.row()] += it.value();
+      if (it.value() < 0 or it.value() > max_value) {
+        is_fixed_width_ = false;
+      } else {
+        values_[entry] = static_cast<uint64_t>(it.value());
+      }
+    }
+  }
+
+  for (const auto& row_sum : row_sums) {
+    if (row_sum > max_row_sum_) {
+      max_row_sum_ = row_sum;
+    }
+  }
+}
+
+FixedWidthCountMatrix::~FixedWidthCountMatrix() {
+}
+
+bool FixedWidthCountMatrix::is_fixed_width() const {
+  return is_fixed_width_;
+}
+
+std::size_t FixedWidthCountMatrix::size() const {
+  return size_;
+}
+
+BigInteger FixedWidthCountMatrix::GetResultBitBound(const unsigned long power) const {
+  if (max_row_sum_ <= 1) {
+    return 1;
+  }
+  return BigInteger(power) * (boost::multiprecision::msb(max_row_sum_) + 1) + 1;
+}
+
+unsigned long FixedWidthCountMatrix::Multiply(std::vector<uint64_t>& count_vector, const unsigned long power) const {
+  const uint128_t max_value = std::numeric_limits<uint64_t>::max();
+  std::vector<uint64_t> next_vector(size_);
+  std::atomic<bool> is_overflow {false};
+  auto multiply_rows = [&](std::size_t start, std::size_t end) -> void {
+    for (std::size_t row = start; row < end; ++row) {
+      uint128_t sum = 0;
+      for (std::size_t entry = row_offsets_[row]; entry < row_offsets_[row + 1]; ++entry) {
+        sum += static_cast<uint128_t>(values_[entry]) * count_vector[columns_[entry]];
+        if (sum > max_value) {
+          is_overflow = true;
+          return;
+        }
+      }
+      next_vector[row] = static_cast<uint64_t>(sum);
+    }
+  };
+
+  for (unsigned long step = 0; step < power; ++step) {
+    ForEachRowRange(multiply_rows);
+    if (is_overflow) {
+      DVLOG(VLOG_LEVEL) << "64 bit count overflows after " << step << " steps";
+      return step;
+    }
+    count_vector.swap(next_vector);
+  }
+  return power;
+}
+
+void FixedWidthCountMatrix::MultiplyModular(std::vector<uint64_t>& count_vector, const std::vector<uint64_t>& primes,
+                                            const unsigned long power) const {
+  // products are below 2^122, 32 of them can be accumulated before reducing
+  const std::size_t k = primes.size();
+  const std::size_t reduce_period = 32;
+
+  std::vector<uint64_t> modular_values(values_.size() * k);
+  for (std::size_t entry = 0; entry < big_values_.size(); ++entry) {
+    for (std::size_t i = 0; i < k; ++i) {
+      modular_values[entry * k + i] = static_cast<uint64_t>(big_values_[entry] % primes[i]);
+    }
+  }
+
+  std::vector<uint64_t> next_vector(size_ * k);
+  auto multiply_rows = [&](std::size_t start, std::size_t end) -> void {
+    std::vector<uint128_t> sums(k);
+    for (std::size_t row = start; row < end; ++row) {
+      std::fill(sums.begin(), sums.end(), 0);
+      std::size_t pending = 0;
+      for (std::size_t entry = row_offsets_[row]; entry < row_offsets_[row + 1]; ++entry) {
+        const uint64_t* value = &modular_values[entry * k];
+        const uint64_t* count = &count_vector[columns_[entry] * k];
+        for (std::size_t i = 0; i < k; ++i) {
+          sums[i] += static_cast<uint128_t>(value[i]) * count[i];
+        }
+        if (++pending == reduce_period) {
+          for (std::size_t i = 0; i < k; ++i) {
+            sums[i] %= primes[i];
+          }
+          pending = 0;
+        }
+      }
+      uint64_t* next = &next_vector[row * k];
+      for (std::size_t i = 0; i < k; ++i) {
+        next[i] = static_cast<uint64_t>(sums[i] % primes[i]);
+      }
+    }
+  };
+
+  for (unsigned long step = 0; step < power; ++step) {
+    ForEachRowRange(multiply_rows);
+    count_vector.swap(next_vector);
+  }
+}
+
+/**
+ * Runs the row kernel over all rows, partitioned on the shared thread pool when the matrix is large enough.
+ */
+void FixedWidthCountMatrix::ForEachRowRange(const std::function<void(std::size_t, std::size_t)>& multiply_rows) const {
+  if (columns_.size() < PARALLEL_THRESHOLD) {
+    multiply_rows(0, size_);
+  } else {
+    Util::ThreadPool::GetInstance().ParallelFor(0, size_, multiply_rows);
+  }
+}
+
+std::vector<uint64_t> FixedWidthCountMatrix::GetPrimes(const std::size_t num_of_primes) {
+  std::vector<uint64_t> primes;
+  uint64_t candidate = (static_cast<uint64_t>(1) << 61) - 1;
+  while (primes.size() < num_of_primes) {
+    if (IsPrime(candidate)) {
+      primes.push_back(candidate);
+    }
+    candidate -= 2;
+  }
+  return primes;
+}
+
+BigInteger FixedWidthCountMatrix::ReconstructFromResidues(const uint64_t* residues, const std::vector<uint64_t>& primes) {
+  BigInteger modulus = 1;
+  for (auto p : primes) {
+    modulus *= p;
+  }
+
+  BigInteger result = 0;
+  for (std::size_t i = 0; i < primes.size(); ++i) {
+    BigInteger partial_modulus = modulus / primes[i];
+    const uint64_t partial_residue = static_cast<uint64_t>(partial_modulus % primes[i]);
+    const uint64_t inverse = PowerModulo(partial_residue, primes[i] - 2, primes[i]);
+    result += partial_modulus * MultiplyModulo(residues[i], inverse, primes[i]);
+  }
+  return result % modulus;
+}
+
+/**
+ * Deterministic Miller-Rabin for 64 bit integers
+ */
+bool FixedWidthCountMatrix::IsPrime(const uint64_t n) {
+  if (n < 2) {
+    return false;
+  }
+  const uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+  for (auto b : bases) {
+    if (n % b == 0) {
+      return n == b;
+    }
+  }
+
+  uint64_t d = n - 1;
+  int r = 0;
+  while ((d & 1) == 0) {
+    d >>= 1;
+    ++r;
+  }
+
+  for (auto b : bases) {
+    uint64_t x = PowerModulo(b, d, n);
+    if (x == 1 or x == n - 1) {
+      continue;
+    }
+    bool is_composite = true;
+    for (int i = 1; i < r and is_composite; ++i) {
+      x = MultiplyModulo(x, x, n);
+      is_composite = (x != n - 1);
+    }
+    if (is_composite) {
+      return false;
+    }
+  }
+  return true;
+}
+
+uint64_t FixedWidthCountMatrix::MultiplyModulo(const uint64_t x, const uint64_t y, const uint64_t modulus) {
+  return static_cast<uint64_t>(static_cast<uint128_t>(x) * y % modulus);
+}
+
+uint64_t FixedWidthCountMatrix::PowerModulo(uint64_t base, uint64_t exponent, const uint64_t modulus) {
+  uint64_t result = 1;
+  base %= modulus;
+  while (exponent > 0) {
+    if (exponent & 1) {
+      result = MultiplyModulo(result, base, modulus);
+    }
+    base = MultiplyModulo(base, base, modulus);
+    exponent >>= 1;
+  }
+  return result;
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,96 @@
+/*
+ * FixedWidthCountMatrix.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_FIXEDWIDTHCOUNTMATRIX_H_
+#define SRC_THEORY_FIXEDWIDTHCOUNTMATRIX_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "../boost/multiprecision/cpp_int.hpp"
+#include "../Eigen/SparseCore"
+#include "../utils/Math.h"
+#include "../utils/ThreadPool.h"
+
+namespace Vlab {
+namespace Theory {
+
+/**
+ * Row compressed copy of a transition count matrix with machine word entries.
+ * Count vectors are propagated with 64 bit words (128 bit accumulators) until they overflow, or modulo a set of
+ * 61 bit primes where the exact count is reconstructed with the chinese remainder theorem at the end.
+ */
+class FixedWidthCountMatrix {
+ public:
+  explicit FixedWidthCountMatrix(const Eigen::SparseMatrix<BigInteger>& matrix);
+  virtual ~FixedWidthCountMatrix();
+
+  /**
+   * @return true if all entries of the matrix fit in 64 bits
+   */
+  bool is_fixed_width() const;
+  std::size_t size() const;
+
+  /**
+   * Upper bound on the number of bits of any entry of matrix^power * vector where vector entries are 0 or 1.
+   * @param power
+   * @return
+   */
+  BigInteger GetResultBitBound(const unsigned long power) const;
+
+  /**
+   * Count vector is replaced by matrix * count vector, 'power' times; stops before an entry overflows 64 bits.
+   * @param count_vector
+   * @param power
+   * @return number of multiplications done
+   */
+  unsigned long Multiply(std::vector<uint64_t>& count_vector, const unsigned long power) const;
+
+  /**
+   * Count vector holds residues modulo each prime, residues of a state are consecutive:
+   * count_vector[state * primes.size() + i] is the residue modulo primes[i].
+   * @param count_vector
+   * @param primes
+   * @param power
+   */
+  void MultiplyModular(std::vector<uint64_t>& count_vector, const std::vector<uint64_t>& primes,
+                       const unsigned long power) const;
+
+  /**
+   * @param num_of_primes
+   * @return largest primes below 2^61
+   */
+  static std::vector<uint64_t> GetPrimes(const std::size_t num_of_primes);
+  static BigInteger ReconstructFromResidues(const uint64_t* residues, const std::vector<uint64_t>& primes);
+ protected:
+  static bool IsPrime(const uint64_t n);
+  static uint64_t MultiplyModulo(const uint64_t x, const uint64_t y, const uint64_t modulus);
+  static uint64_t PowerModulo(uint64_t base, uint64_t exponent, const uint64_t modulus);
+  void ForEachRowRange(const std::function<void(std::size_t, std::size_t)>& multiply_rows) const;
+
+  bool is_fixed_width_;
+  std::size_t size_;
+  BigInteger max_row_sum_;
+  std::vector<std::size_t> row_offsets_;
+  std::vector<std::size_t> columns_;
+  std::vector<uint64_t> values_;
+  std::vector<BigInteger> big_values_;
+ private:
+  static const int VLOG_LEVEL;
+  static const std::size_t PARALLEL_THRESHOLD;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_FIXEDWIDTHCOUNTMATRIX_H_ */
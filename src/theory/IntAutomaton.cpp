@@ -78,6 +78,7 @@ IntAutomaton_ptr IntAutomaton::makePhi(int num_of_variables) {
 }
 
 IntAutomaton_ptr IntAutomaton::makeZero(int num_of_variables) {
+  DFAContext dfa_context;
   DFA_ptr zero_int_dfa = nullptr;
   IntAutomaton_ptr zero_int = nullptr;
   char statuses[2] { '+', '-' };
@@ -101,6 +102,7 @@ IntAutomaton_ptr IntAutomaton::makeZero(int num_of_variables) {
  *
  */
 IntAutomaton_ptr IntAutomaton::makeAnyInt(int num_of_variables) {
+  DFAContext dfa_context;
   DFA_ptr any_int_dfa = nullptr;
   IntAutomaton_ptr any_int = nullptr;
   char statuses[1] { '+' };
@@ -258,6 +260,7 @@ bool IntAutomaton::hasNegative1() {
   return has_negative_1;
 }
 IntAutomaton_ptr IntAutomaton::complement() {
+  DFAContext dfa_context;
   DFA_ptr complement_dfa = nullptr, minimized_dfa = nullptr, current_dfa = dfaCopy(dfa_);
   IntAutomaton_ptr complement_auto = nullptr;
   IntAutomaton_ptr any_int = IntAutomaton::makeAnyInt();
@@ -764,6 +767,7 @@ int IntAutomaton::getAnAcceptingInt() {
 }
 
 UnaryAutomaton_ptr IntAutomaton::toUnaryAutomaton() {
+  DFAContext dfa_context;
   UnaryAutomaton_ptr unary_auto = nullptr;
   DFA_ptr unary_dfa = nullptr;
   int number_of_variables = 1;
@@ -0,0 +1,196 @@
+/*
+ * LinearRecurrence.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "LinearRecurrence.h"
+
+namespace Vlab {
+namespace Theory {
+
+using BigRational = boost::multiprecision::cpp_rational;
+
+const int LinearRecurrence::VLOG_LEVEL = 9;
+
+LinearRecurrence::LinearRecurrence() {
+}
+
+LinearRecurrence::~LinearRecurrence() {
+}
+
+LinearRecurrence LinearRecurrence::Make(const std::vector<BigInteger>& sequence) {
+  // connection polynomial: a(n) + C[1] a(n-1) + ... + C[L] a(n-L) = 0
+  std::vector<BigRational> current {1}, previous {1};
+  std::size_t length = 0, shift = 1;
+  BigRational previous_discrepancy = 1;
+
+  for (std::size_t n = 0; n < sequence.size(); ++n) {
+    BigRational discrepancy = sequence[n];
+    for (std::size_t i = 1; i <= length and i < current.size(); ++i) {
+      discrepancy += current[i] * sequence[n - i];
+    }
+
+    if (discrepancy == 0) {
+      ++shift;
+      continue;
+    }
+
+    BigRational factor = discrepancy / previous_discrepancy;
+    std::vector<BigRational> updated = current;
+    if (updated.size() < previous.size() + shift) {
+      updated.resize(previous.size() + shift, 0);
+    }
+    for (std::size_t i = 0; i < previous.size(); ++i) {
+      updated[i + shift] -= factor * previous[i];
+    }
+
+    if (2 * length <= n) {
+      previous = current;
+      length = n + 1 - length;
+      previous_discrepancy = discrepancy;
+      shift = 1;
+    } else {
+      ++shift;
+    }
+    current = updated;
+  }
+
+  LinearRecurrence recurrence;
+  current.resize(length + 1, 0);
+  for (std::size_t i = 1; i <= length; ++i) {
+    CHECK_EQ(1, boost::multiprecision::denominator(current[i])) << "recurrence of an integer sequence must have integer coefficients";
+    recurrence.coefficients_.push_back(-boost::multiprecision::numerator(current[i]));
+  }
+  recurrence.initial_terms_.assign(sequence.begin(), sequence.begin() + std::min(length, sequence.size()));
+
+  DVLOG(VLOG_LEVEL) << "recurrence of order " << length << " from " << sequence.size() << " terms";
+  return recurrence;
+}
+
+std::size_t LinearRecurrence::order() const {
+  return coefficients_.size();
+}
+
+bool LinearRecurrence::is_empty() const {
+  return coefficients_.empty();
+}
+
+const std::vector<BigInteger>& LinearRecurrence::get_coefficients() const {
+  return coefficients_;
+}
+
+const std::vector<BigInteger>& LinearRecurrence::get_initial_terms() const {
+  return initial_terms_;
+}
+
+BigInteger LinearRecurrence::Evaluate(const BigInteger& n) const {
+  const std::size_t d = order();
+  if (d == 0) {
+    return 0;
+  }
+
+  if (n < d) {
+    return initial_terms_[static_cast<std::size_t>(n)];
+  }
+
+  // x^n mod characteristic polynomial, then a(n) is the same combination of the initial terms
+  std::vector<BigInteger> result(d, 0), base(d, 0);
+  result[0] = 1;
+  if (d == 1) {
+    base[0] = coefficients_[0];
+  } else {
+    base[1] = 1;
+  }
+
+  const std::size_t num_bits = boost::multiprecision::msb(n) + 1;
+  for (std::size_t bit = 0; bit < num_bits; ++bit) {
+    if (boost::multiprecision::bit_test(n, bit)) {
+      result = MultiplyModulo(result, base);
+    }
+    if (bit + 1 < num_bits) {
+      base = MultiplyModulo(base, base);
+    }
+  }
+
+  BigInteger value = 0;
+  for (std::size_t i = 0; i < d; ++i) {
+    value += result[i] * initial_terms_[i];
+  }
+
+  DVLOG(VLOG_LEVEL) << "Evaluate(" << n << ") = " << value;
+  return value;
+}
+
+LinearRecurrence LinearRecurrence::PartialSums() const {
+  LinearRecurrence partial_sums;
+  const std::size_t d = order();
+
+  // x^(d+1) - (1 + c1) x^d - (c2 - c1) x^(d-1) - ... - (cd - c(d-1)) x + cd
+  partial_sums.coefficients_.resize(d + 1, 0);
+  for (std::size_t i = 0; i < d; ++i) {
+    partial_sums.coefficients_[i] += coefficients_[i];
+    partial_sums.coefficients_[i + 1] -= coefficients_[i];
+  }
+  partial_sums.coefficients_[0] += 1;
+
+  BigInteger sum = 0;
+  for (std::size_t i = 0; i <= d; ++i) {
+    sum += Evaluate(i);
+    partial_sums.initial_terms_.push_back(sum);
+  }
+
+  return partial_sums;
+}
+
+std::vector<BigInteger> LinearRecurrence::MultiplyModulo(const std::vector<BigInteger>& x,
+                                                         const std::vector<BigInteger>& y) const {
+  const std::size_t d = order();
+  std::vector<BigInteger> product(2 * d - 1, 0);
+  for (std::size_t i = 0; i < d; ++i) {
+    if (x[i] == 0) {
+      continue;
+    }
+    for (std::size_t j = 0; j < d; ++j) {
+      if (y[j] != 0) {
+        product[i + j] += x[i] * y[j];
+      }
+    }
+  }
+
+  // x^k = c1 x^(k-1) + ... + cd x^(k-d) for k >= d
+  for (std::size_t k = product.size() - 1; k >= d; --k) {
+    if (product[k] == 0) {
+      continue;
+    }
+    for (std::size_t i = 0; i < d; ++i) {
+      product[k - 1 - i] += product[k] * coefficients_[i];
+    }
+  }
+  product.resize(d);
+  return product;
+}
+
+std::string LinearRecurrence::str() const {
+  std::stringstream ss;
+  ss << "order         : " << order() << std::endl;
+  ss << "coefficients  : ";
+  for (const auto& c : coefficients_) {
+    ss << c << " ";
+  }
+  ss << std::endl;
+  ss << "initial terms : ";
+  for (const auto& t : initial_terms_) {
+    ss << t << " ";
+  }
+  ss << std::endl;
+  return ss.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const LinearRecurrence& lr) {
+  return os << lr.str();
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
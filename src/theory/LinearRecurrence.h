@@ -0,0 +1,91 @@
+/*
+ * LinearRecurrence.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_LINEARRECURRENCE_H_
+#define SRC_THEORY_LINEARRECURRENCE_H_
+
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "../utils/Serialize.h"
+
+namespace Vlab {
+namespace Theory {
+
+/**
+ * A linear recurrence a(n) = c(1) * a(n-1) + ... + c(d) * a(n-d) for n >= d,
+ * together with the initial terms a(0), ..., a(d-1).
+ * Model counts of an automaton satisfy such a recurrence whose order is at most the size of the transition count
+ * matrix; once the recurrence is known a(n) is evaluated with O(d^2 log n) big integer operations.
+ */
+class LinearRecurrence {
+ public:
+  LinearRecurrence();
+  virtual ~LinearRecurrence();
+
+  /**
+   * Finds the shortest linear recurrence that generates the given sequence (Berlekamp-Massey over rationals).
+   * The result is exact when the sequence has at least twice as many terms as the order of the recurrence.
+   * @param sequence
+   * @return
+   */
+  static LinearRecurrence Make(const std::vector<BigInteger>& sequence);
+
+  std::size_t order() const;
+  bool is_empty() const;
+  const std::vector<BigInteger>& get_coefficients() const;
+  const std::vector<BigInteger>& get_initial_terms() const;
+
+  /**
+   * Computes the n^th term of the sequence by reducing x^n modulo the characteristic polynomial.
+   * @param n
+   * @return
+   */
+  BigInteger Evaluate(const BigInteger& n) const;
+
+  /**
+   * Generates the recurrence of the partial sums s(n) = a(0) + ... + a(n),
+   * characteristic polynomial is multiplied by (x - 1).
+   * @return
+   */
+  LinearRecurrence PartialSums() const;
+
+  template <class Archive>
+  void save(Archive& ar) const {
+    Util::Serialize::save(ar, coefficients_);
+    Util::Serialize::save(ar, initial_terms_);
+  }
+
+  template <class Archive>
+  void load(Archive& ar) {
+    Util::Serialize::load(ar, coefficients_);
+    Util::Serialize::load(ar, initial_terms_);
+  }
+
+  std::string str() const;
+  friend std::ostream& operator<<(std::ostream& os, const LinearRecurrence& lr);
+ protected:
+  /**
+   * Multiplies two polynomials (coefficient i is for x^i) of degree less than the order and reduces the result modulo
+   * the characteristic polynomial x^d - c(1) x^(d-1) - ... - c(d).
+   */
+  std::vector<BigInteger> MultiplyModulo(const std::vector<BigInteger>& x, const std::vector<BigInteger>& y) const;
+
+  std::vector<BigInteger> coefficients_;
+  std::vector<BigInteger> initial_terms_;
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_LINEARRECURRENCE_H_ */
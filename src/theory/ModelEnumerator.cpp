@@ -0,0 +1,269 @@
+/*
+ * ModelEnumerator.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ModelEnumerator.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include "DFAContext.h"
+
+namespace Vlab {
+namespace Theory {
+
+const int ModelEnumerator::VLOG_LEVEL = 12;
+
+ModelEnumerator::ModelEnumerator(Automaton_ptr automaton)
+    : dfa_ {automaton->getDFA()},
+      num_of_bdd_variables_ {automaton->get_number_of_bdd_variables()},
+      is_length_limited_ {true},
+      max_length_ {0},
+      length_ {0},
+      has_next_ {false} {
+  Initialize(automaton, false, 0);
+}
+
+ModelEnumerator::ModelEnumerator(Automaton_ptr automaton, const unsigned long bound)
+    : dfa_ {automaton->getDFA()},
+      num_of_bdd_variables_ {automaton->get_number_of_bdd_variables()},
+      is_length_limited_ {true},
+      max_length_ {0},
+      length_ {0},
+      has_next_ {false} {
+  Initialize(automaton, true, bound);
+}
+
+ModelEnumerator::~ModelEnumerator() {
+}
+
+bool ModelEnumerator::HasNext() const {
+  return has_next_;
+}
+
+std::vector<bool> ModelEnumerator::Next() {
+  CHECK(has_next_) << "no more models";
+  std::vector<bool> word = next_word_;
+  FindNext();
+  return word;
+}
+
+unsigned long ModelEnumerator::get_length() const {
+  return length_;
+}
+
+int ModelEnumerator::get_num_of_states() const {
+  return dfa_->ns;
+}
+
+/**
+ * Words are not limited only if there is no bound and the language is infinite; an infinite language has words of
+ * some length among any number of states consecutive lengths, so the search for the next word always ends
+ */
+void ModelEnumerator::Initialize(Automaton_ptr automaton, const bool has_bound, const unsigned long bound) {
+  DFAContext dfa_context;
+  distances_ = automaton->GetDistancesToAcceptingStates();
+  next_states_.resize(dfa_->ns);
+  for (int s = 0; s < dfa_->ns; ++s) {
+    next_states_[s] = GetNextStates(s);
+  }
+  AddAcceptingLengths(0);
+
+  unsigned long longest_length = 0;
+  if (num_of_bdd_variables_ == 0 or distances_[dfa_->s] == INT_MAX) {
+    max_length_ = 0;
+  } else if (GetLongestLength(longest_length)) {
+    max_length_ = has_bound ? std::min(bound, longest_length) : longest_length;
+  } else if (has_bound) {
+    max_length_ = bound;
+  } else {
+    is_length_limited_ = false;
+  }
+
+  if (dfa_->f[dfa_->s] == 1) {
+    has_next_ = true;
+  } else {
+    FindNext();
+  }
+  DVLOG(VLOG_LEVEL) << "model enumerator over words up to length "
+                    << (is_length_limited_ ? std::to_string(max_length_) : std::string("any"));
+}
+
+void ModelEnumerator::FindNext() {
+  has_next_ = false;
+  while (not Search()) {
+    if (is_length_limited_ and length_ >= max_length_) {
+      return;
+    }
+    ++length_;
+    AddAcceptingLengths(length_);
+    word_.assign(length_ * num_of_bdd_variables_, false);
+    if (is_accepting_at_length_[length_][dfa_->s]) {
+      frames_.push_back({dfa_->q[dfa_->s], 0});
+    }
+  }
+  next_word_ = word_;
+  has_next_ = true;
+}
+
+/**
+ * Frame at position d decides bit d % num_of_bdd_variables of transition d / num_of_bdd_variables; a bit that is not
+ * tested on the bdd path is free and keeps the node. 0 is tried before 1, which gives the lexicographic order.
+ */
+bool ModelEnumerator::Search() {
+  unsigned left, right, index;  // BDD traversal variables
+  while (not frames_.empty()) {
+    Frame& frame = frames_.back();
+    if (frame.next_bit > 1) {
+      frames_.pop_back();
+      continue;
+    }
+
+    const std::size_t position = frames_.size() - 1;
+    const unsigned long transition = position / num_of_bdd_variables_;
+    const unsigned bit_index = position % num_of_bdd_variables_;
+    const bool bit = (frame.next_bit == 1);
+    ++frame.next_bit;
+
+    unsigned next_node = frame.node;
+    LOAD_lri(&dfa_->bddm->node_table[frame.node], left, right, index);
+    if (index == bit_index) {
+      next_node = (bit ? right : left);
+    }
+    const unsigned long remaining_length = length_ - transition - 1;
+    if (not CanAccept(next_node, remaining_length)) {
+      continue;
+    }
+    word_[position] = bit;
+
+    if (bit_index + 1 < static_cast<unsigned>(num_of_bdd_variables_)) {
+      frames_.push_back({next_node, 0});
+      continue;
+    }
+    LOAD_lri(&dfa_->bddm->node_table[next_node], left, right, index);
+    const int next_state = left;
+    if (remaining_length == 0) {
+      if (dfa_->f[next_state] == 1) {
+        return true;
+      }
+    } else {
+      frames_.push_back({dfa_->q[next_state], 0});
+    }
+  }
+  return false;
+}
+
+/**
+ * Longest accepted suffixes are computed in post order over the states that can reach an accepting state, a cycle
+ * among them makes the language infinite.
+ */
+bool ModelEnumerator::GetLongestLength(unsigned long& length) const {
+  enum class Status : char { NEW, ON_STACK, DONE };
+  struct Visit {
+    int state;
+    std::size_t next_index;
+  };
+  std::vector<Status> status(dfa_->ns, Status::NEW);
+  std::vector<unsigned long> longest_suffix(dfa_->ns, 0);
+  std::vector<Visit> visits;
+  visits.push_back({dfa_->s, 0});
+  status[dfa_->s] = Status::ON_STACK;
+  while (not visits.empty()) {
+    Visit& visit = visits.back();
+    const std::vector<int>& next_states = next_states_[visit.state];
+    if (visit.next_index < next_states.size()) {
+      const int next_state = next_states[visit.next_index++];
+      if (status[next_state] == Status::ON_STACK) {
+        return false;
+      } else if (status[next_state] == Status::NEW) {
+        status[next_state] = Status::ON_STACK;
+        visits.push_back({next_state, 0});
+      }
+      continue;
+    }
+
+    for (const int next_state : next_states) {
+      longest_suffix[visit.state] = std::max(longest_suffix[visit.state], longest_suffix[next_state] + 1);
+    }
+    status[visit.state] = Status::DONE;
+    visits.pop_back();
+  }
+  length = longest_suffix[dfa_->s];
+  return true;
+}
+
+bool ModelEnumerator::CanAccept(const unsigned node, const unsigned long length) {
+  auto& node_accepting = node_accepting_at_length_[length];
+  auto it = node_accepting.find(node);
+  if (it != node_accepting.end()) {
+    return it->second;
+  }
+  unsigned left, right, index;  // BDD traversal variables
+  LOAD_lri(&dfa_->bddm->node_table[node], left, right, index);
+  bool can_accept = false;
+  if (index == BDD_LEAF_INDEX) {
+    can_accept = is_accepting_at_length_[length][left];
+  } else {
+    can_accept = CanAccept(left, length) or CanAccept(right, length);
+  }
+  node_accepting_at_length_[length][node] = can_accept;
+  return can_accept;
+}
+
+/**
+ * A state accepts a word of length l if it is accepting and l is 0, or one of its next states accepts a word of
+ * length l - 1
+ */
+void ModelEnumerator::AddAcceptingLengths(const unsigned long length) {
+  while (is_accepting_at_length_.size() <= length) {
+    const std::size_t current_length = is_accepting_at_length_.size();
+    std::vector<bool> is_accepting(dfa_->ns, false);
+    for (int s = 0; s < dfa_->ns; ++s) {
+      if (current_length == 0) {
+        is_accepting[s] = (dfa_->f[s] == 1);
+        continue;
+      }
+      for (const int next_state : next_states_[s]) {
+        if (is_accepting_at_length_[current_length - 1][next_state]) {
+          is_accepting[s] = true;
+          break;
+        }
+      }
+    }
+    is_accepting_at_length_.push_back(std::move(is_accepting));
+    node_accepting_at_length_.emplace_back();
+  }
+}
+
+/**
+ * @return next states that can reach an accepting state
+ */
+std::vector<int> ModelEnumerator::GetNextStates(const int state) const {
+  std::vector<int> next_states;
+  std::unordered_set<unsigned> visited;
+  std::vector<unsigned> nodes {dfa_->q[state]};
+  unsigned left, right, index;  // BDD traversal variables
+  while (not nodes.empty()) {
+    const unsigned node = nodes.back();
+    nodes.pop_back();
+    if (not visited.insert(node).second) {
+      continue;
+    }
+    LOAD_lri(&dfa_->bddm->node_table[node], left, right, index);
+    if (index == BDD_LEAF_INDEX) {
+      if (distances_[left] != INT_MAX and std::find(next_states.begin(), next_states.end(), left) == next_states.end()) {
+        next_states.push_back(left);
+      }
+    } else {
+      nodes.push_back(left);
+      nodes.push_back(right);
+    }
+  }
+  return next_states;
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
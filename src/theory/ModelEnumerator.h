@@ -0,0 +1,114 @@
+/*
+ * ModelEnumerator.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_MODELENUMERATOR_H_
+#define SRC_THEORY_MODELENUMERATOR_H_
+
+#include <climits>
+#include <unordered_map>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "Automaton.h"
+
+namespace Vlab {
+namespace Theory {
+
+/**
+ * Enumerates accepted words of an automaton in length and then lexicographic order, one word per call.
+ * The states that accept a word of exactly each length are tabulated as longer words are searched; words are searched
+ * with an explicit stack over the bits of the transitions, branches that cannot accept a word of exactly the remaining
+ * length are never expanded.
+ * Words are bit vectors in the format of Automaton::getAnAcceptingWord, one block of bdd variables per transition.
+ */
+class ModelEnumerator {
+ public:
+  /**
+   * Enumerates words of any length, an infinite language is enumerated until the caller stops
+   * @param automaton is not copied, it must outlive the enumerator
+   */
+  ModelEnumerator(Automaton_ptr automaton);
+  /**
+   * @param automaton is not copied, it must outlive the enumerator
+   * @param bound length bound in number of transitions
+   */
+  ModelEnumerator(Automaton_ptr automaton, const unsigned long bound);
+  virtual ~ModelEnumerator();
+
+  bool HasNext() const;
+  std::vector<bool> Next();
+  /**
+   * @return length of the word Next returns, in number of transitions
+   */
+  unsigned long get_length() const;
+  int get_num_of_states() const;
+
+ protected:
+  /**
+   * A bdd node to read the bit at the frame's position from, and the next value of that bit to try
+   */
+  struct Frame {
+    unsigned node;
+    int next_bit;
+  };
+
+  void Initialize(Automaton_ptr automaton, const bool has_bound, const unsigned long bound);
+
+  /**
+   * Moves to the next accepted word, tries longer words once the current length is exhausted
+   */
+  void FindNext();
+
+  /**
+   * Resumes the search for a word of the current length
+   * @return false if there are no more words of the current length
+   */
+  bool Search();
+
+  /**
+   * @param length set to the length of a longest accepted word
+   * @return false if accepted words can be arbitrarily long
+   */
+  bool GetLongestLength(unsigned long& length) const;
+
+  /**
+   * @return true if an accepted word of exactly the given length is read from a state reachable from the bdd node
+   */
+  bool CanAccept(const unsigned node, const unsigned long length);
+  void AddAcceptingLengths(const unsigned long length);
+  std::vector<int> GetNextStates(const int state) const;
+
+  DFA_ptr dfa_;
+  int num_of_bdd_variables_;
+  /**
+   * Words longer than max_length_ are not searched if the length is limited
+   */
+  bool is_length_limited_;
+  unsigned long max_length_;
+  unsigned long length_;
+  bool has_next_;
+  std::vector<int> distances_;
+  std::vector<std::vector<int>> next_states_;
+  /**
+   * is_accepting_at_length_[l][s] is true if state s accepts a word of exactly length l, rows are added up to the
+   * current length
+   */
+  std::vector<std::vector<bool>> is_accepting_at_length_;
+  std::vector<std::unordered_map<unsigned, bool>> node_accepting_at_length_;
+  std::vector<Frame> frames_;
+  std::vector<bool> word_;
+  std::vector<bool> next_word_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_MODELENUMERATOR_H_ */
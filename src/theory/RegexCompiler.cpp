@@ -0,0 +1,379 @@
+/*
+ * RegexCompiler.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "RegexCompiler.h"
+
+#include <algorithm>
+#include <set>
+
+namespace Vlab {
+namespace Theory {
+
+const int RegexCompiler::VLOG_LEVEL = 12;
+
+const unsigned long RegexCompiler::UNBOUNDED = ULONG_MAX;
+
+RegexCompiler::RegexCompiler(const int number_of_bdd_variables, int* variable_indices)
+    : number_of_bdd_variables_ {number_of_bdd_variables},
+      variable_indices_ {variable_indices},
+      max_character_ {(1UL << number_of_bdd_variables) - 1},
+      any_string_ {-1} {
+  empty_ = MakeTerm(Kind::EMPTY, {}, 0, 0, {}, false);
+  epsilon_ = MakeTerm(Kind::EPSILON, {}, 0, 0, {}, true);
+  any_string_ = MakeStar(MakeChars(0, max_character_));
+}
+
+RegexCompiler::~RegexCompiler() {
+}
+
+DFA_ptr RegexCompiler::Compile(Util::RegularExpression_ptr regular_expression) {
+  const int initial_term = Translate(regular_expression);
+
+  // characters in the same interval have the same derivatives
+  std::set<unsigned long> boundaries {0};
+  for (const auto& term : terms_) {
+    for (const auto& interval : term.intervals) {
+      boundaries.insert(interval.first);
+      if (interval.second < max_character_) {
+        boundaries.insert(interval.second + 1);
+      }
+    }
+  }
+  std::vector<Interval> blocks;
+  for (auto it = boundaries.begin(); it != boundaries.end(); ++it) {
+    auto next_it = std::next(it);
+    blocks.push_back({*it, (next_it == boundaries.end()) ? max_character_ : *next_it - 1});
+  }
+
+  // each distinct derivative is a state
+  std::map<int, int> state_ids {{initial_term, 0}};
+  std::vector<int> states {initial_term};
+  std::vector<std::vector<int>> transitions;
+  for (std::size_t s = 0; s < states.size(); ++s) {
+    std::vector<int> next_states;
+    for (const auto& block : blocks) {
+      const int derivative = Derivative(states[s], block.first);
+      auto it = state_ids.find(derivative);
+      if (it == state_ids.end()) {
+        it = state_ids.insert({derivative, states.size()}).first;
+        states.push_back(derivative);
+      }
+      next_states.push_back(it->second);
+    }
+    transitions.push_back(next_states);
+  }
+
+  const int number_of_states = states.size();
+  std::string statuses(number_of_states, '-');
+  dfaSetup(number_of_states, number_of_bdd_variables_, variable_indices_);
+  for (int s = 0; s < number_of_states; ++s) {
+    // neighbouring intervals with the same next state are merged, the most common next state is the default
+    std::map<int, std::vector<std::string>> paths;
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+      std::size_t j = i;
+      while (j + 1 < blocks.size() and transitions[s][j + 1] == transitions[s][i]) {
+        ++j;
+      }
+      auto& next_state_paths = paths[transitions[s][i]];
+      for (auto& path : GetPaths({blocks[i].first, blocks[j].second})) {
+        next_state_paths.push_back(path);
+      }
+      i = j;
+    }
+
+    int default_state = paths.begin()->first;
+    int number_of_exceptions = 0;
+    for (auto& path_entry : paths) {
+      number_of_exceptions += path_entry.second.size();
+      if (path_entry.second.size() > paths[default_state].size()) {
+        default_state = path_entry.first;
+      }
+    }
+    number_of_exceptions -= paths[default_state].size();
+
+    dfaAllocExceptions(number_of_exceptions);
+    for (auto& path_entry : paths) {
+      if (path_entry.first == default_state) {
+        continue;
+      }
+      for (auto& path : path_entry.second) {
+        dfaStoreException(path_entry.first, const_cast<char*>(path.data()));
+      }
+    }
+    dfaStoreState(default_state);
+    if (terms_[states[s]].is_nullable) {
+      statuses[s] = '+';
+    }
+  }
+
+  DFA_ptr regex_dfa = dfaBuild(&statuses[0]);
+  DFA_ptr minimized_dfa = dfaMinimize(regex_dfa);
+  dfaFree(regex_dfa);
+  DVLOG(VLOG_LEVEL) << "compiled regex into " << number_of_states << " states over " << blocks.size()
+                    << " character intervals, " << minimized_dfa->ns << " states after minimization";
+  return minimized_dfa;
+}
+
+int RegexCompiler::Translate(Util::RegularExpression_ptr regular_expression) {
+  switch (regular_expression->type()) {
+    case Util::RegularExpression::Type::UNION:
+      return MakeUnion({Translate(regular_expression->get_expr1()), Translate(regular_expression->get_expr2())});
+    case Util::RegularExpression::Type::CONCATENATION: {
+      const int left = Translate(regular_expression->get_expr1());
+      return MakeConcat(left, Translate(regular_expression->get_expr2()));
+    }
+    case Util::RegularExpression::Type::INTERSECTION:
+      return MakeIntersect({Translate(regular_expression->get_expr1()), Translate(regular_expression->get_expr2())});
+    case Util::RegularExpression::Type::OPTIONAL:
+      return MakeUnion({epsilon_, Translate(regular_expression->get_expr1())});
+    case Util::RegularExpression::Type::REPEAT_STAR:
+      return MakeStar(Translate(regular_expression->get_expr1()));
+    case Util::RegularExpression::Type::REPEAT_PLUS:
+      return MakeRepeat(Translate(regular_expression->get_expr1()), 1, UNBOUNDED);
+    case Util::RegularExpression::Type::REPEAT_MIN:
+      return MakeRepeat(Translate(regular_expression->get_expr1()), regular_expression->get_min(), UNBOUNDED);
+    case Util::RegularExpression::Type::REPEAT_MINMAX:
+      return MakeRepeat(Translate(regular_expression->get_expr1()), regular_expression->get_min(),
+                        regular_expression->get_max());
+    case Util::RegularExpression::Type::COMPLEMENT:
+      return MakeComplement(Translate(regular_expression->get_expr1()));
+    case Util::RegularExpression::Type::CHAR: {
+      const unsigned long character = static_cast<unsigned long>(regular_expression->get_character()) & max_character_;
+      return MakeChars(character, character);
+    }
+    case Util::RegularExpression::Type::CHAR_RANGE:
+      return MakeChars(static_cast<unsigned long>(regular_expression->get_from_character()) & max_character_,
+                       static_cast<unsigned long>(regular_expression->get_to_character()) & max_character_);
+    case Util::RegularExpression::Type::ANYCHAR:
+      return MakeChars(0, max_character_);
+    case Util::RegularExpression::Type::EMPTY:
+      return empty_;
+    case Util::RegularExpression::Type::STRING:
+      return MakeString(regular_expression->get_string());
+    case Util::RegularExpression::Type::ANYSTRING:
+      return any_string_;
+    default:
+      LOG(FATAL)<< "Unsupported regular expression" << *regular_expression;
+      break;
+  }
+  return empty_;
+}
+
+int RegexCompiler::MakeTerm(const Kind kind, const std::vector<int>& children, const unsigned long min,
+                            const unsigned long max, const std::vector<Interval>& intervals, const bool is_nullable) {
+  auto key = std::make_tuple(static_cast<int>(kind), children, min, max, intervals);
+  auto it = term_ids_.find(key);
+  if (it != term_ids_.end()) {
+    return it->second;
+  }
+  const int term_id = terms_.size();
+  terms_.push_back({kind, children, min, max, intervals, is_nullable});
+  term_ids_[key] = term_id;
+  return term_id;
+}
+
+int RegexCompiler::MakeChars(unsigned long from, unsigned long to) {
+  if (from > to) {
+    std::swap(from, to);
+  }
+  return MakeTerm(Kind::CHARS, {}, 0, 0, {{from, to}}, false);
+}
+
+int RegexCompiler::MakeString(const std::string& str) {
+  int result = epsilon_;
+  for (auto it = str.rbegin(); it != str.rend(); ++it) {
+    const unsigned long character = static_cast<unsigned long>(*it) & max_character_;
+    result = MakeConcat(MakeChars(character, character), result);
+  }
+  return result;
+}
+
+int RegexCompiler::MakeConcat(const int left, const int right) {
+  if (left == empty_ or right == empty_) {
+    return empty_;
+  } else if (left == epsilon_) {
+    return right;
+  } else if (right == epsilon_) {
+    return left;
+  } else if (terms_[left].kind == Kind::CONCAT) {
+    const int left_first = terms_[left].children[0];
+    return MakeConcat(left_first, MakeConcat(terms_[left].children[1], right));
+  }
+  return MakeTerm(Kind::CONCAT, {left, right}, 0, 0, {}, terms_[left].is_nullable and terms_[right].is_nullable);
+}
+
+int RegexCompiler::MakeUnion(const std::vector<int>& terms) {
+  std::vector<int> children;
+  for (const int term : terms) {
+    if (term == any_string_) {
+      return any_string_;
+    } else if (terms_[term].kind == Kind::UNION) {
+      children.insert(children.end(), terms_[term].children.begin(), terms_[term].children.end());
+    } else if (term != empty_) {
+      children.push_back(term);
+    }
+  }
+  std::sort(children.begin(), children.end());
+  children.erase(std::unique(children.begin(), children.end()), children.end());
+  if (children.empty()) {
+    return empty_;
+  } else if (children.size() == 1) {
+    return children.front();
+  }
+  bool is_nullable = false;
+  for (const int child : children) {
+    is_nullable = is_nullable or terms_[child].is_nullable;
+  }
+  return MakeTerm(Kind::UNION, children, 0, 0, {}, is_nullable);
+}
+
+int RegexCompiler::MakeIntersect(const std::vector<int>& terms) {
+  std::vector<int> children;
+  for (const int term : terms) {
+    if (term == empty_) {
+      return empty_;
+    } else if (terms_[term].kind == Kind::INTERSECT) {
+      children.insert(children.end(), terms_[term].children.begin(), terms_[term].children.end());
+    } else if (term != any_string_) {
+      children.push_back(term);
+    }
+  }
+  std::sort(children.begin(), children.end());
+  children.erase(std::unique(children.begin(), children.end()), children.end());
+  if (children.empty()) {
+    return any_string_;
+  } else if (children.size() == 1) {
+    return children.front();
+  }
+  bool is_nullable = true;
+  for (const int child : children) {
+    is_nullable = is_nullable and terms_[child].is_nullable;
+  }
+  return MakeTerm(Kind::INTERSECT, children, 0, 0, {}, is_nullable);
+}
+
+int RegexCompiler::MakeStar(const int term) {
+  if (term == empty_ or term == epsilon_) {
+    return epsilon_;
+  } else if (terms_[term].kind == Kind::STAR) {
+    return term;
+  }
+  return MakeTerm(Kind::STAR, {term}, 0, 0, {}, true);
+}
+
+int RegexCompiler::MakeRepeat(const int term, const unsigned long min, const unsigned long max) {
+  if (max < min) {
+    return empty_;
+  } else if (max == 0 or term == epsilon_) {
+    return epsilon_;
+  } else if (term == empty_) {
+    return (min == 0) ? epsilon_ : empty_;
+  } else if (min == 0 and max == UNBOUNDED) {
+    return MakeStar(term);
+  } else if (min == 1 and max == 1) {
+    return term;
+  }
+  return MakeTerm(Kind::REPEAT, {term}, min, max, {}, min == 0 or terms_[term].is_nullable);
+}
+
+int RegexCompiler::MakeComplement(const int term) {
+  if (term == empty_) {
+    return any_string_;
+  } else if (term == any_string_) {
+    return empty_;
+  } else if (terms_[term].kind == Kind::COMPLEMENT) {
+    return terms_[term].children[0];
+  }
+  return MakeTerm(Kind::COMPLEMENT, {term}, 0, 0, {}, not terms_[term].is_nullable);
+}
+
+int RegexCompiler::Derivative(const int term, const unsigned long character) {
+  auto it = derivatives_.find({term, character});
+  if (it != derivatives_.end()) {
+    return it->second;
+  }
+
+  // terms are copied, making new terms invalidates references
+  const Term current = terms_[term];
+  int result = empty_;
+  switch (current.kind) {
+    case Kind::EMPTY:
+    case Kind::EPSILON:
+      break;
+    case Kind::CHARS:
+      for (const auto& interval : current.intervals) {
+        if (interval.first <= character and character <= interval.second) {
+          result = epsilon_;
+        }
+      }
+      break;
+    case Kind::CONCAT: {
+      const int left = current.children[0];
+      const int right = current.children[1];
+      result = MakeConcat(Derivative(left, character), right);
+      if (terms_[left].is_nullable) {
+        result = MakeUnion({result, Derivative(right, character)});
+      }
+    }
+      break;
+    case Kind::UNION:
+    case Kind::INTERSECT: {
+      std::vector<int> child_derivatives;
+      for (const int child : current.children) {
+        child_derivatives.push_back(Derivative(child, character));
+      }
+      result = (current.kind == Kind::UNION) ? MakeUnion(child_derivatives) : MakeIntersect(child_derivatives);
+    }
+      break;
+    case Kind::STAR:
+      result = MakeConcat(Derivative(current.children[0], character), term);
+      break;
+    case Kind::REPEAT: {
+      const unsigned long min = (current.min == 0) ? 0 : current.min - 1;
+      const unsigned long max = (current.max == UNBOUNDED) ? UNBOUNDED : current.max - 1;
+      const int rest = MakeRepeat(current.children[0], min, max);
+      result = MakeConcat(Derivative(current.children[0], character), rest);
+    }
+      break;
+    case Kind::COMPLEMENT:
+      result = MakeComplement(Derivative(current.children[0], character));
+      break;
+  }
+  derivatives_[{term, character}] = result;
+  return result;
+}
+
+std::vector<std::string> RegexCompiler::GetPaths(const Interval& interval) const {
+  std::vector<std::string> paths;
+  unsigned long from = interval.first;
+  while (true) {
+    // largest aligned block of characters starting at from that stays in the interval
+    int num_of_free_bits = 0;
+    while (num_of_free_bits < number_of_bdd_variables_) {
+      const unsigned long block_mask = (1UL << (num_of_free_bits + 1)) - 1;
+      if ((from & block_mask) != 0 or from + block_mask > interval.second) {
+        break;
+      }
+      ++num_of_free_bits;
+    }
+    std::string path(number_of_bdd_variables_, 'X');
+    for (int i = 0; i < number_of_bdd_variables_ - num_of_free_bits; ++i) {
+      path[i] = ((from >> (number_of_bdd_variables_ - 1 - i)) & 1) ? '1' : '0';
+    }
+    paths.push_back(path);
+
+    const unsigned long last = from + ((1UL << num_of_free_bits) - 1);
+    if (last >= interval.second) {
+      break;
+    }
+    from = last + 1;
+  }
+  return paths;
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
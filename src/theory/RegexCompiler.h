@@ -0,0 +1,112 @@
+/*
+ * RegexCompiler.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_REGEXCOMPILER_H_
+#define SRC_THEORY_REGEXCOMPILER_H_
+
+#include <climits>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+#include <mona/bdd.h>
+#include <mona/dfa.h>
+
+#include "../utils/RegularExpression.h"
+
+namespace Vlab {
+namespace Theory {
+
+using DFA_ptr = DFA*;
+
+/**
+ * Compiles a regular expression into a single dfa with Brzozowski derivatives, without building an automaton for each
+ * sub expression.
+ * Terms are hash consed, unions and intersections are kept as sorted sets and concatenations are right associated,
+ * which keeps the number of distinct derivatives finite. The alphabet is split into the intervals of characters that
+ * no character class of the expression separates, a derivative is taken once per interval. The dfa is minimized once.
+ */
+class RegexCompiler {
+ public:
+  /**
+   * @param number_of_bdd_variables bits of a character
+   * @param variable_indices bdd variable indices of the bits
+   */
+  RegexCompiler(const int number_of_bdd_variables, int* variable_indices);
+  virtual ~RegexCompiler();
+
+  DFA_ptr Compile(Util::RegularExpression_ptr regular_expression);
+
+ protected:
+  enum class Kind : int {
+    EMPTY = 0,
+    EPSILON,
+    CHARS,
+    CONCAT,
+    UNION,
+    INTERSECT,
+    STAR,
+    REPEAT,
+    COMPLEMENT
+  };
+  using Interval = std::pair<unsigned long, unsigned long>;
+
+  struct Term {
+    Kind kind;
+    std::vector<int> children;
+    unsigned long min;
+    unsigned long max;
+    std::vector<Interval> intervals;
+    bool is_nullable;
+  };
+
+  int Translate(Util::RegularExpression_ptr regular_expression);
+
+  int MakeTerm(const Kind kind, const std::vector<int>& children, const unsigned long min, const unsigned long max,
+               const std::vector<Interval>& intervals, const bool is_nullable);
+  int MakeChars(unsigned long from, unsigned long to);
+  int MakeString(const std::string& str);
+  int MakeConcat(const int left, const int right);
+  int MakeUnion(const std::vector<int>& terms);
+  int MakeIntersect(const std::vector<int>& terms);
+  int MakeStar(const int term);
+  int MakeRepeat(const int term, const unsigned long min, const unsigned long max);
+  int MakeComplement(const int term);
+
+  /**
+   * @return term accepting the suffixes of the words of the term that start with the character
+   */
+  int Derivative(const int term, const unsigned long character);
+
+  /**
+   * @return ternary paths, most significant bit first, that cover the characters in the interval
+   */
+  std::vector<std::string> GetPaths(const Interval& interval) const;
+
+  static const unsigned long UNBOUNDED;
+
+  int number_of_bdd_variables_;
+  int* variable_indices_;
+  unsigned long max_character_;
+  int empty_;
+  int epsilon_;
+  int any_string_;
+  std::vector<Term> terms_;
+  std::map<std::tuple<int, std::vector<int>, unsigned long, unsigned long, std::vector<Interval>>, int> term_ids_;
+  std::map<std::pair<int, unsigned long>, int> derivatives_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_REGEXCOMPILER_H_ */
@@ -7,6 +7,9 @@
 
 #include "StringAutomaton.h"
 
+#include "RegexCompiler.h"
+#include "UniformSampler.h"
+
 namespace Vlab {
 namespace Theory {
 
@@ -33,6 +36,7 @@ StringAutomaton::StringAutomaton(const DFA_ptr dfa, const int i_track, const int
 		:	Automaton(Automaton::Type::MULTITRACK, nullptr, number_of_tracks * VAR_PER_TRACK),
 			num_tracks_(number_of_tracks),
 			formula_(new StringFormula()) {
+	DFAContext dfa_context;
 	DFA_ptr M = dfa, temp = nullptr, result = nullptr;
 	trace_descr tp;
 	paths state_paths, pp;
@@ -205,6 +209,7 @@ StringAutomaton_ptr StringAutomaton::MakeEmptyString(const int number_of_bdd_var
 }
 
 StringAutomaton_ptr StringAutomaton::MakeString(const std::string str, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   if (str.empty()) {
     return StringAutomaton::MakeEmptyString();
   }
@@ -243,6 +248,7 @@ StringAutomaton_ptr StringAutomaton::MakeString(const std::string str, const int
 }
 
 StringAutomaton_ptr StringAutomaton::MakeAnyString(const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   //char statuses[2] { '+', '\0' };
   int *variable_indices = GetBddVariableIndices(number_of_bdd_variables);
   dfaSetup(1, number_of_bdd_variables, variable_indices);
@@ -263,6 +269,7 @@ StringAutomaton_ptr StringAutomaton::MakeAnyOtherString(const std::string str, c
 }
 
 StringAutomaton_ptr StringAutomaton::MakeCharRange(const char from, const char to, const int number_of_bdd_variables) {
+  DFAContext dfa_context;
   unsigned long from_char = (unsigned long) from;
   unsigned long to_char = (unsigned long) to;
   if (from_char > to_char) {
@@ -307,98 +314,31 @@ StringAutomaton_ptr StringAutomaton::MakeAnyChar(const int number_of_bdd_variabl
 }
 
 StringAutomaton_ptr StringAutomaton::MakeRegexAuto(const std::string regex, const int number_of_bdd_variables) {
-  Util::RegularExpression regular_expression (regex);
-  StringAutomaton_ptr regex_auto = StringAutomaton::MakeRegexAuto(&regular_expression, number_of_bdd_variables);
+  DFAContext dfa_context;
+  std::stringstream key;
+  key << "MakeRegexAuto " << Util::RegularExpression::DEFAULT << " " << number_of_bdd_variables << " " << regex;
+  DFA_ptr regex_dfa = AutomatonCache::GetInstance().Apply(key.str(), [&regex, number_of_bdd_variables]() {
+    Util::RegularExpression regular_expression (regex);
+    StringAutomaton_ptr regex_auto = StringAutomaton::MakeRegexAuto(&regular_expression, number_of_bdd_variables);
+    DFA_ptr regex_dfa = dfaCopy(regex_auto->getDFA());
+    delete regex_auto;
+    return regex_dfa;
+  });
+  StringAutomaton_ptr regex_auto = new StringAutomaton(regex_dfa, number_of_bdd_variables);
   DVLOG(VLOG_LEVEL) << regex_auto->id_ << " = MakeRegexAuto(" << regex << ")";
 
   return regex_auto;
 }
 
+/**
+ * Builds one dfa for the whole expression with RegexCompiler instead of combining an automaton for each sub expression
+ */
 StringAutomaton_ptr StringAutomaton::MakeRegexAuto(Util::RegularExpression_ptr regular_expression, const int number_of_bdd_variables) {
-  StringAutomaton_ptr regex_auto = nullptr;
-  StringAutomaton_ptr regex_expr1_auto = nullptr;
-  StringAutomaton_ptr regex_expr2_auto = nullptr;
-
-  switch (regular_expression->type()) {
-  case Util::RegularExpression::Type::UNION:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_expr2_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr2(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Union(regex_expr2_auto);
-    delete regex_expr1_auto;
-    delete regex_expr2_auto;
-    break;
-  case Util::RegularExpression::Type::CONCATENATION:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_expr2_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr2(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Concat(regex_expr2_auto);
-    delete regex_expr1_auto;
-    delete regex_expr2_auto;
-    break;
-  case Util::RegularExpression::Type::INTERSECTION:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_expr2_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr2(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Intersect(regex_expr2_auto);
-    delete regex_expr1_auto;
-    delete regex_expr2_auto;
-    break;
-  case Util::RegularExpression::Type::OPTIONAL:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Optional();
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::REPEAT_STAR:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->KleeneClosure();
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::REPEAT_PLUS:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Closure();
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::REPEAT_MIN:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Repeat(regular_expression->get_min());
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::REPEAT_MINMAX:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Repeat(regular_expression->get_min(), regular_expression->get_max());
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::COMPLEMENT:
-    regex_expr1_auto = StringAutomaton::MakeRegexAuto(regular_expression->get_expr1(), number_of_bdd_variables);
-    regex_auto = regex_expr1_auto->Complement();
-    delete regex_expr1_auto;
-    break;
-  case Util::RegularExpression::Type::CHAR:
-    regex_auto = StringAutomaton::MakeString(std::string(1, regular_expression->get_character()), number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::CHAR_RANGE:
-    regex_auto = StringAutomaton::MakeCharRange(regular_expression->get_from_character(), regular_expression->get_to_character(), number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::ANYCHAR:
-    regex_auto = StringAutomaton::MakeAnyChar(number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::EMPTY:
-    regex_auto = StringAutomaton::MakePhi(number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::STRING:
-    regex_auto = StringAutomaton::MakeString(regular_expression->get_string(), number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::ANYSTRING:
-    regex_auto = StringAutomaton::MakeAnyString(number_of_bdd_variables);
-    break;
-  case Util::RegularExpression::Type::AUTOMATON:
-    LOG(FATAL)<< "Unsupported regular expression" << *regular_expression;
-    break;
-  case Util::RegularExpression::Type::INTERVAL:
-    LOG(FATAL) << "Unsupported regular expression" << *regular_expression;
-    break;
-  default:
-    LOG(FATAL) << "Unsupported regular expression" << *regular_expression;
-    break;
-  }
+  DFAContext dfa_context;
+  RegexCompiler regex_compiler (number_of_bdd_variables, GetBddVariableIndices(number_of_bdd_variables));
+  DFA_ptr regex_dfa = regex_compiler.Compile(regular_expression);
+  StringAutomaton_ptr regex_auto = new StringAutomaton(regex_dfa, number_of_bdd_variables);
+  DVLOG(VLOG_LEVEL) << regex_auto->id_ << " = MakeRegexAuto(" << *regular_expression << ")";
 
   return regex_auto;
 }
@@ -495,6 +435,7 @@ StringAutomaton_ptr StringAutomaton::MakeAutomaton(StringFormula_ptr formula) {
 }
 
 StringAutomaton_ptr StringAutomaton::MakeBegins(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr;
 	DFA_ptr temp_dfa, result_dfa;
 	int num_tracks = formula->GetNumberOfVariables(),
@@ -584,6 +525,7 @@ StringAutomaton_ptr StringAutomaton::MakeBegins(StringFormula_ptr formula) {
 }
 
 StringAutomaton_ptr StringAutomaton::MakeNotBegins(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr;
 	DFA_ptr temp_dfa, result_dfa;
 	int num_tracks = formula->GetNumberOfVariables(),
@@ -750,6 +692,7 @@ StringAutomaton_ptr StringAutomaton::MakeNotBegins(StringFormula_ptr formula) {
 }
 
 StringAutomaton_ptr StringAutomaton::MakeEquality(StringFormula_ptr formula) {
+  DFAContext dfa_context;
 
   StringAutomaton_ptr equality_auto = nullptr;
 
@@ -812,6 +755,7 @@ StringAutomaton_ptr StringAutomaton::MakeEquality(StringFormula_ptr formula) {
 }
 
 StringAutomaton_ptr StringAutomaton::MakeNotEquality(	StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr not_equality_auto = nullptr;
 
 	auto coeff_map = formula->GetVariableCoefficientMap();
@@ -881,6 +825,7 @@ StringAutomaton_ptr StringAutomaton::MakeNotEquality(	StringFormula_ptr formula)
 }
 
 StringAutomaton_ptr StringAutomaton::MakeLessThan(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr, temp_auto = nullptr;
 	StringAutomaton_ptr constant_string_auto = nullptr;
 	DFA_ptr temp_dfa = nullptr, result_dfa = nullptr, temp2_dfa = nullptr;
@@ -940,6 +885,7 @@ StringAutomaton_ptr StringAutomaton::MakeLessThan(StringFormula_ptr formula) {
 }
 
 StringAutomaton_ptr StringAutomaton::MakeLessThanOrEqual(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr, temp_auto = nullptr;
 	StringAutomaton_ptr constant_string_auto = nullptr;
 	DFA_ptr temp_dfa = nullptr, result_dfa = nullptr, temp2_dfa = nullptr;
@@ -997,6 +943,7 @@ StringAutomaton_ptr StringAutomaton::MakeLessThanOrEqual(StringFormula_ptr formu
 }
 
 StringAutomaton_ptr StringAutomaton::MakeGreaterThan(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr, temp_auto = nullptr;
 	StringAutomaton_ptr constant_string_auto = nullptr;
 	DFA_ptr temp_dfa = nullptr, result_dfa = nullptr, temp2_dfa = nullptr;
@@ -1056,6 +1003,7 @@ StringAutomaton_ptr StringAutomaton::MakeGreaterThan(StringFormula_ptr formula)
 }
 
 StringAutomaton_ptr StringAutomaton::MakeGreaterThanOrEqual(StringFormula_ptr formula) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr, temp_auto = nullptr;
 	StringAutomaton_ptr constant_string_auto = nullptr;
 	DFA_ptr temp_dfa = nullptr, result_dfa = nullptr, temp2_dfa = nullptr;
@@ -1113,6 +1061,7 @@ StringAutomaton_ptr StringAutomaton::MakeGreaterThanOrEqual(StringFormula_ptr fo
 }
 
 StringAutomaton_ptr StringAutomaton::MakeAnyStringUnaligned(StringFormula_ptr formula) {
+  DFAContext dfa_context;
   StringAutomaton_ptr result_auto = nullptr;
 
   // if only one variable, don't complicate with lambda transitions
@@ -1239,6 +1188,70 @@ StringAutomaton_ptr StringAutomaton::Intersect(StringAutomaton_ptr other_auto) {
 	return intersect_auto;
 }
 
+StringAutomaton_ptr StringAutomaton::Intersect(const std::vector<StringAutomaton_ptr>& autos) {
+  CHECK(not autos.empty()) << "nothing to intersect";
+  if (autos.size() == 1) {
+    return autos[0]->clone();
+  }
+
+  StringAutomaton_ptr big_auto = autos[0];
+  for (auto string_auto : autos) {
+    if (string_auto->num_tracks_ > big_auto->num_tracks_) {
+      big_auto = string_auto;
+    }
+  }
+
+  std::vector<DFA_ptr> dfas;
+  std::vector<StringAutomaton_ptr> relation_autos;
+  // formulas of the operands, a single track operand is put in a multi-track with the formula of big_auto
+  std::vector<StringFormula_ptr> formulas;
+  for (auto string_auto : autos) {
+    if (string_auto->num_tracks_ == big_auto->num_tracks_) {
+      dfas.push_back(string_auto->dfa_);
+      formulas.push_back(string_auto->formula_);
+      continue;
+    }
+    if (string_auto->num_tracks_ != 1 or string_auto->formula_->IsConstant()) {
+      LOG(FATAL) << "Intersection between incompatible StringAutomata";
+    }
+    std::string variable_name = string_auto->formula_->GetVariableAtIndex(0);
+    int index = big_auto->formula_->GetVariableIndex(variable_name);
+    auto relation_auto = new StringAutomaton(string_auto->dfa_, index, big_auto->num_tracks_,
+                                             string_auto->num_of_bdd_variables_);
+    relation_autos.push_back(relation_auto);
+    dfas.push_back(relation_auto->dfa_);
+    formulas.push_back(big_auto->formula_);
+  }
+
+  auto intersect_dfa = Automaton::DFAIntersect(dfas);
+  for (auto relation_auto : relation_autos) {
+    delete relation_auto;
+  }
+
+  // folds the formulas of all operands as the binary version does for two, operands without a formula are skipped
+  StringFormula_ptr intersect_formula = nullptr;
+  for (auto formula : formulas) {
+    if (formula == nullptr) {
+      continue;
+    }
+    if (intersect_formula == nullptr) {
+      intersect_formula = formula->clone();
+    } else {
+      auto next_formula = intersect_formula->Intersect(formula);
+      delete intersect_formula;
+      intersect_formula = next_formula;
+    }
+  }
+  if (intersect_formula != nullptr) {
+    intersect_formula->ResetCoefficients(0);
+    intersect_formula->SetType(StringFormula::Type::INTERSECT);
+  }
+  auto intersect_auto = new StringAutomaton(intersect_dfa, intersect_formula, big_auto->num_of_bdd_variables_);
+
+  DVLOG(VLOG_LEVEL) << intersect_auto->id_ << " = Intersect(" << autos.size() << " automata)";
+  return intersect_auto;
+}
+
 StringAutomaton_ptr StringAutomaton::Union(StringAutomaton_ptr other_auto) {
 	CHECK_EQ(this->num_tracks_,other_auto->num_tracks_);
 	auto union_dfa = Automaton::DFAUnion(this->dfa_, other_auto->dfa_);
@@ -1283,6 +1296,7 @@ StringAutomaton_ptr StringAutomaton::Optional() {
 }
 
 StringAutomaton_ptr StringAutomaton::Closure() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   StringAutomaton_ptr result_auto = nullptr;
   DFA_ptr result_dfa = nullptr, temp_dfa = nullptr;
@@ -1441,6 +1455,7 @@ StringAutomaton_ptr StringAutomaton::Repeat(unsigned min, unsigned max) {
 }
 
 StringAutomaton_ptr StringAutomaton::Suffixes() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   StringAutomaton_ptr suffixes_auto = nullptr;
   if (this->IsEmptyLanguage()) {
@@ -1592,6 +1607,7 @@ StringAutomaton_ptr StringAutomaton::SuffixesFromIndex(int start) {
 }
 
 StringAutomaton_ptr StringAutomaton::SuffixesFromTo(int start, int end) {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   StringAutomaton_ptr suffixes_auto = nullptr;
 
@@ -1792,6 +1808,7 @@ StringAutomaton_ptr StringAutomaton::SubStrings() {
 }
 
 StringAutomaton_ptr StringAutomaton::CharAt(const int index) {
+  DFAContext dfa_context;
   CHECK_EQ(this->num_tracks_,1);
   if (this->IsEmptyLanguage()) {
     auto charat_auto = StringAutomaton::MakePhi();
@@ -1890,6 +1907,7 @@ StringAutomaton_ptr StringAutomaton::CharAt(const int index) {
 }
 
 StringAutomaton_ptr StringAutomaton::CharAt(IntAutomaton_ptr index_auto) {
+  DFAContext dfa_context;
   CHECK_EQ(this->num_tracks_,1);
   StringAutomaton_ptr prefixes_auto = this->Prefixes();
   StringAutomaton_ptr string_length_auto = new StringAutomaton(index_auto->getDFA(),index_auto->get_number_of_bdd_variables());
@@ -2294,6 +2312,7 @@ StringAutomaton_ptr StringAutomaton::Ends(StringAutomaton_ptr search_auto) {
 }
 
 StringAutomaton_ptr StringAutomaton::ToUpperCase() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr upper_case_dfa = nullptr;
   StringAutomaton_ptr upper_case_auto = nullptr;
@@ -2318,6 +2337,7 @@ StringAutomaton_ptr StringAutomaton::ToUpperCase() {
 }
 
 StringAutomaton_ptr StringAutomaton::ToLowerCase() {
+  DFAContext dfa_context;
   CHECK_EQ(this->num_tracks_,1);
   DFA_ptr lower_case_dfa = nullptr;
   StringAutomaton_ptr lower_case_auto = nullptr;
@@ -2341,6 +2361,7 @@ StringAutomaton_ptr StringAutomaton::ToLowerCase() {
 }
 
 StringAutomaton_ptr StringAutomaton::Trim() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr trimmed_prefix_dfa = nullptr, trimmed_dfa = nullptr;
   StringAutomaton_ptr trimmed_auto = nullptr, trim_auto = nullptr;
@@ -2361,6 +2382,7 @@ StringAutomaton_ptr StringAutomaton::Trim() {
 
 StringAutomaton_ptr StringAutomaton::Replace(StringAutomaton_ptr search_auto,
 		StringAutomaton_ptr replace_auto) {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr result_dfa = nullptr, temp_dfa = nullptr;
   StringAutomaton_ptr result_auto = nullptr,temp_auto = nullptr;
@@ -2406,124 +2428,95 @@ StringAutomaton_ptr StringAutomaton::GetAnyStringNotContainsMe() {
 	return not_contains_auto;
 }
 
+/**
+ * Builds the unary automaton from the semilinear set of the lengths instead of projecting away the character bits
+ */
 UnaryAutomaton_ptr StringAutomaton::ToUnaryAutomaton() {
 	CHECK_EQ(this->num_tracks_,1);
-  UnaryAutomaton_ptr unary_auto = nullptr;
-  DFA_ptr unary_dfa = nullptr, tmp_dfa = nullptr;
-
-  int sink_state = this->GetSinkState(),
-          number_of_variables = num_of_bdd_variables_ + 1, // one extra bit
-          to_state = 0;
-  bool has_sink = true;
-  int original_num_states = dfa_->ns;
-  if(sink_state < 0) {
-    has_sink = false;
-    sink_state = 0;
-  }
-
-  int* indices = GetBddVariableIndices(number_of_variables);
-  char* statuses = new char[original_num_states + 1];
-  std::map<std::vector<char>*, int> exceptions;
-  std::vector<char>* current_exception = nullptr;
-
-  paths state_paths = nullptr, pp = nullptr;
-  trace_descr tp = nullptr;
-
-
-  dfaSetup(original_num_states, number_of_variables, indices);
-
-  for (int i = 0; i < original_num_states; i++) {
+  SemilinearSet_ptr length_set = this->GetLengthSemilinearSet();
+  UnaryAutomaton_ptr unary_auto = UnaryAutomaton::MakeAutomaton(length_set);
+  delete length_set; length_set = nullptr;
+  DVLOG(VLOG_LEVEL) << unary_auto->getId() << " = [" << this->id_ << "]->toUnaryAutomaton()";
+  return unary_auto;
+}
 
-    if(i == sink_state && has_sink) {
-      dfaAllocExceptions(0);
-      dfaStoreState(sink_state);
-      statuses[sink_state] = '-';
+/**
+ * Lengths only depend on the state graph of the dfa, not on the transition labels. The set of states reachable with
+ * n characters is tracked for increasing n over the states that can reach an accepting state, the first set that
+ * repeats closes the cycle of the semilinear set.
+ */
+SemilinearSet_ptr StringAutomaton::GetLengthSemilinearSet() {
+  const std::vector<int> distances = GetDistancesToAcceptingStates();
+  std::vector<std::vector<int>> next_states(dfa_->ns);
+  for (int s = 0; s < dfa_->ns; ++s) {
+    if (distances[s] == INT_MAX) {
       continue;
     }
+    for (auto next_state : getNextStates(s)) {
+      if (distances[next_state] != INT_MAX) {
+        next_states[s].push_back(next_state);
+      }
+    }
+  }
 
-    state_paths = pp = make_paths(dfa_->bddm, dfa_->q[i]);
-    while (pp) {
-      if (!has_sink || pp->to != (unsigned)sink_state) {
-        to_state = pp->to;
-        current_exception = new std::vector<char>();
-        for (int j = 0; j < number_of_variables - 1; j++) {
-          //the following for loop can be avoided if the indices are in order
-          for (tp = pp->trace; tp && (tp->index != (unsigned)indices[j]); tp= tp->next);
-
-          if (tp) {
-            if (tp->value){
-              current_exception->push_back('1');
-            } else{
-              current_exception->push_back('0');
-            }
-          } else {
-            current_exception->push_back('X');
-          }
+  std::map<std::vector<int>, int> steps;
+  std::vector<bool> is_accepting_step;
+  std::vector<bool> is_next_state(dfa_->ns, false);
+  std::vector<int> current_states;
+  if (distances[dfa_->s] != INT_MAX) {
+    current_states.push_back(dfa_->s);
+  }
+  int cycle_head = -1;
+  while (not current_states.empty()) {
+    auto step_entry = steps.insert(std::make_pair(current_states, is_accepting_step.size()));
+    if (not step_entry.second) {
+      cycle_head = step_entry.first->second;
+      break;
+    }
+    bool is_accepting = false;
+    std::vector<int> reached_states;
+    for (auto state : current_states) {
+      is_accepting = is_accepting or (dfa_->f[state] == 1);
+      for (auto next_state : next_states[state]) {
+        if (not is_next_state[next_state]) {
+          is_next_state[next_state] = true;
+          reached_states.push_back(next_state);
         }
-
-        current_exception->push_back('1');
-        current_exception->push_back('\0');
-        exceptions[current_exception] = to_state;
       }
-      current_exception = nullptr;
-      tp = nullptr;
-      pp = pp->next;
     }
-
-    dfaAllocExceptions(exceptions.size());
-    for (auto it = exceptions.begin(); it != exceptions.end();) {
-      dfaStoreException(it->second, &*it->first->begin());
-      current_exception = it->first;
-      it = exceptions.erase(it);
-      delete current_exception;
+    for (auto next_state : reached_states) {
+      is_next_state[next_state] = false;
     }
-    dfaStoreState(sink_state);
-    current_exception = nullptr;
-    exceptions.clear();
+    std::sort(reached_states.begin(), reached_states.end());
+    is_accepting_step.push_back(is_accepting);
+    current_states.swap(reached_states);
+  }
 
-    if (dfa_->f[i] == 1) {
-      statuses[i] = '+';
-    } else if (dfa_->f[i] == -1) {
-      statuses[i] = '-';
-    } else {
-      statuses[i] = '0';
+  SemilinearSet_ptr semilinear_set = new SemilinearSet();
+  const int number_of_steps = is_accepting_step.size();
+  for (int i = 0; i < (cycle_head == -1 ? number_of_steps : cycle_head); ++i) {
+    if (is_accepting_step[i]) {
+      semilinear_set->add_constant(i);
     }
-
-    kill_paths(state_paths);
-    state_paths = pp = nullptr;
   }
-  statuses[this->dfa_->ns] = '\0';
-  unary_dfa = dfaBuild(statuses);
-  //delete[] indices; indices = nullptr;
-  delete[] statuses; statuses = nullptr;
-
-  for (int i = 0; i < number_of_variables - 1; i++) { // project away all bits
-    tmp_dfa = unary_dfa;
-    unary_dfa = dfaProject(tmp_dfa,  (unsigned)i);
-    dfaFree(tmp_dfa);
-    tmp_dfa = unary_dfa;
-    unary_dfa = dfaMinimize(tmp_dfa);
-    dfaFree(tmp_dfa);
-  }
-
-  int* indices_map = CreateBddVariableIndices(number_of_variables);
-  indices_map[number_of_variables - 1] = 0;
-  dfaReplaceIndices(unary_dfa, indices_map);
-  delete[] indices_map;
-
-  // make sure no "dont care" states
-  for(int i = 0; i < unary_dfa->ns; i++) {
-    if(unary_dfa->f[i] == 0) {
-      unary_dfa->f[i] = -1;
+  if (cycle_head != -1) {
+    for (int i = cycle_head; i < number_of_steps; ++i) {
+      if (is_accepting_step[i]) {
+        semilinear_set->add_periodic_constant(i - cycle_head);
+      }
+    }
+    if (semilinear_set->get_number_of_periodic_constants() > 0) {
+      semilinear_set->set_cycle_head(cycle_head);
+      semilinear_set->set_period(number_of_steps - cycle_head);
     }
   }
 
-  unary_auto = new UnaryAutomaton(unary_dfa);
-  DVLOG(VLOG_LEVEL) << unary_auto->getId() << " = [" << this->id_ << "]->toUnaryAutomaton()";
-  return unary_auto;
+  DVLOG(VLOG_LEVEL) << *semilinear_set << " = [" << this->id_ << "]->GetLengthSemilinearSet()";
+  return semilinear_set;
 }
 
 IntAutomaton_ptr StringAutomaton::ParseToIntAutomaton() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   IntAutomaton_ptr int_auto = nullptr;
   if (this->isCyclic()) {
@@ -2610,6 +2603,7 @@ IntAutomaton_ptr StringAutomaton::ParseToIntAutomaton() {
 }
 
 IntAutomaton_ptr StringAutomaton::Length() {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   IntAutomaton_ptr length_auto = nullptr;
   if (this->IsEmptyLanguage()) {
@@ -2618,9 +2612,19 @@ IntAutomaton_ptr StringAutomaton::Length() {
     std::string example = this->GetAnAcceptingString();
     length_auto = IntAutomaton::makeInt(example.length(), num_of_bdd_variables_);
   } else {
-    UnaryAutomaton_ptr unary_auto = this->ToUnaryAutomaton();
-    length_auto = unary_auto->toIntAutomaton(num_of_bdd_variables_);
-    delete unary_auto; unary_auto = nullptr;
+    // same dfas have the same lengths, the length automaton is cached by the fingerprint of the dfa
+    auto fingerprint = AutomatonCache::GetFingerprint(dfa_);
+    std::stringstream key;
+    key << "Length " << num_of_bdd_variables_ << " " << fingerprint.first << " " << fingerprint.second;
+    DFA_ptr length_dfa = AutomatonCache::GetInstance().Apply(key.str(), {dfa_}, [this]() {
+      UnaryAutomaton_ptr unary_auto = this->ToUnaryAutomaton();
+      IntAutomaton_ptr int_auto = unary_auto->toIntAutomaton(num_of_bdd_variables_);
+      DFA_ptr int_dfa = dfaCopy(int_auto->getDFA());
+      delete unary_auto; unary_auto = nullptr;
+      delete int_auto; int_auto = nullptr;
+      return int_dfa;
+    });
+    length_auto = new IntAutomaton(length_dfa, num_of_bdd_variables_);
   }
 
   DVLOG(VLOG_LEVEL) << length_auto->getId() << " = [" << this->id_ << "]->length()";
@@ -2881,6 +2885,7 @@ StringAutomaton_ptr StringAutomaton::RestrictAtIndexTo(
  * if they are guided by the post image values
  */
 StringAutomaton_ptr StringAutomaton::PreToUpperCase(StringAutomaton_ptr rangeAuto) {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr result_dfa = nullptr;
   StringAutomaton_ptr result_auto = nullptr;
@@ -2911,6 +2916,7 @@ StringAutomaton_ptr StringAutomaton::PreToUpperCase(StringAutomaton_ptr rangeAut
 }
 
 StringAutomaton_ptr StringAutomaton::PreToLowerCase(StringAutomaton_ptr rangeAuto) {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr result_dfa = nullptr;
   StringAutomaton_ptr result_auto = nullptr;
@@ -2984,6 +2990,7 @@ StringAutomaton_ptr StringAutomaton::PreConcatRight(
 
 StringAutomaton_ptr StringAutomaton::PreReplace(StringAutomaton_ptr searchAuto,
 		std::string replaceString, StringAutomaton_ptr rangeAuto) {
+	DFAContext dfa_context;
 	CHECK_EQ(this->num_tracks_,1);
   DFA_ptr result_dfa = nullptr, temp_dfa = nullptr;
   StringAutomaton_ptr result_auto = nullptr;
@@ -3034,6 +3041,7 @@ StringAutomaton_ptr StringAutomaton::GetAutomatonForVariable(std::string var_nam
 
 // handle case where only 1 track, but make sure correct # of variables
 StringAutomaton_ptr StringAutomaton::GetKTrack(int k_track) {
+  DFAContext dfa_context;
   DFA_ptr res = this->dfa_, temp;
 	StringAutomaton_ptr result_auto = nullptr;
 
@@ -3165,6 +3173,7 @@ StringAutomaton_ptr StringAutomaton::ProjectKTrack(int k_track) {
 }
 
 void StringAutomaton::SetSymbolicCounter() {
+	DFAContext dfa_context;
 	// normal symbolic counter for single-track
 	if(num_tracks_ == 1) {
 		Automaton::SetSymbolicCounter();
@@ -3292,43 +3301,12 @@ std::map<std::string,std::vector<std::string>> StringAutomaton::GetModelsWithinB
 		bound = counter.GetMinBound(num_models);
 	}
 
-  // compute BFS for unweighted graph (dfa)
-  std::queue<int> states_to_process;
-  std::vector<int> distances(this->dfa_->ns,INT_MAX);
-  std::set<int> final_states;
-
-  std::vector<int> shortest_accepting_path(this->dfa_->ns,INT_MAX);
-  for(int start_state = 0; start_state < this->dfa_->ns; start_state++) {
-  	distances[start_state] = 0;
-		states_to_process.push(start_state);
-
-		while(not states_to_process.empty()) {
-			int s = states_to_process.front();
-			states_to_process.pop();
-			// mark final states for later
-			if(this->dfa_->f[s] == 1) {
-				final_states.insert(s);
-			}
-
-			for(auto iter : getNextStates(s)) {
-				if(distances[iter] == INT_MAX) {
-					states_to_process.push(iter);
-					distances[iter] = distances[s] + 1;
-				}
-			}
-		}
-
-		int shortest = INT_MAX;
-		for(auto final : final_states) {
-			distances[final]--; // account for lambda/lambda transition
-			if(distances[final] < shortest) {
-				shortest = distances[final];
-			}
-		}
-		shortest_accepting_path[start_state] = shortest;
-
-
-		distances = std::vector<int>(this->dfa_->ns,INT_MAX);
+  // one backward bfs from the accepting states gives the shortest accepted suffix of each state
+  std::vector<int> shortest_accepting_path = GetDistancesToAcceptingStates();
+  for (auto& distance : shortest_accepting_path) {
+    if (distance != INT_MAX) {
+      distance--; // account for lambda/lambda transition
+    }
   }
 
 //  for(int i = 0; i < this->dfa_->ns; i++) {
@@ -3664,7 +3642,6 @@ bool StringAutomaton::IsAcceptingSingleString() {
 
 std::string StringAutomaton::GetAnAcceptingString() {
   CHECK_EQ(this->num_tracks_,1);
-  std::stringstream ss;
 
   auto readable_ascii_heuristic = [](unsigned& index) -> bool {
     switch (index) {
@@ -3678,34 +3655,13 @@ std::string StringAutomaton::GetAnAcceptingString() {
   };
   std::vector<bool>* example = getAnAcceptingWord(readable_ascii_heuristic);
 
-  unsigned char c = 0;
-  unsigned bit_range = num_of_bdd_variables_ - 1;
-  unsigned read_count = 0;
-  for (auto bit: *example) {
-    if (bit) {
-      c |= 1;
-    } else {
-      c |= 0;
-    }
-
-    if (read_count < (bit_range)) {
-      c <<= 1;
-    }
-    if (read_count == bit_range) {
-      ss << c;
-      c = 0;
-      read_count = 0;
-    } else {
-      read_count++;
-    }
-  }
+  std::string result = GetStringFromBits(*example);
   delete example;
-  return ss.str();
+  return result;
 }
 
 std::string StringAutomaton::GetAnAcceptingStringRandom() {
   CHECK_EQ(this->num_tracks_,1);
-  std::stringstream ss;
 
   std::mt19937 rng;
 	rng.seed(std::random_device()());
@@ -3717,10 +3673,59 @@ std::string StringAutomaton::GetAnAcceptingStringRandom() {
 
   std::vector<bool>* example = getAnAcceptingWordRandom(random_heuristic);
 
+  std::string result = GetStringFromBits(*example);
+  delete example;
+  return result;
+}
+
+std::vector<std::string> StringAutomaton::GetAcceptingStringsUniform(const unsigned num_of_strings,
+                                                                     const unsigned long bound, std::mt19937_64& rng) {
+  CHECK_EQ(this->num_tracks_,1);
+  std::vector<std::string> strings;
+  UniformSampler sampler(this, bound);
+  if (sampler.IsEmpty()) {
+    return strings;
+  }
+  for (auto& word : sampler.Sample(num_of_strings, rng)) {
+    strings.push_back(GetStringFromBits(word));
+  }
+  DVLOG(VLOG_LEVEL) << "[" << this->id_ << "]->GetAcceptingStringsUniform(" << num_of_strings << ", " << bound << ")";
+  return strings;
+}
+
+std::map<std::string, std::string> StringAutomaton::GetModelFromBits(const std::vector<bool>& bits) {
+  std::map<std::string, std::string> var_values;
+  if (num_tracks_ == 1) {
+    var_values[formula_->GetVariableAtIndex(0)] = GetStringFromBits(bits);
+    return var_values;
+  }
+
+  // tracks are interleaved, bit k of track i is at i + num_tracks * k in a transition
+  const std::size_t length = bits.size() / num_of_bdd_variables_;
+  for (int i = 0; i < num_tracks_; ++i) {
+    std::string value;
+    for (std::size_t t = 0; t < length; ++t) {
+      const std::size_t offset = t * num_of_bdd_variables_ + i;
+      if (bits[offset + num_tracks_ * (VAR_PER_TRACK - 1)]) {
+        continue;
+      }
+      unsigned char c = 0;
+      for (int k = 0; k < VAR_PER_TRACK - 1; ++k) {
+        c = (c << 1) | (bits[offset + num_tracks_ * k] ? 1 : 0);
+      }
+      value += c;
+    }
+    var_values[formula_->GetVariableAtIndex(i)] = value;
+  }
+  return var_values;
+}
+
+std::string StringAutomaton::GetStringFromBits(const std::vector<bool>& bits) {
+  std::stringstream ss;
   unsigned char c = 0;
   unsigned bit_range = num_of_bdd_variables_ - 1;
   unsigned read_count = 0;
-  for (auto bit: *example) {
+  for (auto bit: bits) {
     if (bit) {
       c |= 1;
     } else {
@@ -3738,7 +3743,6 @@ std::string StringAutomaton::GetAnAcceptingStringRandom() {
       read_count++;
     }
   }
-  delete example;
   return ss.str();
 }
 
@@ -3754,6 +3758,8 @@ void StringAutomaton::SetFormula(StringFormula_ptr formula) {
 }
 
 const StringAutomaton::TransitionVector& StringAutomaton::GenerateTransitionsForRelation(StringFormula::Type type, int bits_per_var) {
+  // transition table is shared, its entries are not moved once added
+  DFAContext dfa_context;
   bits_per_var--;
   // check table for precomputed value first
   std::pair<int,StringFormula::Type> key(bits_per_var,type);
@@ -3837,6 +3843,7 @@ const StringAutomaton::TransitionVector& StringAutomaton::GenerateTransitionsFor
 }
 
 DFA_ptr StringAutomaton::MakeBinaryRelationDfa(StringFormula::Type type, int bits_per_var, int num_tracks, int left_track, int right_track) {
+  DFAContext dfa_context;
   DFA_ptr temp_dfa = nullptr, result_dfa = nullptr, aligned_dfa = nullptr;
   int var = bits_per_var;
   int len = num_tracks * var;
@@ -3969,6 +3976,7 @@ DFA_ptr StringAutomaton::MakeBinaryRelationDfa(StringFormula::Type type, int bit
 }
 
 DFA_ptr StringAutomaton::MakeBinaryAlignedDfa(int left_track, int right_track, int num_tracks) {
+  DFAContext dfa_context;
   DFA_ptr temp_dfa = nullptr, result_dfa = nullptr;
   TransitionVector tv;
   int init = 0,lambda_star = 1, lambda_lambda = 2,
@@ -4082,6 +4090,7 @@ DFA_ptr StringAutomaton::MakeBinaryAlignedDfa(int left_track, int right_track, i
 // Only supports charAt(x,i) OP charAt(y,i) where i is constant integer,
 // OP in {<,>,<=,>=,=,!=}
 DFA_ptr StringAutomaton::MakeRelationalCharAtDfa(StringFormula_ptr formula, int bits_per_var, int num_tracks, int left_track, int right_track) {
+	DFAContext dfa_context;
 	int index = std::stoi(formula->GetConstant()); // will be string version of integer
 	int ns = index+6;
 	int sink = ns-1;
@@ -4218,6 +4227,7 @@ DFA_ptr StringAutomaton::MakeRelationalCharAtDfa(StringFormula_ptr formula, int
 }
 
 StringAutomaton_ptr StringAutomaton::MakePrefixSuffix(int left_track, int prefix_track, int suffix_track, int num_tracks) {
+	DFAContext dfa_context;
 	StringAutomaton_ptr result_auto = nullptr;
   DFA_ptr temp_dfa, result_dfa;
   TransitionVector tv;
@@ -4308,6 +4318,7 @@ StringAutomaton_ptr StringAutomaton::MakePrefixSuffix(int left_track, int prefix
 
 // TODO: Formulas and intersection? What do?
 StringAutomaton_ptr StringAutomaton::MakeConcatExtraTrack(int left_track, int right_track, int num_tracks, std::string str_constant) {
+  DFAContext dfa_context;
   StringAutomaton_ptr any_string_auto = StringAutomaton::MakeAnyString();
   StringAutomaton_ptr const_string_auto = StringAutomaton::MakeString(str_constant);
   auto temp_dfa = StringAutomaton::PrependLambda(const_string_auto->getDFA(),DEFAULT_NUM_OF_VARIABLES);
@@ -4356,6 +4367,7 @@ bool StringAutomaton::IsExepIncludeChar(std::vector<char> exep, std::vector<char
 
 // resulting dfa has 1 more bit for lambda stuff
 DFA_ptr StringAutomaton::PrependLambda(DFA_ptr dfa, int var) {
+  DFAContext dfa_context;
   if(var != DEFAULT_NUM_OF_VARIABLES) {
     LOG(FATAL) << "mismatched incoming var";
   }
@@ -4481,6 +4493,7 @@ DFA_ptr StringAutomaton::PrependLambda(DFA_ptr dfa, int var) {
 // incoming dfa has extrabit for lambda
 // remove lambda transitions and project away extra bit
 DFA_ptr StringAutomaton::TrimLambdaPrefix(DFA_ptr dfa, int var, bool project_bit) {
+  DFAContext dfa_context;
   if(var != VAR_PER_TRACK) {
     LOG(FATAL) << "not correct var";
   }
@@ -4654,11 +4667,13 @@ DFA_ptr StringAutomaton::TrimLambdaPrefix(DFA_ptr dfa, int var, bool project_bit
     num_bits++;
   }
 
-  for(int i = 0; i < num_bits; i++) {
-    int bit = len-i-1;
-    temp_dfa = dfaProject(result_dfa,(unsigned)bit);
-    dfaFree(result_dfa);
-    result_dfa = dfaMinimize(temp_dfa);
+  if(num_bits > 0) {
+    std::vector<int> projected_bits;
+    for(int i = 0; i < num_bits; i++) {
+      projected_bits.push_back(len-i-1);
+    }
+    temp_dfa = result_dfa;
+    result_dfa = Automaton::DFAProjectAway(temp_dfa, len, projected_bits);
     dfaFree(temp_dfa);
   }
 
@@ -4669,6 +4684,7 @@ DFA_ptr StringAutomaton::TrimLambdaPrefix(DFA_ptr dfa, int var, bool project_bit
 
 // var should be 9
 DFA_ptr StringAutomaton::TrimLambdaSuffix(DFA_ptr dfa, int var, bool project_bit) {
+  DFAContext dfa_context;
   if(var != VAR_PER_TRACK) {
     LOG(FATAL) << "Bad nuber o bits!";
   }
@@ -4743,6 +4759,7 @@ DFA_ptr StringAutomaton::TrimLambdaSuffix(DFA_ptr dfa, int var, bool project_bit
 }
 
 DFA_ptr StringAutomaton::TrimPrefix(DFA_ptr subject_dfa, DFA_ptr trim_dfa, int var) {
+  DFAContext dfa_context;
   DFA_ptr temp_dfa = nullptr, result_dfa = nullptr;
   StringAutomaton_ptr temp_multi = nullptr, subject_multi = nullptr,
                           trim_multi = nullptr, intersect_multi = nullptr;
@@ -4773,6 +4790,7 @@ DFA_ptr StringAutomaton::TrimPrefix(DFA_ptr subject_dfa, DFA_ptr trim_dfa, int v
 }
 
 DFA_ptr StringAutomaton::TrimSuffix(DFA_ptr subject_dfa, DFA_ptr trim_dfa, int var) {
+  DFAContext dfa_context;
   DFA_ptr temp_dfa = nullptr, result_dfa = nullptr;
   StringAutomaton_ptr temp_multi = nullptr, subject_multi = nullptr,
                           trim_multi = nullptr, intersect_multi = nullptr;
@@ -4805,33 +4823,35 @@ DFA_ptr StringAutomaton::TrimSuffix(DFA_ptr subject_dfa, DFA_ptr trim_dfa, int v
 }
 
 DFA_ptr StringAutomaton::concat(DFA_ptr prefix_dfa, DFA_ptr suffix_dfa, int var) {
-  DFA_ptr temp_dfa = nullptr, result_dfa = nullptr;
-  StringAutomaton_ptr temp_multi = nullptr, prefix_multi = nullptr,
-                          suffix_multi = nullptr, intersect_multi = nullptr;
-  StringAutomaton_ptr result_string_auto = nullptr;
-
-  // (x,x,lambda) until track 2 is lambda
-  // (x,lambda,x) until end
-//  LOG(FATAL) << "HERE";
-
-  temp_multi = MakePrefixSuffix(0,1,2,3);
-  prefix_multi = new StringAutomaton(prefix_dfa,1,3,var);
-  temp_dfa = PrependLambda(suffix_dfa,var);
-  suffix_multi = new StringAutomaton(temp_dfa,2,3,VAR_PER_TRACK);
-  dfaFree(temp_dfa);
-  intersect_multi = temp_multi->Intersect(prefix_multi);
-  delete temp_multi;
-  delete prefix_multi;
-  temp_multi = intersect_multi;
-  intersect_multi = temp_multi->Intersect(suffix_multi);
-  delete temp_multi;
-  delete suffix_multi;
-	result_string_auto = intersect_multi->GetKTrack(0);
-	result_dfa = dfaCopy(result_string_auto->getDFA());
-
-  delete intersect_multi;
-  delete result_string_auto;
-  return result_dfa;
+  DFAContext dfa_context;
+  return AutomatonCache::GetInstance().Apply(AutomatonCache::Operation::STRING_CONCAT, prefix_dfa, suffix_dfa, var,
+                                             [prefix_dfa, suffix_dfa, var]() {
+    DFA_ptr temp_dfa = nullptr, result_dfa = nullptr;
+    StringAutomaton_ptr temp_multi = nullptr, prefix_multi = nullptr,
+                            suffix_multi = nullptr, intersect_multi = nullptr;
+    StringAutomaton_ptr result_string_auto = nullptr;
+
+    // (x,x,lambda) until track 2 is lambda
+    // (x,lambda,x) until end
+    temp_multi = MakePrefixSuffix(0,1,2,3);
+    prefix_multi = new StringAutomaton(prefix_dfa,1,3,var);
+    temp_dfa = PrependLambda(suffix_dfa,var);
+    suffix_multi = new StringAutomaton(temp_dfa,2,3,VAR_PER_TRACK);
+    dfaFree(temp_dfa);
+    intersect_multi = temp_multi->Intersect(prefix_multi);
+    delete temp_multi;
+    delete prefix_multi;
+    temp_multi = intersect_multi;
+    intersect_multi = temp_multi->Intersect(suffix_multi);
+    delete temp_multi;
+    delete suffix_multi;
+    result_string_auto = intersect_multi->GetKTrack(0);
+    result_dfa = dfaCopy(result_string_auto->getDFA());
+
+    delete intersect_multi;
+    delete result_string_auto;
+    return result_dfa;
+  });
 }
 
 DFA_ptr StringAutomaton::PreConcatPrefix(DFA_ptr concat_dfa, DFA_ptr suffix_dfa, int var) {
@@ -4986,6 +5006,7 @@ StringAutomaton_ptr StringAutomaton::LastIndexOfHelper(StringAutomaton_ptr searc
  *
  */
 StringAutomaton_ptr StringAutomaton::GetDuplicateStateAutomaton() {
+	DFAContext dfa_context;
 	StringAutomaton_ptr duplicated_auto = nullptr;
 	DFA_ptr result_dfa = nullptr;
 	paths state_paths = nullptr, pp = nullptr;
@@ -5140,6 +5161,7 @@ StringAutomaton_ptr StringAutomaton::GetDuplicateStateAutomaton() {
  * @param use_extra_bit decides on whether to use extra bit or not.
  */
 StringAutomaton_ptr StringAutomaton::ToQueryAutomaton() {
+	DFAContext dfa_context;
 	StringAutomaton_ptr query_auto = nullptr, not_contains_auto = nullptr,
 						empty_string_auto = nullptr, tmp_auto_1 = nullptr;
 
@@ -5349,6 +5371,7 @@ StringAutomaton_ptr StringAutomaton::Search(StringAutomaton_ptr search_auto) {
  * Can be generalize to general replace algorithm
  */
 StringAutomaton_ptr StringAutomaton::RemoveReservedWords() {
+	DFAContext dfa_context;
 	if(this->num_of_bdd_variables_ < 9) {
 		LOG(FATAL) << "can't remove reserved words without first having extra bit";
 	}
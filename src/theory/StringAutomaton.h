@@ -12,6 +12,7 @@
 #include <cstring>
 #include <iterator>
 #include <map>
+#include <random>
 #include <set>
 #include <sstream>
 #include <stack>
@@ -190,6 +191,11 @@ public:
 
   StringAutomaton_ptr Complement();
   StringAutomaton_ptr Intersect(StringAutomaton_ptr);
+  /**
+   * Intersects all automata at once, single track automata are aligned to the multi-track ones first.
+   * See Automaton::DFAIntersect for the order of the products
+   */
+  static StringAutomaton_ptr Intersect(const std::vector<StringAutomaton_ptr>& autos);
   StringAutomaton_ptr Union(StringAutomaton_ptr);
   StringAutomaton_ptr Difference(StringAutomaton_ptr);
   StringAutomaton_ptr Concat(StringAutomaton_ptr);
@@ -236,6 +242,11 @@ public:
   StringAutomaton_ptr GetAnyStringNotContainsMe();
 
   UnaryAutomaton_ptr ToUnaryAutomaton();
+
+  /**
+   * @return lengths of the accepted strings, computed from the state graph without projecting the character bits
+   */
+  SemilinearSet_ptr GetLengthSemilinearSet();
   IntAutomaton_ptr ParseToIntAutomaton();
   IntAutomaton_ptr Length();
   StringAutomaton_ptr RestrictLengthTo(int length);
@@ -278,6 +289,23 @@ public:
   bool IsAcceptingSingleString();
   std::string GetAnAcceptingString();
   std::string GetAnAcceptingStringRandom();
+  /**
+   * Draws strings uniformly among the accepted strings of length up to the bound, see UniformSampler
+   * @param num_of_strings
+   * @param bound
+   * @param rng
+   * @return
+   */
+  std::vector<std::string> GetAcceptingStringsUniform(const unsigned num_of_strings, const unsigned long bound,
+                                                      std::mt19937_64& rng);
+
+  /**
+   * Decodes an accepted word, e.g., one given by ModelEnumerator, into the values of the tracks; lambda characters of
+   * multi-track words are skipped
+   * @param bits
+   * @return value of each variable of the formula
+   */
+  std::map<std::string, std::string> GetModelFromBits(const std::vector<bool>& bits);
 
   StringFormula_ptr GetFormula();
   void SetFormula(StringFormula_ptr formula);
@@ -306,6 +334,10 @@ public:
 protected:
   bool HasExceptionToValidStateFrom(int state, std::vector<char>& exception);
   std::vector<int> GetAcceptingStates();
+  /**
+   * Decodes an accepted word of a single track automaton, see getAnAcceptingWord
+   */
+  std::string GetStringFromBits(const std::vector<bool>& bits);
 
   StringAutomaton_ptr IndexOfHelper(StringAutomaton_ptr search_auto);
   StringAutomaton_ptr LastIndexOfHelper(StringAutomaton_ptr search_auto);
@@ -12,6 +12,8 @@ namespace Theory {
 
 const int SymbolicCounter::VLOG_LEVEL = 9;
 
+const long SymbolicCounter::PARALLEL_THRESHOLD = 1024;
+
 SymbolicCounter::SymbolicCounter() : type_(SymbolicCounter::Type::STRING), bound_(0) {
 
 }
@@ -49,6 +51,9 @@ Eigen::SparseMatrix<BigInteger> SymbolicCounter::get_transition_count_matrix() c
 
 void SymbolicCounter::set_transition_count_matrix(const Eigen::SparseMatrix<BigInteger>& transition_count_matrix) {
   transition_count_matrix_ = transition_count_matrix;
+  squared_matrices_.clear();
+  recurrence_ = LinearRecurrence();
+  row_major_matrix_.resize(0, 0);
 }
 
 BigInteger SymbolicCounter::Count(const unsigned long bound) {
@@ -61,104 +66,279 @@ BigInteger SymbolicCounter::Count(const unsigned long bound) {
     power = (base << bound) - 1;
   }
 
+  // bound_ keeps the number of transitions taken so far, reuse count vector if we can
+  const unsigned long steps = power;
   if (power >= bound_) {
     power = power - bound_;
   } else {
     initialization_vector_ = transition_count_matrix_.innerVector(transition_count_matrix_.cols()-1);
   }
 
+  initialization_vector_ = Multiply(initialization_vector_, power);
+
+  bound_ = steps;
+
+  DVLOG(VLOG_LEVEL) << "Count(" << bound << ") = " << initialization_vector_.coeff(0);
+  return initialization_vector_.coeff(0);
+}
+
+BigInteger SymbolicCounter::Count(const unsigned long bound, const Method method) {
+  switch (method) {
+    case Method::MATRIX_EXPONENTIATION:
+      return CountbyMatrixMultiplication(bound);
+    case Method::LINEAR_RECURRENCE:
+      return CountbyLinearRecurrence(bound);
+    case Method::FIXED_WIDTH:
+      return CountbyFixedWidth(bound);
+    case Method::MODULAR:
+      return CountbyModularArithmetic(bound);
+    default:
+      return Count(bound);
+  }
+}
+
+/**
+ * Counts for all bounds; iterative counting visits bounds in ascending order so that the count vector is propagated
+ * once up to the largest bound.
+ */
+std::vector<BigInteger> SymbolicCounter::CountAll(const std::vector<unsigned long>& bounds, const Method method) {
+  std::vector<BigInteger> results(bounds.size());
+  std::vector<std::size_t> order(bounds.size());
+  std::iota(order.begin(), order.end(), 0);
+  if (Method::ITERATIVE == method) {
+    std::stable_sort(order.begin(), order.end(), [&bounds](std::size_t i, std::size_t j) {
+      return bounds[i] < bounds[j];
+    });
+  }
+
+  for (auto i : order) {
+    results[i] = Count(bounds[i], method);
+  }
+  return results;
+}
+
+/**
+ * Counting with matrix exponentiation by successive squaring.
+ * Computes matrix^power * initialization vector by multiplying the count vector with matrix^(2^i) for each bit i set in
+ * the power, squares are cached for subsequent queries. Does not touch the cached count vector of iterative counting.
+ */
+BigInteger SymbolicCounter::CountbyMatrixMultiplication(const unsigned long bound) {
+  BigInteger power = GetPower(bound);
+  Eigen::SparseVector<BigInteger> count_vector = transition_count_matrix_.innerVector(transition_count_matrix_.cols()-1);
+
+  if (squared_matrices_.empty()) {
+    squared_matrices_.push_back(transition_count_matrix_);
+  }
+
+  std::size_t i = 0;
   while (power > 0) {
-    initialization_vector_ = transition_count_matrix_ * initialization_vector_;
-    --power;
+    if (i == squared_matrices_.size()) {
+      Eigen::SparseMatrix<BigInteger> square = squared_matrices_.back() * squared_matrices_.back();
+      square.makeCompressed();
+      squared_matrices_.push_back(square);
+    }
+    if (boost::multiprecision::bit_test(power, 0)) {
+      count_vector = squared_matrices_[i] * count_vector;
+    }
+    power >>= 1;
+    ++i;
   }
 
-  bound_ = bound;
-  if (SymbolicCounter::Type::BINARYINT == type_) {
-    ++bound_; // handle sign bit
+  DVLOG(VLOG_LEVEL) << "CountbyMatrixMultiplication(" << bound << ") = " << count_vector.coeff(0);
+  return count_vector.coeff(0);
+}
+
+BigInteger SymbolicCounter::CountbyLinearRecurrence(const unsigned long bound) {
+  BigInteger result = GetLinearRecurrence().Evaluate(GetPower(bound));
+  DVLOG(VLOG_LEVEL) << "CountbyLinearRecurrence(" << bound << ") = " << result;
+  return result;
+}
+
+/**
+ * Propagates the count vector with machine words while the counts fit in 64 bits, finishes the remaining steps with
+ * big integers. Falls back to iterative counting if the matrix has entries that do not fit in 64 bits, and to matrix
+ * exponentiation if the number of transitions does not fit in 64 bits.
+ */
+BigInteger SymbolicCounter::CountbyFixedWidth(const unsigned long bound) {
+  unsigned long power = 0;
+  if (not GetFixedWidthPower(bound, power)) {
+    return CountbyMatrixMultiplication(bound);
   }
 
+  FixedWidthCountMatrix matrix(transition_count_matrix_);
+  if (not matrix.is_fixed_width()) {
+    return Count(bound);
+  }
 
-  DVLOG(VLOG_LEVEL) << "Count(" << bound << ") = " << initialization_vector_.coeff(0);
-  return initialization_vector_.coeff(0);
+  const auto init_column = transition_count_matrix_.cols() - 1;
+  std::vector<uint64_t> count_vector(matrix.size(), 0);
+  for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(transition_count_matrix_, init_column); it; ++it) {
+    count_vector[it.row()] = static_cast<uint64_t>(it.value());
+  }
+
+  unsigned long steps = matrix.Multiply(count_vector, power);
+  if (steps == power) {
+    DVLOG(VLOG_LEVEL) << "CountbyFixedWidth(" << bound << ") = " << count_vector[0];
+    return BigInteger(count_vector[0]);
+  }
+
+  Eigen::SparseVector<BigInteger> big_count_vector(matrix.size());
+  for (std::size_t i = 0; i < count_vector.size(); ++i) {
+    if (count_vector[i] != 0) {
+      big_count_vector.insert(i) = BigInteger(count_vector[i]);
+    }
+  }
+  big_count_vector = Multiply(big_count_vector, power - steps);
+
+  DVLOG(VLOG_LEVEL) << "CountbyFixedWidth(" << bound << ") = " << big_count_vector.coeff(0);
+  return big_count_vector.coeff(0);
 }
 
-BigInteger SymbolicCounter::CountbyMatrixMultiplication(const unsigned long bound) {
-  LOG(FATAL) << "not fixed yet";
-  return 0;
-  //  // matrix exponentiation is off by 1 because of artificial accepting state
-//  int power = bound + 1;
-//
-//  Eigen::SparseMatrix<BigInteger> y;
-//  bool has_odds = false;
-//
-//  while (power > 1) {
-//    if (power % 2 == 0) {
-//      power = power / 2;
-//    } else {
-//      power = (power - 1) / 2;
-//      if (has_odds) {
-//        y = x * y;
-//      } else {
-//        y = x;
-//        has_odds = true;
-//      }
-//    }
-//    x = x * x;
-//  }
-//
-//  if (has_odds) {
-//    x = x * y;
-//  }
-//
-//  BigInteger result = x.coeff(this->dfa_->s, this->dfa_->ns);
-//  return result;
+/**
+ * Propagates residues of the count vector modulo k primes, k is chosen so that the product of primes exceeds the
+ * bit bound of the result. Falls back to matrix exponentiation if the number of transitions does not fit in 64 bits.
+ */
+BigInteger SymbolicCounter::CountbyModularArithmetic(const unsigned long bound) {
+  unsigned long power = 0;
+  if (not GetFixedWidthPower(bound, power)) {
+    return CountbyMatrixMultiplication(bound);
+  }
+
+  FixedWidthCountMatrix matrix(transition_count_matrix_);
+  const BigInteger num_of_bits = matrix.GetResultBitBound(power);
+  // each prime is larger than 2^60
+  const auto primes = FixedWidthCountMatrix::GetPrimes(static_cast<std::size_t>(num_of_bits / 60 + 1));
+  const std::size_t k = primes.size();
+
+  const auto init_column = transition_count_matrix_.cols() - 1;
+  std::vector<uint64_t> count_vector(matrix.size() * k, 0);
+  for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(transition_count_matrix_, init_column); it; ++it) {
+    for (std::size_t i = 0; i < k; ++i) {
+      count_vector[it.row() * k + i] = static_cast<uint64_t>(it.value() % primes[i]);
+    }
+  }
+
+  matrix.MultiplyModular(count_vector, primes, power);
+  BigInteger result = FixedWidthCountMatrix::ReconstructFromResidues(&count_vector[0], primes);
+  DVLOG(VLOG_LEVEL) << "CountbyModularArithmetic(" << bound << ") = " << result << " (" << k << " primes)";
+  return result;
 }
 
+const LinearRecurrence& SymbolicCounter::GetLinearRecurrence() {
+  if (recurrence_.is_empty()) {
+    SetLinearRecurrence();
+  }
+  return recurrence_;
+}
+
+/**
+ * Counts one transition at a time from the initialization vector until there are num_models models or the counts do
+ * not change anymore. bound_ is left at the number of transitions taken, like iterative counting leaves it.
+ * @return number of transitions to take for num_models models, or for all models if there are fewer
+ */
 int SymbolicCounter::GetMinBound(int num_models) {
+  // start from zero transitions, models below the transitions taken by an earlier query would be missed otherwise
+  initialization_vector_ = transition_count_matrix_.innerVector(transition_count_matrix_.cols()-1);
+  bound_ = 0;
+
+  int min_bound = INT_MAX;
+  while (bound_ < static_cast<unsigned long>(INT_MAX)) {
+    auto before_vector(initialization_vector_);
+    initialization_vector_ = Multiply(initialization_vector_, 1);
+    ++bound_;
+    if (initialization_vector_.coeff(0) >= num_models) {
+      min_bound = bound_;
+      break;
+    } else if (before_vector.isApprox(initialization_vector_)) {
+      // the last transition did not add models
+      min_bound = bound_ - 1;
+      break;
+    }
+  }
 
+  return min_bound;
+}
 
-	unsigned long bound = INT_MAX;
-	unsigned long power = bound;
-
-	if (SymbolicCounter::Type::BINARYINT == type_) {
-		++power; // handle sign bit
-	} else if (SymbolicCounter::Type::UNARYINT == type_) {
-		unsigned long base = 1;
-		power = (base << bound) - 1;
-	}
-
-	if (power >= bound_) {
-		power = power - bound_;
-	} else {
-		initialization_vector_ = transition_count_matrix_.innerVector(transition_count_matrix_.cols()-1);
-	}
-
-	int count = 0;
-	int min_bound = INT_MAX;
-	while (power > 0) {
-		auto before_vector(initialization_vector_);
-		initialization_vector_ = transition_count_matrix_ * initialization_vector_;
-		--power;
-		count++;
-		// if we have enough models, or the count vector doesn't change, return with
-		// the corresponding bound
-		if(initialization_vector_.coeff(0) >= num_models) {
-			min_bound = count;
-			break;
-		} else if(before_vector.isApprox(initialization_vector_)) {
-			// -1 for incrementing count when not needed
-			count--;
-			min_bound = count;
-			break;
-		}
-	}
-
-	bound_ = min_bound;
-	if (SymbolicCounter::Type::BINARYINT == type_) {
-		++bound_; // handle sign bit
-	}
-
-	return min_bound;
+/**
+ * Number of transitions to take for the given bound, one extra for the sign bit of binary ints,
+ * 2^bound - 1 for unary ints.
+ */
+BigInteger SymbolicCounter::GetPower(const unsigned long bound) const {
+  BigInteger power(bound);
+  if (SymbolicCounter::Type::BINARYINT == type_) {
+    ++power; // handle sign bit
+  } else if (SymbolicCounter::Type::UNARYINT == type_) {
+    BigInteger base(1);
+    power = (base << bound) - 1;
+  }
+  return power;
+}
+
+bool SymbolicCounter::GetFixedWidthPower(const unsigned long bound, unsigned long& power) const {
+  BigInteger big_power = GetPower(bound);
+  if (big_power > std::numeric_limits<unsigned long>::max()) {
+    DVLOG(VLOG_LEVEL) << "bound " << bound << " takes more than 2^64 transitions";
+    return false;
+  }
+  power = static_cast<unsigned long>(big_power);
+  return true;
+}
+
+/**
+ * Returns matrix^steps * count_vector; large matrices are multiplied row partitioned on the shared thread pool.
+ */
+Eigen::SparseVector<BigInteger> SymbolicCounter::Multiply(const Eigen::SparseVector<BigInteger>& count_vector,
+                                                          const unsigned long steps) {
+  if (steps == 0) {
+    return count_vector;
+  }
+  if (transition_count_matrix_.nonZeros() < PARALLEL_THRESHOLD
+      or Util::ThreadPool::GetInstance().get_num_of_threads() == 1) {
+    Eigen::SparseVector<BigInteger> result = count_vector;
+    for (unsigned long i = 0; i < steps; ++i) {
+      result = transition_count_matrix_ * result;
+    }
+    return result;
+  }
+
+  if (row_major_matrix_.rows() != transition_count_matrix_.rows()) {
+    row_major_matrix_ = transition_count_matrix_;
+    row_major_matrix_.makeCompressed();
+  }
+
+  std::vector<BigInteger> x(count_vector.size(), 0), y;
+  for (Eigen::SparseVector<BigInteger>::InnerIterator it(count_vector); it; ++it) {
+    x[it.index()] = it.value();
+  }
+  for (unsigned long i = 0; i < steps; ++i) {
+    Util::Math::multiply_sparse_multi_thread(row_major_matrix_, x, y);
+    x.swap(y);
+  }
+
+  Eigen::SparseVector<BigInteger> result(count_vector.size());
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    if (x[i] != 0) {
+      result.insert(i) = x[i];
+    }
+  }
+  return result;
+}
+
+/**
+ * Counts satisfy a recurrence whose order is at most the matrix dimension (Cayley-Hamilton),
+ * twice that many terms are enough to find it exactly.
+ */
+void SymbolicCounter::SetLinearRecurrence() {
+  const Eigen::SparseMatrix<BigInteger>::Index num_of_terms = 2 * transition_count_matrix_.rows();
+  std::vector<BigInteger> sequence;
+  sequence.reserve(num_of_terms);
+  Eigen::SparseVector<BigInteger> count_vector = transition_count_matrix_.innerVector(transition_count_matrix_.cols()-1);
+  for (Eigen::SparseMatrix<BigInteger>::Index i = 0; i < num_of_terms; ++i) {
+    sequence.push_back(count_vector.coeff(0));
+    count_vector = Multiply(count_vector, 1);
+  }
+  recurrence_ = LinearRecurrence::Make(sequence);
+  DVLOG(VLOG_LEVEL) << "recurrence: " << std::endl << recurrence_;
 }
 
 std::string SymbolicCounter::str() const {
@@ -167,6 +347,9 @@ std::string SymbolicCounter::str() const {
   ss << "last bound  : " << bound_ << std::endl;
   ss << "init vector : " << std::endl << initialization_vector_ << std::endl;
   ss << "symb matrix : " << std::endl << transition_count_matrix_ << std::endl;
+  if (not recurrence_.is_empty()) {
+    ss << "recurrence  : " << std::endl << recurrence_;
+  }
   return ss.str();
 }
 
@@ -8,13 +8,18 @@
 #ifndef SRC_THEORY_SYMBOLICCOUNTER_H_
 #define SRC_THEORY_SYMBOLICCOUNTER_H_
 
+#include <algorithm>
+#include <numeric>
 #include <ostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <glog/logging.h>
 
 #include "../utils/Serialize.h"
+#include "FixedWidthCountMatrix.h"
+#include "LinearRecurrence.h"
 
 namespace Vlab {
 namespace Theory {
@@ -25,6 +30,18 @@ class SymbolicCounter {
     : int {
       STRING, UNARYINT, BINARYINT, BINARYUNSIGNEDINT
   };
+  /**
+   * How the count vector is propagated to the requested bound:
+   * ITERATIVE does one matrix-vector product per unit of bound and reuses the count vector of the previous query,
+   * MATRIX_EXPONENTIATION does successive squaring of the transition count matrix (O(log bound) matrix products),
+   * LINEAR_RECURRENCE derives the recurrence of the counts once and evaluates it for the bound,
+   * FIXED_WIDTH iterates with 64 bit words and switches to big integers once a count overflows,
+   * MODULAR iterates modulo enough 61 bit primes to cover the result and reconstructs the count with CRT.
+   */
+  enum class Method
+    : int {
+      ITERATIVE, MATRIX_EXPONENTIATION, LINEAR_RECURRENCE, FIXED_WIDTH, MODULAR
+  };
   SymbolicCounter();
   virtual ~SymbolicCounter();
 
@@ -38,7 +55,14 @@ class SymbolicCounter {
   void set_transition_count_matrix(const Eigen::SparseMatrix<BigInteger>& transition_count_matrix);
 
   BigInteger Count(const unsigned long bound);
+  BigInteger Count(const unsigned long bound, const Method method);
+  std::vector<BigInteger> CountAll(const std::vector<unsigned long>& bounds, const Method method = Method::ITERATIVE);
   BigInteger CountbyMatrixMultiplication(const unsigned long bound);
+  BigInteger CountbyLinearRecurrence(const unsigned long bound);
+  BigInteger CountbyFixedWidth(const unsigned long bound);
+  BigInteger CountbyModularArithmetic(const unsigned long bound);
+  const LinearRecurrence& GetLinearRecurrence();
+  BigInteger GetPower(const unsigned long bound) const;
   int GetMinBound(int num_models);
 
   template <class Archive>
@@ -47,6 +71,7 @@ class SymbolicCounter {
     ar(bound_);
     Util::Serialize::save(ar, initialization_vector_);
     Util::Serialize::save(ar, transition_count_matrix_);
+    ar(recurrence_);
   }
 
   template <class Archive>
@@ -57,17 +82,45 @@ class SymbolicCounter {
     ar(bound_);
     Util::Serialize::load(ar, initialization_vector_);
     Util::Serialize::load(ar, transition_count_matrix_);
+    ar(recurrence_);
+    squared_matrices_.clear();
+    row_major_matrix_.resize(0, 0);
   }
 
   std::string str() const;
   friend std::ostream& operator<<(std::ostream& os, const SymbolicCounter& sc);
 protected:
+  void SetLinearRecurrence();
+  /**
+   * @param power set to the number of transitions to take for the bound
+   * @return false if the number of transitions does not fit in 64 bits
+   */
+  bool GetFixedWidthPower(const unsigned long bound, unsigned long& power) const;
+  Eigen::SparseVector<BigInteger> Multiply(const Eigen::SparseVector<BigInteger>& count_vector, const unsigned long steps);
+
   Type type_;
+  /**
+   * Number of transitions the initialization vector has taken, not the bound of the last query.
+   */
   unsigned long bound_;
   Eigen::SparseVector<BigInteger> initialization_vector_;
   Eigen::SparseMatrix<BigInteger> transition_count_matrix_;
+  /**
+   * Cache of successive squares of the transition count matrix, i^th element is matrix^(2^i).
+   * Not serialized, rebuilt on demand.
+   */
+  std::vector<Eigen::SparseMatrix<BigInteger>> squared_matrices_;
+  /**
+   * Recurrence satisfied by the counts, empty until first requested.
+   */
+  LinearRecurrence recurrence_;
+  /**
+   * Row major copy of the transition count matrix for parallel multiplication, built on demand.
+   */
+  Eigen::SparseMatrix<BigInteger, Eigen::RowMajor> row_major_matrix_;
 private:
   static const int VLOG_LEVEL;
+  static const long PARALLEL_THRESHOLD;
 };
 
 } /* namespace Theory */
@@ -59,6 +59,7 @@ UnaryAutomaton_ptr UnaryAutomaton::MakeAutomaton(DFA_ptr dfa, Formula_ptr formul
 }
 
 UnaryAutomaton_ptr UnaryAutomaton::MakeAutomaton(SemilinearSet_ptr semilinear_set) {
+  DFAContext dfa_context;
   UnaryAutomaton_ptr unary_auto = nullptr;
   DFA_ptr unary_dfa = nullptr, tmp_dfa = nullptr;
 
@@ -200,6 +201,7 @@ SemilinearSet_ptr UnaryAutomaton::getSemilinearSet() {
 }
 
 IntAutomaton_ptr UnaryAutomaton::toIntAutomaton(int number_of_variables, bool add_minus_one) {
+  DFAContext dfa_context;
   IntAutomaton_ptr int_auto = nullptr;
   DFA_ptr int_dfa = nullptr;
   int* indices = GetBddVariableIndices(number_of_variables);
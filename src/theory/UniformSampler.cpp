@@ -0,0 +1,167 @@
+/*
+ * UniformSampler.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "UniformSampler.h"
+
+#include <stack>
+
+#include "DFAContext.h"
+
+namespace Vlab {
+namespace Theory {
+
+const int UniformSampler::VLOG_LEVEL = 12;
+
+UniformSampler::UniformSampler(Automaton_ptr automaton, const unsigned long bound, const bool is_exact_bound)
+    : bound_ {bound},
+      is_exact_bound_ {is_exact_bound} {
+  DFAContext dfa_context;
+  DFA_ptr dfa = automaton->getDFA();
+  const int num_of_states = dfa->ns;
+  initial_state_ = dfa->s;
+  num_of_bdd_variables_ = automaton->get_number_of_bdd_variables();
+
+  unsigned left, right, index;  // BDD traversal variables
+  transitions_.resize(num_of_states);
+  for (int s = 0; s < num_of_states; ++s) {
+    std::stack<std::pair<unsigned, std::vector<std::pair<unsigned, bool>>>> bdd_node_stack;
+    bdd_node_stack.push({dfa->q[s], {}});
+    while (not bdd_node_stack.empty()) {
+      auto current = bdd_node_stack.top();
+      bdd_node_stack.pop();
+      LOAD_lri(&dfa->bddm->node_table[current.first], left, right, index);
+      if (index == BDD_LEAF_INDEX) {
+        const unsigned num_of_free_bits = num_of_bdd_variables_ - current.second.size();
+        transitions_[s].push_back({static_cast<int>(left), current.second, num_of_free_bits});
+      } else {
+        auto left_bits = current.second;
+        left_bits.push_back({index, false});
+        current.second.push_back({index, true});
+        bdd_node_stack.push({left, left_bits});
+        bdd_node_stack.push({right, current.second});
+      }
+    }
+  }
+
+  // per state counts are propagated with the count matrix, the last column marks accepting states
+  auto count_matrix = automaton->GetSymbolicCounter().get_transition_count_matrix();
+  CHECK_EQ(num_of_states + 1, count_matrix.rows()) << "count matrix does not match the dfa states";
+  num_of_words_.resize(bound_ + 1, std::vector<BigInteger>(num_of_states, 0));
+  for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(count_matrix, num_of_states); it; ++it) {
+    if (it.row() < num_of_states and it.value() != 0) {
+      num_of_words_[0][it.row()] = 1;
+    }
+  }
+  for (unsigned long k = 1; k <= bound_; ++k) {
+    for (int t = 0; t < num_of_states; ++t) {
+      if (num_of_words_[k - 1][t] == 0) {
+        continue;
+      }
+      for (Eigen::SparseMatrix<BigInteger>::InnerIterator it(count_matrix, t); it; ++it) {
+        if (it.row() < num_of_states) {
+          num_of_words_[k][it.row()] += it.value() * num_of_words_[k - 1][t];
+        }
+      }
+    }
+  }
+
+  total_num_of_words_ = 0;
+  for (unsigned long k = (is_exact_bound_ ? bound_ : 0); k <= bound_; ++k) {
+    total_num_of_words_ += num_of_words_[k][initial_state_];
+  }
+  DVLOG(VLOG_LEVEL) << "uniform sampler over " << total_num_of_words_ << " words up to length " << bound_;
+}
+
+UniformSampler::~UniformSampler() {
+}
+
+bool UniformSampler::IsEmpty() const {
+  return total_num_of_words_ == 0;
+}
+
+BigInteger UniformSampler::get_num_of_words() const {
+  return total_num_of_words_;
+}
+
+/**
+ * A single number below the total number of words identifies a word, it is decoded by subtracting the number of words
+ * of each length and of each transition in a fixed order; free bits of a transition are read from the quotient.
+ */
+std::vector<bool> UniformSampler::Sample(std::mt19937_64& rng) const {
+  CHECK(not IsEmpty()) << "cannot sample from an empty language";
+  BigInteger rank = RandomBelow(total_num_of_words_, rng);
+
+  unsigned long length = (is_exact_bound_ ? bound_ : 0);
+  while (rank >= num_of_words_[length][initial_state_]) {
+    rank -= num_of_words_[length][initial_state_];
+    ++length;
+  }
+
+  std::vector<bool> word;
+  word.reserve(length * num_of_bdd_variables_);
+  int state = initial_state_;
+  for (unsigned long remaining = length; remaining > 0; --remaining) {
+    const auto& next_num_of_words = num_of_words_[remaining - 1];
+    for (const auto& transition : transitions_[state]) {
+      const BigInteger& num_of_suffixes = next_num_of_words[transition.to_state];
+      if (num_of_suffixes == 0) {
+        continue;
+      }
+      BigInteger num_of_words = num_of_suffixes << transition.num_of_free_bits;
+      if (rank >= num_of_words) {
+        rank -= num_of_words;
+        continue;
+      }
+
+      BigInteger free_bits = rank / num_of_suffixes;
+      rank %= num_of_suffixes;
+      std::vector<bool> letter(num_of_bdd_variables_, false);
+      std::vector<bool> is_fixed(num_of_bdd_variables_, false);
+      for (const auto& bit : transition.fixed_bits) {
+        letter[bit.first] = bit.second;
+        is_fixed[bit.first] = true;
+      }
+      for (int i = 0; i < num_of_bdd_variables_; ++i) {
+        if (not is_fixed[i]) {
+          letter[i] = ((free_bits & 1) == 1);
+          free_bits >>= 1;
+        }
+      }
+      word.insert(word.end(), letter.begin(), letter.end());
+      state = transition.to_state;
+      break;
+    }
+  }
+  return word;
+}
+
+std::vector<std::vector<bool>> UniformSampler::Sample(const unsigned num_of_samples, std::mt19937_64& rng) const {
+  std::vector<std::vector<bool>> words;
+  words.reserve(num_of_samples);
+  for (unsigned i = 0; i < num_of_samples; ++i) {
+    words.push_back(Sample(rng));
+  }
+  return words;
+}
+
+BigInteger UniformSampler::RandomBelow(const BigInteger& limit, std::mt19937_64& rng) {
+  const unsigned num_of_bits = boost::multiprecision::msb(limit) + 1;
+  const BigInteger mask = (BigInteger(1) << num_of_bits) - 1;
+  while (true) {
+    BigInteger value = 0;
+    for (unsigned i = 0; i < num_of_bits; i += 64) {
+      value = (value << 64) | BigInteger(rng());
+    }
+    value &= mask;
+    if (value < limit) {
+      return value;
+    }
+  }
+}
+
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,83 @@
+/*
+ * UniformSampler.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_THEORY_UNIFORMSAMPLER_H_
+#define SRC_THEORY_UNIFORMSAMPLER_H_
+
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include "Automaton.h"
+
+namespace Vlab {
+namespace Theory {
+
+/**
+ * Draws accepted words of an automaton uniformly at random among the words up to a length bound.
+ * Number of accepted words of each length from each state is computed once from the transition count matrix of the
+ * symbolic counter, a word is then chosen by picking its length and each of its transitions with probability
+ * proportional to the number of words they lead to.
+ * Words are bit vectors in the format of Automaton::getAnAcceptingWord, one block of bdd variables per transition.
+ */
+class UniformSampler {
+ public:
+  /**
+   * @param automaton its counter must have a row for each dfa state, e.g., single track string automata
+   * @param bound length bound in number of transitions
+   * @param is_exact_bound samples only words of length exactly bound
+   */
+  UniformSampler(Automaton_ptr automaton, const unsigned long bound, const bool is_exact_bound = false);
+  virtual ~UniformSampler();
+
+  bool IsEmpty() const;
+
+  /**
+   * @return number of words samples are drawn from
+   */
+  BigInteger get_num_of_words() const;
+
+  std::vector<bool> Sample(std::mt19937_64& rng) const;
+  std::vector<std::vector<bool>> Sample(const unsigned num_of_samples, std::mt19937_64& rng) const;
+
+ protected:
+  /**
+   * A path of a transition bdd, variables not on the path are free
+   */
+  struct Transition {
+    int to_state;
+    std::vector<std::pair<unsigned, bool>> fixed_bits;
+    unsigned num_of_free_bits;
+  };
+
+  /**
+   * @return a uniformly chosen number in [0, limit)
+   */
+  static BigInteger RandomBelow(const BigInteger& limit, std::mt19937_64& rng);
+
+  int initial_state_;
+  int num_of_bdd_variables_;
+  unsigned long bound_;
+  bool is_exact_bound_;
+  std::vector<std::vector<Transition>> transitions_;
+
+  /**
+   * num_of_words_[k][s] is the number of accepted words of length k read from state s
+   */
+  std::vector<std::vector<BigInteger>> num_of_words_;
+  BigInteger total_num_of_words_;
+
+ private:
+  static const int VLOG_LEVEL;
+};
+
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* SRC_THEORY_UNIFORMSAMPLER_H_ */
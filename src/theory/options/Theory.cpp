@@ -15,6 +15,8 @@ namespace Option {
 
 std::string Theory::TMP_PATH     = ".";
 std::string Theory::SCRIPT_PATH  = ".";
+std::size_t Theory::AUTOMATON_CACHE_SIZE = 256;
+int Theory::SYMBOLIC_ARITHMETIC_THRESHOLD = 8;
 
 } /* namespace Option */
 } /* namespace Vlab */
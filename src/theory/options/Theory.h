@@ -11,6 +11,7 @@
 #ifndef SRC_OPTIONS_THEORY_H_
 #define SRC_OPTIONS_THEORY_H_
 
+#include <cstddef>
 #include <string>
 
 namespace Vlab {
@@ -20,6 +21,15 @@ class Theory {
 public:
   static std::string TMP_PATH;
   static std::string SCRIPT_PATH;
+  /**
+   * Memory budget of the automata operation cache in megabytes, 0 disables the cache.
+   */
+  static std::size_t AUTOMATON_CACHE_SIZE;
+  /**
+   * Linear arithmetic automata with at least this many variables are built as bdds instead of enumerating the
+   * transitions of each carry state, 0 builds all of them as bdds
+   */
+  static int SYMBOLIC_ARITHMETIC_THRESHOLD;
 };
 
 } /* namespace Option */
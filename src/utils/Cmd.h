@@ -1,25 +0,0 @@
-/*
- * Cmd.h
- *
- *  Created on: Dec 15, 2015
- *      Author: baki
- */
-
-#ifndef SRC_UTILS_CMD_H_
-#define SRC_UTILS_CMD_H_
-
-#include <stdio.h>
-#include <string>
-#include <sstream>
-
-namespace Vlab {
-namespace Util {
-namespace Cmd {
-
-std::string run_cmd(std::string cmd);
-
-} /* namespace Cmd */
-} /* namespace Util */
-} /* namespace Vlab */
-
-#endif /* SRC_UTILS_CMD_H_ */
@@ -15,6 +15,8 @@
 
 #include "../boost/multiprecision/cpp_int.hpp"
 #include "../Eigen/Core"
+#include "../Eigen/SparseCore"
+#include "ThreadPool.h"
 
 namespace Vlab {
 namespace Theory {
@@ -97,6 +99,52 @@ Matrix<T> multiply_matrix_multi_thread(const Matrix<T>& x, const Matrix<T>& y) {
   return std::move(result);
 }
 
+/**
+ * Multiplies all factors with a balanced product tree, the multiplications of each level run in parallel.
+ * Keeps the operands of each multiplication similar in size, which is cheaper than a left to right product for big
+ * integers.
+ */
+template <class T>
+T multiply_all_multi_thread(std::vector<T> factors) {
+  if (factors.empty()) {
+    return T(1);
+  }
+  while (factors.size() > 1) {
+    const std::size_t num_of_pairs = factors.size() / 2;
+    std::vector<T> products((factors.size() + 1) / 2);
+    ThreadPool::GetInstance().ParallelFor(0, num_of_pairs, num_of_pairs,
+                                          [&factors, &products](std::size_t start, std::size_t end) -> void {
+      for (std::size_t i = start; i < end; ++i) {
+        products[i] = factors[2 * i] * factors[2 * i + 1];
+      }
+    });
+    if (factors.size() % 2 == 1) {
+      products.back() = std::move(factors.back());
+    }
+    factors.swap(products);
+  }
+  return std::move(factors.front());
+}
+
+/**
+ * result = matrix * x, rows of the matrix are partitioned among the threads of the shared thread pool.
+ */
+template <class T>
+void multiply_sparse_multi_thread(const Eigen::SparseMatrix<T, Eigen::RowMajor>& matrix, const std::vector<T>& x,
+                                  std::vector<T>& result) {
+  result.resize(matrix.rows());
+  auto multiply_rows = [&matrix, &x, &result](std::size_t start, std::size_t end) -> void {
+    for (std::size_t i = start; i < end; ++i) {
+      T sum = 0;
+      for (typename Eigen::SparseMatrix<T, Eigen::RowMajor>::InnerIterator it(matrix, i); it; ++it) {
+        sum += it.value() * x[it.col()];
+      }
+      result[i] = std::move(sum);
+    }
+  };
+  ThreadPool::GetInstance().ParallelFor(0, matrix.rows(), multiply_rows);
+}
+
 } /* namespace Math */
 } /* namespace Util */
 } /* namespace Vlab */
@@ -8,6 +8,8 @@
 #ifndef SRC_UTILS_SERIALIZE_H_
 #define SRC_UTILS_SERIALIZE_H_
 
+#include <vector>
+
 #include "../boost/multiprecision/cpp_int.hpp"
 #include "../Eigen/SparseCore"
 #include "../cereal/archives/binary.hpp"
@@ -41,6 +43,25 @@ void load(Archive& ar, Theory::BigInteger& big_integer) {
   big_integer.backend().normalize();
 }
 
+template<class Archive>
+void save(Archive& ar, const std::vector<Theory::BigInteger>& big_integers) {
+  std::size_t size = big_integers.size();
+  ar(size);
+  for (const auto& big_integer : big_integers) {
+    Util::Serialize::save(ar, big_integer);
+  }
+}
+
+template<class Archive>
+void load(Archive& ar, std::vector<Theory::BigInteger>& big_integers) {
+  std::size_t size = 0;
+  ar(size);
+  big_integers.resize(size);
+  for (auto& big_integer : big_integers) {
+    Util::Serialize::load(ar, big_integer);
+  }
+}
+
 template<class Archive>
 void save(Archive& ar, const Eigen::SparseVector<Theory::BigInteger>& sparse_vector) {
   ar(sparse_vector.size());
@@ -0,0 +1,191 @@
+/*
+ * ThreadPool.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ThreadPool.h"
+
+namespace Vlab {
+namespace Util {
+
+std::mutex ThreadPool::configuration_mutex_;
+std::size_t ThreadPool::configured_num_of_threads_ = 0;
+bool ThreadPool::is_started_ = false;
+
+ThreadPool& ThreadPool::GetInstance() {
+  static ThreadPool instance(GetConfiguredNumOfThreads());
+  return instance;
+}
+
+bool ThreadPool::Configure(std::size_t num_of_threads) {
+  std::lock_guard<std::mutex> lock(configuration_mutex_);
+  if (is_started_) {
+    return num_of_threads == configured_num_of_threads_;
+  }
+  configured_num_of_threads_ = num_of_threads;
+  return true;
+}
+
+std::size_t ThreadPool::GetConfiguredNumOfThreads() {
+  std::lock_guard<std::mutex> lock(configuration_mutex_);
+  is_started_ = true;
+  return configured_num_of_threads_;
+}
+
+ThreadPool::ThreadPool(std::size_t num_of_threads)
+    : stop_ {false} {
+  Start(num_of_threads);
+}
+
+ThreadPool::~ThreadPool() {
+  Stop();
+}
+
+std::size_t ThreadPool::get_num_of_threads() const {
+  return workers_.size() + 1;
+}
+
+void ThreadPool::ParallelFor(std::size_t begin, std::size_t end, std::size_t num_of_chunks,
+                             const std::function<void(std::size_t, std::size_t)>& loop_body) {
+  if (begin >= end) {
+    return;
+  }
+  const std::size_t size = end - begin;
+  if (num_of_chunks > size) {
+    num_of_chunks = size;
+  }
+  if (workers_.empty() or num_of_chunks <= 1) {
+    loop_body(begin, end);
+    return;
+  }
+
+  const std::size_t chunk_size = size / num_of_chunks;
+  std::size_t extra = size % num_of_chunks;
+  // queued chunks own the loop state, a worker still touches it after the caller sees the last chunk done
+  auto loop = std::make_shared<LoopState>();
+  loop->remaining = num_of_chunks;
+
+  auto run_chunk = [this, loop, &loop_body](std::size_t chunk_begin, std::size_t chunk_end) {
+    try {
+      loop_body(chunk_begin, chunk_end);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      loop->error = std::current_exception();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--loop->remaining == 0) {
+      state_changed_.notify_all();
+    }
+  };
+
+  // first chunk is run by the calling thread
+  std::size_t chunk_begin = begin;
+  std::size_t first_end = begin + chunk_size + (extra > 0 ? 1 : 0);
+  if (extra > 0) {
+    --extra;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::size_t next_begin = first_end;
+    for (std::size_t i = 1; i < num_of_chunks; ++i) {
+      std::size_t next_end = next_begin + chunk_size + (extra > 0 ? 1 : 0);
+      if (extra > 0) {
+        --extra;
+      }
+      tasks_.push_back([run_chunk, next_begin, next_end]() { run_chunk(next_begin, next_end); });
+      next_begin = next_end;
+    }
+  }
+  state_changed_.notify_all();
+
+  run_chunk(chunk_begin, first_end);
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (loop->remaining == 0) {
+        break;
+      }
+      if (tasks_.empty()) {
+        state_changed_.wait(lock, [this, &loop]() { return loop->remaining == 0 or not tasks_.empty(); });
+        continue;
+      }
+    }
+    RunPendingTask();
+  }
+
+  if (loop->error) {
+    std::rethrow_exception(loop->error);
+  }
+}
+
+void ThreadPool::ParallelFor(std::size_t begin, std::size_t end,
+                             const std::function<void(std::size_t, std::size_t)>& loop_body) {
+  // a few chunks per thread to balance uneven rows
+  ParallelFor(begin, end, 4 * get_num_of_threads(), loop_body);
+}
+
+void ThreadPool::Start(std::size_t num_of_threads) {
+  if (num_of_threads == 0) {
+    num_of_threads = std::thread::hardware_concurrency();
+  }
+  stop_ = false;
+  for (std::size_t i = 1; i < num_of_threads; ++i) {
+    workers_.push_back(std::thread(&ThreadPool::WorkerLoop, this));
+  }
+}
+
+void ThreadPool::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  state_changed_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+  workers_.clear();
+}
+
+void ThreadPool::Enqueue(Task task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  state_changed_.notify_all();
+}
+
+bool ThreadPool::RunPendingTask() {
+  Task task;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (tasks_.empty()) {
+      return false;
+    }
+    task = std::move(tasks_.front());
+    tasks_.pop_front();
+  }
+  task();
+  return true;
+}
+
+void ThreadPool::WorkerLoop() {
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      state_changed_.wait(lock, [this]() { return stop_ or not tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+} /* namespace Util */
+} /* namespace Vlab */
@@ -0,0 +1,110 @@
+/*
+ * ThreadPool.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SRC_UTILS_THREADPOOL_H_
+#define SRC_UTILS_THREADPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Vlab {
+namespace Util {
+
+/**
+ * Process wide pool of worker threads, created once and reused by all parallel loops.
+ * A thread waiting for its tasks executes queued tasks itself, so parallel loops can be nested.
+ */
+class ThreadPool {
+ public:
+  using Task = std::function<void()>;
+
+  static ThreadPool& GetInstance();
+
+  /**
+   * Number of threads that take part in a parallel loop, including the calling thread.
+   */
+  std::size_t get_num_of_threads() const;
+
+  /**
+   * Sets the number of threads the pool starts with; 0 uses all hardware threads, 1 runs everything on the calling
+   * thread. The pool starts on first use and is not resized afterwards, other drivers may be inside a parallel loop.
+   * @return false if the pool has already started with another number of threads
+   */
+  static bool Configure(std::size_t num_of_threads);
+
+  /**
+   * Splits [begin, end) into at most num_of_chunks contiguous ranges and runs loop_body(chunk_begin, chunk_end) on
+   * each range in parallel; returns when all ranges are done.
+   */
+  void ParallelFor(std::size_t begin, std::size_t end, std::size_t num_of_chunks,
+                   const std::function<void(std::size_t, std::size_t)>& loop_body);
+  void ParallelFor(std::size_t begin, std::size_t end, const std::function<void(std::size_t, std::size_t)>& loop_body);
+
+  /**
+   * Runs the task on a worker thread.
+   */
+  template <class Function>
+  auto Submit(Function function) -> std::future<decltype(function())> {
+    using Result = decltype(function());
+    auto task = std::make_shared<std::packaged_task<Result()>>(function);
+    auto future = task->get_future();
+    if (workers_.empty()) {
+      (*task)();
+    } else {
+      Enqueue([task]() { (*task)(); });
+    }
+    return future;
+  }
+
+ protected:
+  explicit ThreadPool(std::size_t num_of_threads);
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+  virtual ~ThreadPool();
+
+  /**
+   * State of a parallel loop, guarded by the pool mutex
+   */
+  struct LoopState {
+    std::size_t remaining;
+    std::exception_ptr error;
+  };
+
+  void Start(std::size_t num_of_threads);
+  void Stop();
+  void Enqueue(Task task);
+  bool RunPendingTask();
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::deque<Task> tasks_;
+  std::mutex mutex_;
+  /**
+   * Signaled when a task is queued, a parallel loop finishes or the pool stops.
+   */
+  std::condition_variable state_changed_;
+  bool stop_;
+
+  static std::size_t GetConfiguredNumOfThreads();
+  static std::mutex configuration_mutex_;
+  static std::size_t configured_num_of_threads_;
+  static bool is_started_;
+};
+
+} /* namespace Util */
+} /* namespace Vlab */
+
+#endif /* SRC_UTILS_THREADPOOL_H_ */
@@ -7,6 +7,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <iostream>
 
 #include "vlab_cs_ucsb_edu_DriverProxy.h"
@@ -41,6 +42,50 @@ jobject newBigInteger(JNIEnv *env, jstring value) {
   return big_integer;
 }
 
+jobjectArray newBigIntegerArray(JNIEnv *env, const std::vector<Vlab::Theory::BigInteger>& values) {
+  jclass big_integer_class = env->FindClass("java/math/BigInteger");
+  jobjectArray array = env->NewObjectArray(values.size(), big_integer_class, nullptr);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    std::stringstream ss;
+    ss << values[i];
+    jstring value_string = env->NewStringUTF(ss.str().c_str());
+    jobject big_integer = newBigInteger(env, value_string);
+    env->SetObjectArrayElement(array, i, big_integer);
+    env->DeleteLocalRef(big_integer);
+    env->DeleteLocalRef(value_string);
+  }
+  return array;
+}
+
+void throwIllegalArgumentException(JNIEnv *env, const std::string& message) {
+  jclass exception_class = env->FindClass("java/lang/IllegalArgumentException");
+  env->ThrowNew(exception_class, message.c_str());
+}
+
+/**
+ * Throws IllegalArgumentException for a null array or a negative bound
+ * @return false if an exception is thrown
+ */
+bool get_bounds(JNIEnv *env, jlongArray bounds, std::vector<unsigned long>& result) {
+  if (bounds == nullptr) {
+    throwIllegalArgumentException(env, "bounds must not be null");
+    return false;
+  }
+  jsize length = env->GetArrayLength(bounds);
+  jlong* buffer = env->GetLongArrayElements(bounds, nullptr);
+  for (jsize i = 0; i < length; ++i) {
+    if (buffer[i] < 0) {
+      std::string message = "bound must not be negative: " + std::to_string(buffer[i]);
+      env->ReleaseLongArrayElements(bounds, buffer, JNI_ABORT);
+      throwIllegalArgumentException(env, message);
+      return false;
+    }
+  }
+  result.assign(buffer, buffer + length);
+  env->ReleaseLongArrayElements(bounds, buffer, JNI_ABORT);
+  return true;
+}
+
 void load_model_counter(JNIEnv *env, Vlab::Solver::ModelCounter& mc, jbyteArray model_counter) {
   jsize length = env->GetArrayLength(model_counter);
   jbyte* buffer = env->GetByteArrayElements(model_counter, nullptr);
@@ -117,15 +162,74 @@ JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_isSatisfiable
   std::istringstream input_constraint;
   const char* constraint_str = env->GetStringUTFChars(constraint, JNI_FALSE);
   input_constraint.str(constraint_str);
+  env->ReleaseStringUTFChars(constraint, constraint_str);
   abc_driver->reset();
-  abc_driver->Parse(&input_constraint);
+  bool result = false;
+  try {
+    abc_driver->Parse(&input_constraint);
+    abc_driver->InitializeSolver();
+    abc_driver->Solve();
+    result = abc_driver->is_sat();
+  } catch (const std::exception& e) {
+    abc_driver->reset();
+    throwIllegalArgumentException(env, e.what());
+  }
+  return (jboolean)result;
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    assertIncremental
+ * Signature: (Ljava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_assertIncremental
+  (JNIEnv *env, jobject obj, jstring constraint) {
+
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  const char* constraint_str = env->GetStringUTFChars(constraint, JNI_FALSE);
+  std::string constraint_string {constraint_str};
   env->ReleaseStringUTFChars(constraint, constraint_str);
-  abc_driver->InitializeSolver();
-  abc_driver->Solve();
-  bool result = abc_driver->is_sat();
+  bool result = false;
+  try {
+    result = abc_driver->AssertIncremental(constraint_string);
+  } catch (const std::exception& e) {
+    throwIllegalArgumentException(env, e.what());
+    return (jboolean)result;
+  }
+  if (not abc_driver->get_incremental_error().empty()) {
+    throwIllegalArgumentException(env, abc_driver->get_incremental_error());
+  }
   return (jboolean)result;
 }
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    push
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_push
+  (JNIEnv *env, jobject obj) {
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  abc_driver->Push();
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    pop
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_pop
+  (JNIEnv *env, jobject obj, jint levels) {
+  if (levels < 0) {
+    throwIllegalArgumentException(env, "level count cannot be negative");
+    return;
+  }
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  if (not abc_driver->Pop(levels)) {
+    throwIllegalArgumentException(env, "cannot pop " + std::to_string(levels) + " levels");
+  }
+}
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    countVariable
@@ -193,6 +297,98 @@ JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_count__JJ
   return newBigInteger(env, result_string);
 }
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countVariable
+ * Signature: (Ljava/lang/String;[J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countVariable__Ljava_lang_String_2_3J
+  (JNIEnv *env, jobject obj, jstring var_name, jlongArray bounds) {
+
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  const char* var_name_arr = env->GetStringUTFChars(var_name, JNI_FALSE);
+  std::string var_name_str {var_name_arr};
+  env->ReleaseStringUTFChars(var_name, var_name_arr);
+  std::vector<unsigned long> count_bounds;
+  if (not get_bounds(env, bounds, count_bounds)) {
+    return nullptr;
+  }
+  auto results = abc_driver->CountVariable(var_name_str, count_bounds);
+  return newBigIntegerArray(env, results);
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countInts
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countInts___3J
+  (JNIEnv *env, jobject obj, jlongArray bounds) {
+
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  std::vector<unsigned long> count_bounds;
+  if (not get_bounds(env, bounds, count_bounds)) {
+    return nullptr;
+  }
+  auto results = abc_driver->CountInts(count_bounds);
+  return newBigIntegerArray(env, results);
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countStrs
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countStrs___3J
+  (JNIEnv *env, jobject obj, jlongArray bounds) {
+
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  std::vector<unsigned long> count_bounds;
+  if (not get_bounds(env, bounds, count_bounds)) {
+    return nullptr;
+  }
+  auto results = abc_driver->CountStrs(count_bounds);
+  return newBigIntegerArray(env, results);
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countAll
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countAll
+  (JNIEnv *env, jobject obj, jlongArray bounds) {
+
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  std::vector<unsigned long> count_bounds;
+  if (not get_bounds(env, bounds, count_bounds)) {
+    return nullptr;
+  }
+  auto results = abc_driver->CountAll(count_bounds);
+  return newBigIntegerArray(env, results);
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countRange
+ * Signature: (JJJ)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countRange
+  (JNIEnv *env, jobject obj, jlong lower_bound, jlong upper_bound, jlong step) {
+
+  if (lower_bound < 0 or upper_bound < 0) {
+    throwIllegalArgumentException(env, "count range bounds must not be negative");
+    return nullptr;
+  }
+  if (step <= 0) {
+    throwIllegalArgumentException(env, "count range step must be positive");
+    return nullptr;
+  }
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  auto results = abc_driver->CountRange(lower_bound, upper_bound, step);
+  return newBigIntegerArray(env, results);
+}
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    getModelCounterForVariable
@@ -416,6 +612,92 @@ JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getSatisfyingExample
   return map;
 }
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    getSatisfyingExamplesUniform
+ * Signature: (IIJ)Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getSatisfyingExamplesUniform (JNIEnv *env, jobject obj, jint numOfExamples, jint bound, jlong seed) {
+  if (numOfExamples < 0 or bound < 0) {
+    throwIllegalArgumentException(env, "number of examples and bound cannot be negative");
+    return nullptr;
+  }
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  jclass hashMapClass = env->FindClass("java/util/HashMap");
+  jmethodID hashMapCtor = env->GetMethodID(hashMapClass, "<init>", "()V");
+  jobject map = env->NewObject(hashMapClass, hashMapCtor);
+  jclass arrayListClass = env->FindClass("java/util/ArrayList");
+  jmethodID arrayListCtor = env->GetMethodID(arrayListClass, "<init>", "(I)V");
+  jmethodID arrayListAdd = env->GetMethodID(arrayListClass, "add", "(Ljava/lang/Object;)Z");
+
+  std::map<std::string, std::vector<std::string>> results = abc_driver->getSatisfyingExamplesUniform((unsigned)numOfExamples, (int)bound, (unsigned long)seed);
+
+  jmethodID hasMapPut = env->GetMethodID(hashMapClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+  for (auto& var_entry : results) {
+    jstring var_name = env->NewStringUTF(var_entry.first.c_str());
+    jobject var_values = env->NewObject(arrayListClass, arrayListCtor, (jint)var_entry.second.size());
+    // sampled strings may have any byte including 0, they are not valid modified utf-8
+    for (auto& value : var_entry.second) {
+      jbyteArray var_value = env->NewByteArray(value.size());
+      env->SetByteArrayRegion(var_value, 0, value.size(), reinterpret_cast<const jbyte*>(value.data()));
+      env->CallBooleanMethod(var_values, arrayListAdd, var_value);
+      env->DeleteLocalRef(var_value);
+    }
+    env->CallObjectMethod(map, hasMapPut, var_name, var_values);
+    env->DeleteLocalRef(var_name);
+    env->DeleteLocalRef(var_values);
+  }
+
+  return map;
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    initializeModelIterator
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_initializeModelIterator (JNIEnv *env, jobject obj, jlong bound) {
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  abc_driver->InitializeModelIterator((unsigned long)bound);
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    hasNextModel
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_hasNextModel (JNIEnv *env, jobject obj) {
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  return (jboolean)abc_driver->HasNextModel();
+}
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    getNextModel
+ * Signature: ()Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getNextModel (JNIEnv *env, jobject obj) {
+  Vlab::Driver *abc_driver = getHandle<Vlab::Driver>(env, obj);
+  jclass hashMapClass = env->FindClass("java/util/HashMap");
+  jmethodID hashMapCtor = env->GetMethodID(hashMapClass, "<init>", "()V");
+  jobject map = env->NewObject(hashMapClass, hashMapCtor);
+
+  std::map<std::string, std::string> model = abc_driver->GetNextModel();
+
+  jmethodID hasMapPut = env->GetMethodID(hashMapClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+
+  for (auto& var_entry : model) {
+    jstring var_name = env->NewStringUTF(var_entry.first.c_str());
+    jstring var_value = env->NewStringUTF(var_entry.second.c_str());
+    env->CallObjectMethod(map, hasMapPut, var_name, var_value);
+    env->DeleteLocalRef(var_name);
+    env->DeleteLocalRef(var_value);
+  }
+
+  return map;
+}
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    reset
@@ -47,6 +47,30 @@ JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_setOption__ILjava_lang_
 JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_isSatisfiable
   (JNIEnv *, jobject, jstring);
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    assertIncremental
+ * Signature: (Ljava/lang/String;)Z
+ */
+JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_assertIncremental
+  (JNIEnv *, jobject, jstring);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    push
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_push
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    pop
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_pop
+  (JNIEnv *, jobject, jint);
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    countVariable
@@ -79,6 +103,46 @@ JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countStrs__J
 JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_count__JJ
   (JNIEnv *, jobject, jlong, jlong);
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countVariable
+ * Signature: (Ljava/lang/String;[J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countVariable__Ljava_lang_String_2_3J
+  (JNIEnv *, jobject, jstring, jlongArray);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countInts
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countInts___3J
+  (JNIEnv *, jobject, jlongArray);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countStrs
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countStrs___3J
+  (JNIEnv *, jobject, jlongArray);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countAll
+ * Signature: ([J)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countAll
+  (JNIEnv *, jobject, jlongArray);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    countRange
+ * Signature: (JJJ)[Ljava/math/BigInteger;
+ */
+JNIEXPORT jobjectArray JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_countRange
+  (JNIEnv *, jobject, jlong, jlong, jlong);
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    getModelCounterForVariable
@@ -167,6 +231,38 @@ JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getSatisfyingExample
 JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getSatisfyingExamplesRandomBounded
   (JNIEnv *, jobject, jint);
 
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    getSatisfyingExamplesUniform
+ * Signature: (IIJ)Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getSatisfyingExamplesUniform
+  (JNIEnv *, jobject, jint, jint, jlong);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    initializeModelIterator
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_initializeModelIterator
+  (JNIEnv *, jobject, jlong);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    hasNextModel
+ * Signature: ()Z
+ */
+JNIEXPORT jboolean JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_hasNextModel
+  (JNIEnv *, jobject);
+
+/*
+ * Class:     vlab_cs_ucsb_edu_DriverProxy
+ * Method:    getNextModel
+ * Signature: ()Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_vlab_cs_ucsb_edu_DriverProxy_getNextModel
+  (JNIEnv *, jobject);
+
 /*
  * Class:     vlab_cs_ucsb_edu_DriverProxy
  * Method:    reset
@@ -0,0 +1,76 @@
+/*
+ * DriverTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "DriverTest.h"
+
+#include <sstream>
+
+namespace Vlab {
+namespace Test {
+
+using namespace ::testing;
+
+void DriverTest::SetUp() {
+  force_dnf_formula_ = Option::Solver::FORCE_DNF_FORMULA;
+  satisfiability_only_ = Option::Solver::SATISFIABILITY_ONLY;
+  Option::Solver::FORCE_DNF_FORMULA = true;
+}
+
+void DriverTest::TearDown() {
+  Option::Solver::FORCE_DNF_FORMULA = force_dnf_formula_;
+  Option::Solver::SATISFIABILITY_ONLY = satisfiability_only_;
+  driver_.reset();
+}
+
+bool DriverTest::Solve(const std::string& script) {
+  driver_.reset();
+  std::istringstream in(script);
+  driver_.Parse(&in);
+  driver_.InitializeSolver();
+  driver_.Solve();
+  return driver_.is_sat();
+}
+
+TEST_F(DriverTest, LazyDnfFindsSatisfiableConjunction) {
+  const std::string script = "(declare-fun s () String)\n"
+      "(assert (or (= s \"a\") (= s \"bb\")))\n"
+      "(assert (or (= s \"c\") (= s \"bb\")))\n"
+      "(check-sat)\n";
+  Option::Solver::SATISFIABILITY_ONLY = true;
+  EXPECT_TRUE(Solve(script));
+  Option::Solver::SATISFIABILITY_ONLY = false;
+  EXPECT_TRUE(Solve(script));
+}
+
+/**
+ * The values of x and y intersect in every conjunction, only solving the conjunctions together refutes them
+ */
+TEST_F(DriverTest, LazyDnfSolvesRelationalConjunctions) {
+  const std::string script = "(declare-fun x () Int)\n(declare-fun y () Int)\n"
+      "(assert (or (< x y) (> x y)))\n"
+      "(assert (or (= x y) (= (+ x 1) (+ y 1))))\n"
+      "(check-sat)\n";
+  Option::Solver::SATISFIABILITY_ONLY = true;
+  EXPECT_FALSE(Solve(script));
+  Option::Solver::SATISFIABILITY_ONLY = false;
+  EXPECT_FALSE(Solve(script));
+}
+
+/**
+ * Conjunctions overlap on "bb", the union counts it once
+ */
+TEST_F(DriverTest, LazyDnfCountsUnionOfConjunctions) {
+  Option::Solver::SATISFIABILITY_ONLY = false;
+  ASSERT_TRUE(Solve("(declare-fun s () String)\n"
+      "(assert (or (= s \"a\") (= s \"bb\") (= s \"ccc\")))\n"
+      "(assert (or (= (str.len s) 1) (= s \"bb\") (= (str.len s) 2)))\n"
+      "(check-sat)\n"));
+  EXPECT_EQ(Theory::BigInteger(2), driver_.CountVariable("s", 3));
+}
+
+} /* namespace Test */
+} /* namespace Vlab */
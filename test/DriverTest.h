@@ -0,0 +1,39 @@
+/*
+ * DriverTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef DRIVERTEST_H_
+#define DRIVERTEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "Driver.h"
+#include "solver/options/Solver.h"
+
+namespace Vlab {
+namespace Test {
+
+class DriverTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * @return satisfiability of the script
+   */
+  bool Solve(const std::string& script);
+
+  Driver driver_;
+  bool force_dnf_formula_;
+  bool satisfiability_only_;
+};
+
+} /* namespace Test */
+} /* namespace Vlab */
+
+#endif /* DRIVERTEST_H_ */
@@ -0,0 +1,157 @@
+/*
+ * ServerTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ServerTest.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+namespace Vlab {
+namespace Test {
+
+using namespace ::testing;
+
+static const std::string SAT_SCRIPT = "(declare-fun x () String)\n(assert (in x /a|b/))\n(check-sat)\n";
+static const std::string UNSAT_SCRIPT = "(declare-fun x () String)\n(assert (= x \"a\"))\n(assert (= x \"b\"))\n(check-sat)\n";
+
+void ServerTest::SetUp() {
+}
+
+void ServerTest::TearDown() {
+}
+
+std::string ServerTest::MakeRequest(const std::string& script, const std::string& options) {
+  std::stringstream ss;
+  ss << script.size();
+  if (not options.empty()) {
+    ss << " " << options;
+  }
+  ss << "\n" << script;
+  return ss.str();
+}
+
+std::vector<std::string> ServerTest::Serve(const std::string& input) {
+  int input_fds[2], output_fds[2];
+  EXPECT_EQ(0, pipe(input_fds));
+  EXPECT_EQ(0, pipe(output_fds));
+
+  std::thread writer([&input, &input_fds]() {
+    std::size_t written = 0;
+    while (written < input.size()) {
+      const ssize_t size = write(input_fds[1], input.data() + written, input.size() - written);
+      if (size <= 0) {
+        break;
+      }
+      written += size;
+    }
+    close(input_fds[1]);
+  });
+  std::string output;
+  std::thread reader([&output, &output_fds]() {
+    char chunk[4096];
+    ssize_t size = 0;
+    while ((size = read(output_fds[0], chunk, sizeof(chunk))) > 0) {
+      output.append(chunk, size);
+    }
+  });
+
+  {
+    Server server(2, Theory::SymbolicCounter::Method::ITERATIVE);
+    server.Serve(input_fds[0], output_fds[1]);
+  }
+  close(output_fds[1]);
+  writer.join();
+  reader.join();
+  close(input_fds[0]);
+  close(output_fds[0]);
+
+  std::vector<std::string> bodies;
+  std::size_t position = 0;
+  while (position < output.size()) {
+    const std::size_t end = output.find('\n', position);
+    EXPECT_NE(std::string::npos, end) << "response header is not terminated";
+    if (end == std::string::npos) {
+      break;
+    }
+    const std::size_t length = std::stoul(output.substr(position, end - position));
+    EXPECT_LE(end + 1 + length, output.size()) << "response body is cut";
+    bodies.push_back(output.substr(end + 1, length));
+    position = end + 1 + length;
+  }
+  return bodies;
+}
+
+TEST_F(ServerTest, RequestsAreAnsweredInOrder) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT) + MakeRequest(UNSAT_SCRIPT) + MakeRequest(SAT_SCRIPT));
+  EXPECT_THAT(bodies, ElementsAre("sat\n", "unsat\n", "sat\n"));
+}
+
+TEST_F(ServerTest, BlankLinesBetweenRequestsAreSkipped) {
+  auto bodies = Serve("\n" + MakeRequest(SAT_SCRIPT) + "\r\n\n" + MakeRequest(UNSAT_SCRIPT));
+  EXPECT_THAT(bodies, ElementsAre("sat\n", "unsat\n"));
+}
+
+TEST_F(ServerTest, CountsAreAnsweredForEachBound) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT, "--bound-str 1,2"));
+  EXPECT_THAT(bodies, ElementsAre("sat\ncount str 1 2\ncount str 2 2\n"));
+}
+
+TEST_F(ServerTest, VariableIsCountedOnceForEachBound) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT, "--bound-var 1,2 --count-variable x"));
+  EXPECT_THAT(bodies, ElementsAre("sat\ncount var 1 2\ncount var 2 2\n"));
+}
+
+TEST_F(ServerTest, NegativeAndLargeValuesAreRejected) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT, "--bound-str 1,-1") + MakeRequest(SAT_SCRIPT, "--get-models -1")
+                      + MakeRequest(SAT_SCRIPT, "--bound-int 100000000"));
+  EXPECT_THAT(bodies, ElementsAre("error invalid value of --bound-str: 1,-1\n",
+                                  "error invalid value of --get-models: -1\n",
+                                  "error invalid value of --bound-int: 100000000\n"));
+}
+
+TEST_F(ServerTest, ModelsAreAnsweredInLengthOrder) {
+  const std::string script = "(declare-fun x () String)\n(assert (in x /ab|c/))\n(check-sat)\n";
+  auto bodies = Serve(MakeRequest(script, "--get-models 5"));
+  EXPECT_THAT(bodies, ElementsAre("sat\nmodel x = \"c\"\nmodel x = \"ab\"\n"));
+}
+
+TEST_F(ServerTest, HeaderErrorsAreAnsweredAndScriptsSkipped) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT, "--unknown 1") + MakeRequest(UNSAT_SCRIPT, "--get-models many")
+                      + MakeRequest(SAT_SCRIPT, "--bound-str") + MakeRequest(UNSAT_SCRIPT));
+  EXPECT_THAT(bodies, ElementsAre("error unknown option --unknown\n", "error invalid value of --get-models: many\n",
+                                  "error missing value of --bound-str\n", "unsat\n"));
+}
+
+TEST_F(ServerTest, ScriptErrorsAreAnswered) {
+  const std::string syntax_error_script = "(declare-fun x () String)\n(assert (= x \"a\")\n";
+  const std::string invalid_character_script = "(declare-fun x () String)\n(assert (= x `a))\n(check-sat)\n";
+  auto bodies = Serve(MakeRequest(syntax_error_script) + MakeRequest(invalid_character_script)
+                      + MakeRequest(SAT_SCRIPT));
+  ASSERT_EQ(3, bodies.size());
+  EXPECT_THAT(bodies[0], StartsWith("error "));
+  EXPECT_THAT(bodies[1], StartsWith("error "));
+  EXPECT_EQ("sat\n", bodies[2]);
+  for (auto& body : bodies) {
+    EXPECT_EQ(1, std::count(body.begin(), body.end(), '\n'));
+  }
+}
+
+TEST_F(ServerTest, MalformedHeaderEndsTheStream) {
+  auto bodies = Serve(MakeRequest(SAT_SCRIPT) + "size\n" + MakeRequest(SAT_SCRIPT));
+  EXPECT_THAT(bodies, ElementsAre("sat\n"));
+}
+
+TEST_F(ServerTest, ScriptCutByTheEndOfInputIsNotAnswered) {
+  auto bodies = Serve(MakeRequest(UNSAT_SCRIPT) + "100\n(declare-fun x () String)\n");
+  EXPECT_THAT(bodies, ElementsAre("unsat\n"));
+}
+
+} /* namespace Test */
+} /* namespace Vlab */
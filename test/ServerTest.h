@@ -0,0 +1,40 @@
+/*
+ * ServerTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SERVERTEST_H_
+#define SERVERTEST_H_
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "Server.h"
+
+namespace Vlab {
+namespace Test {
+
+class ServerTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * @return a request frame with the script and the header options
+   */
+  static std::string MakeRequest(const std::string& script, const std::string& options = "");
+  /**
+   * Serves the input until its end
+   * @return bodies of the response frames in order, a malformed frame fails the test
+   */
+  std::vector<std::string> Serve(const std::string& input);
+};
+
+} /* namespace Test */
+} /* namespace Vlab */
+
+#endif /* SERVERTEST_H_ */
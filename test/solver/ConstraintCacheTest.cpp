@@ -0,0 +1,117 @@
+/*
+ * ConstraintCacheTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ConstraintCacheTest.h"
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+
+void ConstraintCacheTest::SetUp() {
+  char file_path[] = "/tmp/abc_constraint_cache_XXXXXX";
+  int file_descriptor = mkstemp(file_path);
+  ASSERT_GE(file_descriptor, 0);
+  close(file_descriptor);
+  file_path_ = file_path;
+}
+
+void ConstraintCacheTest::TearDown() {
+  unlink(file_path_.c_str());
+}
+
+TEST_F(ConstraintCacheTest, StoreAndFind) {
+  ConstraintCache cache(file_path_);
+  ConstraintCache::Entry entry;
+  EXPECT_FALSE(cache.Find("key", "(assert v0)", entry));
+
+  ConstraintCache::Entry stored;
+  stored.is_sat = true;
+  stored.has_model_counter = true;
+  stored.model_counter = std::string("model\0counter", 13);
+  cache.Store("key", "(assert v0)", stored);
+
+  ASSERT_TRUE(cache.Find("key", "(assert v0)", entry));
+  EXPECT_TRUE(entry.is_sat);
+  EXPECT_TRUE(entry.has_model_counter);
+  EXPECT_EQ(stored.model_counter, entry.model_counter);
+}
+
+TEST_F(ConstraintCacheTest, FindRejectsOtherCanonicalForm) {
+  ConstraintCache cache(file_path_);
+  ConstraintCache::Entry stored;
+  stored.is_sat = true;
+  cache.Store("key", "(assert v0)", stored);
+
+  ConstraintCache::Entry entry;
+  EXPECT_FALSE(cache.Find("key", "(assert v0)(declare _:1)", entry));
+  EXPECT_FALSE(cache.Find("key", "(assert v1)", entry));
+}
+
+TEST_F(ConstraintCacheTest, LaterRecordOverrides) {
+  ConstraintCache cache(file_path_);
+  ConstraintCache::Entry stored;
+  stored.is_sat = true;
+  cache.Store("key", "(assert v0)", stored);
+  stored.is_sat = false;
+  cache.Store("key", "(assert v0)", stored);
+
+  ConstraintCache::Entry entry;
+  ASSERT_TRUE(cache.Find("key", "(assert v0)", entry));
+  EXPECT_FALSE(entry.is_sat);
+}
+
+TEST_F(ConstraintCacheTest, SharedFile) {
+  ConstraintCache writer(file_path_);
+  ConstraintCache reader(file_path_);
+  ConstraintCache::Entry stored;
+  stored.is_sat = true;
+  writer.Store("key", "(assert v0)", stored);
+
+  ConstraintCache::Entry entry;
+  ASSERT_TRUE(reader.Find("key", "(assert v0)", entry));
+  EXPECT_TRUE(entry.is_sat);
+}
+
+TEST_F(ConstraintCacheTest, IgnoresIncompatibleFile) {
+  {
+    // record of an earlier layout: magic, key length, key, is sat, has model counter, model counter length
+    std::ofstream out(file_path_, std::ios::binary);
+    const uint32_t magic = 0xABCCAC4E;
+    const uint32_t key_size = 3;
+    const uint64_t model_counter_size = 0;
+    out.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+    out.write(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    out.write("key", key_size);
+    out.put(1);
+    out.put(0);
+    out.write(reinterpret_cast<const char*>(&model_counter_size), sizeof(model_counter_size));
+  }
+  std::ifstream in(file_path_, std::ios::binary | std::ios::ate);
+  const auto file_size = in.tellg();
+
+  ConstraintCache cache(file_path_);
+  ConstraintCache::Entry entry;
+  EXPECT_FALSE(cache.Find("key", "", entry));
+
+  ConstraintCache::Entry stored;
+  stored.is_sat = true;
+  cache.Store("key", "(assert v0)", stored);
+  EXPECT_FALSE(cache.Find("key", "(assert v0)", entry));
+  in.seekg(0, std::ios::end);
+  EXPECT_EQ(file_size, in.tellg());
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
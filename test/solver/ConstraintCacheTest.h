@@ -0,0 +1,33 @@
+/*
+ * ConstraintCacheTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_CONSTRAINTCACHETEST_H_
+#define SOLVER_CONSTRAINTCACHETEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "solver/ConstraintCache.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+class ConstraintCacheTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  std::string file_path_;
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_CONSTRAINTCACHETEST_H_ */
@@ -0,0 +1,153 @@
+/*
+ * IncrementalContextTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "IncrementalContextTest.h"
+
+#include <stdexcept>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+
+FakeComponentState::FakeComponentState(const std::string& script, bool is_refinable)
+    : is_sat_ {script.find("false") == std::string::npos},
+      is_refinable_ {is_refinable} {
+}
+
+bool FakeComponentState::is_sat() {
+  return is_sat_;
+}
+
+bool FakeComponentState::Refine(const std::string& variable_name, const std::string& script) {
+  if (not is_refinable_) {
+    return false;
+  }
+  refined_scripts_.push_back(script);
+  is_sat_ = is_sat_ and script.find("false") == std::string::npos;
+  return true;
+}
+
+void IncrementalContextTest::SetUp() {
+  is_refinable_ = true;
+  solve_ = [this](const std::string& script) {
+    if (script.find("throw") != std::string::npos) {
+      throw std::runtime_error("cannot solve");
+    }
+    solved_scripts_.push_back(script);
+    auto state = std::make_shared<FakeComponentState>(script, is_refinable_);
+    states_.push_back(state.get());
+    return state;
+  };
+}
+
+void IncrementalContextTest::TearDown() {
+}
+
+bool IncrementalContextTest::Assert(const std::string& constraint) {
+  return context_.Assert(constraint, solve_);
+}
+
+TEST_F(IncrementalContextTest, SplitCommands) {
+  auto commands = IncrementalContext::SplitCommands("(assert (= x \")(\")) ; (pop)\n(check-sat)");
+  ASSERT_THAT(commands, SizeIs(2));
+  EXPECT_EQ("(assert (= x \")(\"))", commands[0]);
+  EXPECT_EQ("(check-sat)", commands[1]);
+}
+
+TEST_F(IncrementalContextTest, GetSymbols) {
+  EXPECT_THAT(IncrementalContext::GetSymbols("(assert (str.in.re |a b| /x+/))"),
+              ElementsAre("assert", "str.in.re", "a b"));
+}
+
+TEST_F(IncrementalContextTest, UnrelatedAssertionsAreSolvedSeparately) {
+  EXPECT_TRUE(Assert("(declare-fun x () String)(declare-fun y () String)(assert (p x))(assert (p y))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(2));
+  EXPECT_THAT(solved_scripts_[1], HasSubstr("(assert (p y))"));
+  EXPECT_THAT(solved_scripts_[1], Not(HasSubstr("x")));
+}
+
+TEST_F(IncrementalContextTest, SingleVariableAssertionRefinesSolvedComponent) {
+  EXPECT_TRUE(Assert("(declare-fun x () String)(assert (p x))(assert (q x))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(1));
+  ASSERT_THAT(states_[0]->refined_scripts_, SizeIs(1));
+  EXPECT_THAT(states_[0]->refined_scripts_[0], HasSubstr("(assert (q x))"));
+  EXPECT_THAT(states_[0]->refined_scripts_[0], Not(HasSubstr("(assert (p x))")));
+
+  EXPECT_FALSE(Assert("(assert (false x))"));
+  EXPECT_THAT(solved_scripts_, SizeIs(1));
+  EXPECT_THAT(context_.GetScript(), HasSubstr("(assert (q x))"));
+}
+
+TEST_F(IncrementalContextTest, RefusedRefinementSolvesComponent) {
+  is_refinable_ = false;
+  EXPECT_TRUE(Assert("(declare-fun x () String)(assert (p x))(assert (q x))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(2));
+  EXPECT_THAT(solved_scripts_[1], HasSubstr("(assert (p x))"));
+  EXPECT_THAT(solved_scripts_[1], HasSubstr("(assert (q x))"));
+}
+
+TEST_F(IncrementalContextTest, RelationSolvesMergedComponent) {
+  EXPECT_TRUE(Assert("(declare-fun x () String)(declare-fun y () String)(assert (p x))(assert (p y))"));
+  EXPECT_TRUE(Assert("(assert (r x y))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(3));
+  EXPECT_THAT(solved_scripts_[2], HasSubstr("(assert (p x))"));
+  EXPECT_THAT(solved_scripts_[2], HasSubstr("(assert (p y))"));
+  EXPECT_THAT(solved_scripts_[2], HasSubstr("(assert (r x y))"));
+}
+
+TEST_F(IncrementalContextTest, StateOfLowerLevelIsNotRefined) {
+  EXPECT_TRUE(Assert("(declare-fun x () String)(assert (p x))(push 1)"));
+  EXPECT_FALSE(Assert("(assert (false x))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(2));
+  EXPECT_THAT(states_[0]->refined_scripts_, IsEmpty());
+
+  EXPECT_TRUE(context_.Pop());
+  EXPECT_TRUE(context_.is_sat());
+  EXPECT_TRUE(Assert("(assert (q x))"));
+  EXPECT_THAT(states_[0]->refined_scripts_, SizeIs(1));
+}
+
+TEST_F(IncrementalContextTest, PopTooManyLevels) {
+  context_.Push(2);
+  EXPECT_FALSE(context_.Pop(3));
+  EXPECT_EQ(2, context_.num_of_levels());
+  EXPECT_TRUE(context_.Pop(2));
+  EXPECT_EQ(0, context_.num_of_levels());
+  EXPECT_FALSE(context_.Pop());
+}
+
+TEST_F(IncrementalContextTest, MalformedCommandsAreReported) {
+  Assert("(pop 1)");
+  EXPECT_THAT(context_.get_error(), HasSubstr("cannot pop"));
+  Assert("(push -1)(push x)(push 99999999999)");
+  EXPECT_THAT(context_.get_error(), HasSubstr("invalid level count"));
+  EXPECT_EQ(0, context_.num_of_levels());
+  Assert("(declare-fun x () String)(push)");
+  EXPECT_TRUE(context_.get_error().empty());
+  EXPECT_EQ(1, context_.num_of_levels());
+}
+
+TEST_F(IncrementalContextTest, FailedSolveKeepsContext) {
+  EXPECT_TRUE(Assert("(declare-fun x () String)(declare-fun y () String)(assert (p x))(assert (p y))"));
+  const std::string script = context_.GetScript();
+  EXPECT_THROW(Assert("(assert (throw x y))"), std::runtime_error);
+  EXPECT_EQ(script, context_.GetScript());
+  EXPECT_TRUE(context_.is_sat());
+
+  // solved states are kept, not solved again
+  EXPECT_TRUE(Assert("(assert (q x))(assert (q y))"));
+  ASSERT_THAT(solved_scripts_, SizeIs(2));
+  EXPECT_THAT(states_[0]->refined_scripts_, SizeIs(1));
+  EXPECT_THAT(states_[1]->refined_scripts_, SizeIs(1));
+  EXPECT_FALSE(Assert("(assert (false x))"));
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
@@ -0,0 +1,56 @@
+/*
+ * IncrementalContextTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_INCREMENTALCONTEXTTEST_H_
+#define SOLVER_INCREMENTALCONTEXTTEST_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "solver/IncrementalContext.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+/**
+ * Component state that records the scripts it is given, a script with "false" is unsatisfiable
+ */
+class FakeComponentState : public IncrementalContext::ComponentState {
+ public:
+  FakeComponentState(const std::string& script, bool is_refinable);
+  bool is_sat() override;
+  bool Refine(const std::string& variable_name, const std::string& script) override;
+
+  bool is_sat_;
+  bool is_refinable_;
+  std::vector<std::string> refined_scripts_;
+};
+
+class IncrementalContextTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  bool Assert(const std::string& constraint);
+
+  IncrementalContext context_;
+  IncrementalContext::SolveFunction solve_;
+  bool is_refinable_;
+  std::vector<std::string> solved_scripts_;
+  // states are owned by the context, a shared copy would keep them from being refined
+  std::vector<FakeComponentState*> states_;
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_INCREMENTALCONTEXTTEST_H_ */
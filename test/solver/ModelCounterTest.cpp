@@ -0,0 +1,111 @@
+/*
+ * ModelCounterTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ModelCounterTest.h"
+
+#include <sstream>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+
+void ModelCounterTest::SetUpTestCase() {
+  // has no effect if another test started the pool first
+  Util::ThreadPool::Configure(4);
+}
+
+void ModelCounterTest::SetUp() {
+}
+
+void ModelCounterTest::TearDown() {
+}
+
+Theory::SymbolicCounter ModelCounterTest::MakeCounter(const int width, const Theory::SymbolicCounter::Type type) {
+  std::vector<Eigen::Triplet<Theory::BigInteger>> entries;
+  entries.push_back(Eigen::Triplet<Theory::BigInteger>(0, 0, width));
+  entries.push_back(Eigen::Triplet<Theory::BigInteger>(0, 1, 1));
+  entries.push_back(Eigen::Triplet<Theory::BigInteger>(1, 1, 1));
+  Eigen::SparseMatrix<Theory::BigInteger> count_matrix(2, 2);
+  count_matrix.setFromTriplets(entries.begin(), entries.end());
+  count_matrix.makeCompressed();
+
+  Theory::SymbolicCounter counter;
+  counter.set_type(type);
+  counter.set_transition_count_matrix(count_matrix);
+  counter.set_initialization_vector(count_matrix.innerVector(count_matrix.cols() - 1));
+  return counter;
+}
+
+std::vector<Theory::BigInteger> ModelCounterTest::CountSequentially(std::vector<Theory::SymbolicCounter> counters,
+                                                                    const std::vector<unsigned long>& bounds,
+                                                                    const Theory::SymbolicCounter::Method method) {
+  std::vector<Theory::BigInteger> results(bounds.size(), 1);
+  for (auto& counter : counters) {
+    auto counts = counter.CountAll(bounds, method);
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+      results[i] *= counts[i];
+    }
+  }
+  return results;
+}
+
+TEST_F(ModelCounterTest, ParallelCountsMatchSequentialCounts) {
+  std::vector<Theory::SymbolicCounter> str_counters;
+  std::vector<Theory::SymbolicCounter> int_counters;
+  ModelCounter model_counter;
+  for (int width = 1; width <= 9; ++width) {
+    str_counters.push_back(MakeCounter(width, Theory::SymbolicCounter::Type::STRING));
+    int_counters.push_back(MakeCounter(width, Theory::SymbolicCounter::Type::BINARYINT));
+    model_counter.add_symbolic_counter(str_counters.back());
+    model_counter.add_symbolic_counter(int_counters.back());
+  }
+  EXPECT_LT(1, Util::ThreadPool::GetInstance().get_num_of_threads());
+
+  const std::vector<unsigned long> bounds {0, 1, 3, 17, 64, 5};
+  for (auto method : {Theory::SymbolicCounter::Method::ITERATIVE, Theory::SymbolicCounter::Method::FIXED_WIDTH,
+                      Theory::SymbolicCounter::Method::MODULAR}) {
+    ModelCounter str_counter = model_counter;
+    EXPECT_EQ(CountSequentially(str_counters, bounds, method), str_counter.CountStrs(bounds, method))
+        << "method " << static_cast<int>(method);
+    ModelCounter int_counter = model_counter;
+    EXPECT_EQ(CountSequentially(int_counters, bounds, method), int_counter.CountInts(bounds, method))
+        << "method " << static_cast<int>(method);
+  }
+}
+
+TEST_F(ModelCounterTest, ParallelCountsIncludeUnconstraintVariables) {
+  ModelCounter model_counter;
+  model_counter.add_symbolic_counter(MakeCounter(2, Theory::SymbolicCounter::Type::STRING));
+  model_counter.set_num_of_unconstraint_str_vars(2);
+  // 2^(n+1) - 1 words up to length n times (256^(n+1) - 1) / 255 words for each unconstraint string
+  std::vector<Theory::BigInteger> expected_counts {1, Theory::BigInteger(3) * 257 * 257,
+                                                   Theory::BigInteger(7) * 65793 * 65793};
+  EXPECT_EQ(expected_counts, model_counter.CountStrs(std::vector<unsigned long> {0, 1, 2}));
+}
+
+TEST_F(ModelCounterTest, SerializationKeepsExactCounting) {
+  ModelCounter model_counter;
+  model_counter.set_count_bound_exact(true);
+  model_counter.set_num_of_unconstraint_str_vars(1);
+  std::stringstream ss;
+  {
+    cereal::BinaryOutputArchive ar(ss);
+    model_counter.save(ar);
+  }
+  ModelCounter loaded_counter;
+  {
+    cereal::BinaryInputArchive ar(ss);
+    loaded_counter.load(ar);
+  }
+  EXPECT_EQ(Theory::BigInteger(65536), loaded_counter.CountStrs(2));
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
@@ -0,0 +1,44 @@
+/*
+ * ModelCounterTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_MODELCOUNTERTEST_H_
+#define SOLVER_MODELCOUNTERTEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "solver/ModelCounter.h"
+#include "theory/SymbolicCounter.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+class ModelCounterTest : public ::testing::Test {
+protected:
+  static void SetUpTestCase();
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * Counter of a single state automaton with 'width' self loops, every state is accepting
+   */
+  static Theory::SymbolicCounter MakeCounter(const int width, const Theory::SymbolicCounter::Type type);
+  /**
+   * Counts each counter on its own and multiplies the counts on the calling thread, as a single thread pool does
+   */
+  static std::vector<Theory::BigInteger> CountSequentially(std::vector<Theory::SymbolicCounter> counters,
+                                                           const std::vector<unsigned long>& bounds,
+                                                           const Theory::SymbolicCounter::Method method);
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_MODELCOUNTERTEST_H_ */
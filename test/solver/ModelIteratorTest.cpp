@@ -0,0 +1,97 @@
+/*
+ * ModelIteratorTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ModelIteratorTest.h"
+
+#include <set>
+#include <sstream>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+
+void ModelIteratorTest::SetUp() {
+}
+
+void ModelIteratorTest::TearDown() {
+  driver_.reset();
+}
+
+void ModelIteratorTest::Solve(const std::string& script) {
+  driver_.reset();
+  std::istringstream in(script);
+  driver_.Parse(&in);
+  driver_.InitializeSolver();
+  driver_.Solve();
+  ASSERT_TRUE(driver_.is_sat());
+}
+
+std::vector<std::string> ModelIteratorTest::GetValues(const std::vector<ModelIterator::Model>& models,
+                                                      const std::string& variable_name) {
+  std::vector<std::string> values;
+  for (auto& model : models) {
+    auto it = model.find(variable_name);
+    EXPECT_NE(model.end(), it) << "model has no value for " << variable_name;
+    if (it != model.end()) {
+      values.push_back(it->second);
+    }
+  }
+  return values;
+}
+
+TEST_F(ModelIteratorTest, StringModelsAreInLengthOrder) {
+  Solve("(declare-fun x () String)\n(assert (in x /ab|c|de/))\n(check-sat)\n");
+  auto values = GetValues(driver_.GetModels(10), "x");
+  ASSERT_EQ(3, values.size());
+  EXPECT_EQ("c", values[0]);
+  EXPECT_THAT(std::vector<std::string>(values.begin() + 1, values.end()), UnorderedElementsAre("ab", "de"));
+}
+
+TEST_F(ModelIteratorTest, BoundLimitsTheLengthOfModels) {
+  Solve("(declare-fun x () String)\n(assert (in x /a*/))\n(check-sat)\n");
+  EXPECT_THAT(GetValues(driver_.GetModels(3, 10), "x"), ElementsAre("", "a", "aa", "aaa"));
+}
+
+TEST_F(ModelIteratorTest, InfiniteLanguageGivesAsManyModelsAsAsked) {
+  Solve("(declare-fun x () String)\n(assert (in x /a*/))\n(check-sat)\n");
+  EXPECT_THAT(GetValues(driver_.GetModels(5), "x"), ElementsAre("", "a", "aa", "aaa", "aaaa"));
+}
+
+TEST_F(ModelIteratorTest, ModelsOfIndependentVariablesAreCombined) {
+  Solve("(declare-fun x () String)\n(declare-fun y () String)\n(assert (in x /a|b/))\n(assert (in y /c|d|e/))\n"
+        "(check-sat)\n");
+  auto models = driver_.GetModels(100);
+  ASSERT_EQ(6, models.size());
+  std::set<std::pair<std::string, std::string>> pairs;
+  auto x_values = GetValues(models, "x");
+  auto y_values = GetValues(models, "y");
+  for (std::size_t i = 0; i < models.size(); ++i) {
+    pairs.insert(std::make_pair(x_values[i], y_values[i]));
+  }
+  EXPECT_EQ(6, pairs.size());
+}
+
+TEST_F(ModelIteratorTest, IntModelsEndWithoutBound) {
+  Solve("(declare-fun i () Int)\n(assert (>= i 0))\n(assert (< i 3))\n(check-sat)\n");
+  EXPECT_THAT(GetValues(driver_.GetModels(100), "i"), UnorderedElementsAre("0", "1", "2"));
+}
+
+TEST_F(ModelIteratorTest, IteratorIsPulledUntilTheLastModel) {
+  Solve("(declare-fun x () String)\n(assert (in x /ab|c/))\n(check-sat)\n");
+  driver_.InitializeModelIterator();
+  std::vector<ModelIterator::Model> models;
+  while (driver_.HasNextModel()) {
+    models.push_back(driver_.GetNextModel());
+  }
+  EXPECT_THAT(GetValues(models, "x"), ElementsAre("c", "ab"));
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
@@ -0,0 +1,46 @@
+/*
+ * ModelIteratorTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_MODELITERATORTEST_H_
+#define SOLVER_MODELITERATORTEST_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "Driver.h"
+#include "solver/ModelIterator.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+class ModelIteratorTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * Parses, initializes and solves the script with the driver of the test
+   */
+  void Solve(const std::string& script);
+  /**
+   * @return values of the variable in the models in order
+   */
+  static std::vector<std::string> GetValues(const std::vector<ModelIterator::Model>& models,
+                                            const std::string& variable_name);
+
+  Driver driver_;
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_MODELITERATORTEST_H_ */
@@ -0,0 +1,92 @@
+/*
+ * ScriptHasherTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ScriptHasherTest.h"
+
+#include <unistd.h>
+
+#include <cstdlib>
+#include <sstream>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+
+void ScriptHasherTest::SetUp() {
+  char file_path[] = "/tmp/abc_constraint_cache_XXXXXX";
+  int file_descriptor = mkstemp(file_path);
+  ASSERT_GE(file_descriptor, 0);
+  close(file_descriptor);
+  file_path_ = file_path;
+}
+
+void ScriptHasherTest::TearDown() {
+  driver_.set_option(Option::Name::CACHE_PATH, std::string(""));
+  driver_.reset();
+  unlink(file_path_.c_str());
+}
+
+std::string ScriptHasherTest::GetCanonicalForm(const std::string& script) {
+  driver_.reset();
+  std::istringstream in(script);
+  driver_.Parse(&in);
+  driver_.InitializeSolver();
+  ScriptHasher script_hasher(driver_.script_, driver_.symbol_table_);
+  script_hasher.start();
+  return script_hasher.get_canonical_form();
+}
+
+Theory::BigInteger ScriptHasherTest::CountInts(const std::string& script, const unsigned long bound) {
+  driver_.reset();
+  std::istringstream in(script);
+  driver_.Parse(&in);
+  driver_.InitializeSolver();
+  driver_.Solve();
+  return driver_.CountInts(bound);
+}
+
+TEST_F(ScriptHasherTest, RenamedVariablesHaveSameForm) {
+  std::string form_0 = GetCanonicalForm("(declare-fun x () Int)\n(assert (< x 5))\n(check-sat)\n");
+  std::string form_1 = GetCanonicalForm("(declare-fun y () Int)\n(assert (< y 5))\n(check-sat)\n");
+  EXPECT_EQ(form_0, form_1);
+}
+
+TEST_F(ScriptHasherTest, UnusedDeclarationChangesForm) {
+  std::string form_0 = GetCanonicalForm("(declare-fun x () Int)\n(assert (< x 5))\n(check-sat)\n");
+  std::string form_1 = GetCanonicalForm(
+      "(declare-fun x () Int)\n(declare-fun y () Int)\n(assert (< x 5))\n(check-sat)\n");
+  EXPECT_NE(form_0, form_1);
+}
+
+TEST_F(ScriptHasherTest, UnusedDeclarationSortChangesForm) {
+  std::string form_0 = GetCanonicalForm(
+      "(declare-fun x () Int)\n(declare-fun y () Int)\n(assert (< x 5))\n(check-sat)\n");
+  std::string form_1 = GetCanonicalForm(
+      "(declare-fun x () Int)\n(declare-fun y () String)\n(assert (< x 5))\n(check-sat)\n");
+  EXPECT_NE(form_0, form_1);
+}
+
+/**
+ * An unconstrained variable multiplies the count, the cached count of the script without it must not be reused
+ */
+TEST_F(ScriptHasherTest, UnusedDeclarationHasOwnCachedCount) {
+  driver_.set_option(Option::Name::CACHE_PATH, file_path_);
+  auto count_0 = CountInts("(declare-fun x () Int)\n(assert (= x 1))\n(check-sat)\n", 3);
+  auto count_1 = CountInts("(declare-fun x () Int)\n(declare-fun y () Int)\n(assert (= x 1))\n(check-sat)\n", 3);
+  EXPECT_EQ(1, count_0);
+  EXPECT_NE(count_0, count_1);
+
+  driver_.set_option(Option::Name::CACHE_PATH, std::string(""));
+  EXPECT_EQ(count_1,
+            CountInts("(declare-fun x () Int)\n(declare-fun y () Int)\n(assert (= x 1))\n(check-sat)\n", 3));
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
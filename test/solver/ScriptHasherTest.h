@@ -0,0 +1,41 @@
+/*
+ * ScriptHasherTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_SCRIPTHASHERTEST_H_
+#define SOLVER_SCRIPTHASHERTEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "Driver.h"
+#include "solver/ScriptHasher.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+class ScriptHasherTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * @return canonical form of the script after parsing and initialization
+   */
+  std::string GetCanonicalForm(const std::string& script);
+  Theory::BigInteger CountInts(const std::string& script, const unsigned long bound);
+
+  Driver driver_;
+  std::string file_path_;
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_SCRIPTHASHERTEST_H_ */
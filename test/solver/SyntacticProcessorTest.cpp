@@ -0,0 +1,120 @@
+/*
+ * SyntacticProcessorTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "SyntacticProcessorTest.h"
+
+#include <set>
+#include <sstream>
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+using namespace ::testing;
+using SMT::Term;
+
+void SyntacticProcessorTest::SetUp() {
+  force_dnf_formula_ = Option::Solver::FORCE_DNF_FORMULA;
+  Option::Solver::FORCE_DNF_FORMULA = true;
+}
+
+void SyntacticProcessorTest::TearDown() {
+  Option::Solver::FORCE_DNF_FORMULA = force_dnf_formula_;
+  driver_.reset();
+}
+
+void SyntacticProcessorTest::Parse(const std::string& script) {
+  driver_.reset();
+  std::istringstream in(script);
+  driver_.Parse(&in);
+}
+
+void SyntacticProcessorTest::Process() {
+  SyntacticProcessor syntactic_processor(driver_.script_);
+  syntactic_processor.start();
+}
+
+SMT::Term_ptr SyntacticProcessorTest::GetAssertedTerm() {
+  EXPECT_EQ(1, driver_.script_->command_list->size());
+  SMT::Assert_ptr assert_command = dynamic_cast<SMT::Assert_ptr>(driver_.script_->command_list->front());
+  EXPECT_NE(nullptr, assert_command);
+  return assert_command->term;
+}
+
+std::vector<std::vector<Term::Type>> SyntacticProcessorTest::GetConjunctionTypes(SMT::Or_ptr or_term) {
+  std::vector<std::vector<Term::Type>> conjunction_types;
+  for (auto term : *or_term->term_list) {
+    SMT::And_ptr and_term = dynamic_cast<SMT::And_ptr>(term);
+    EXPECT_NE(nullptr, and_term);
+    std::vector<Term::Type> types;
+    if (and_term != nullptr) {
+      for (auto sub_term : *and_term->term_list) {
+        types.push_back(sub_term->type());
+      }
+    }
+    conjunction_types.push_back(types);
+  }
+  return conjunction_types;
+}
+
+/**
+ * A conjunction inside a disjunction is flattened into every conjunction of the product, later ones get clones
+ */
+TEST_F(SyntacticProcessorTest, NestedAndInsideOrIsFlattened) {
+  Parse("(declare-fun x () Int)\n(declare-fun y () Int)\n"
+        "(assert (or (and (< x 1) (> y 2)) (= x 5)))\n"
+        "(assert (or (< y 0) (> y 7)))\n"
+        "(assert (< x 10))\n");
+  Process();
+
+  SMT::Or_ptr or_term = dynamic_cast<SMT::Or_ptr>(GetAssertedTerm());
+  ASSERT_NE(nullptr, or_term);
+  std::vector<std::vector<Term::Type>> expected {
+    {Term::Type::LT, Term::Type::GT, Term::Type::LT, Term::Type::LT},
+    {Term::Type::LT, Term::Type::GT, Term::Type::GT, Term::Type::LT},
+    {Term::Type::EQ, Term::Type::LT, Term::Type::LT},
+    {Term::Type::EQ, Term::Type::GT, Term::Type::LT}
+  };
+  EXPECT_EQ(expected, GetConjunctionTypes(or_term));
+
+  std::set<SMT::Term_ptr> terms;
+  std::size_t number_of_terms = 0;
+  for (auto term : *or_term->term_list) {
+    for (auto sub_term : *dynamic_cast<SMT::And_ptr>(term)->term_list) {
+      terms.insert(sub_term);
+      ++number_of_terms;
+    }
+  }
+  EXPECT_EQ(number_of_terms, terms.size());
+}
+
+/**
+ * A disjunction without terms makes the whole product empty
+ */
+TEST_F(SyntacticProcessorTest, EmptyDisjunctionMakesEmptyProduct) {
+  Parse("(declare-fun x () Int)\n(declare-fun y () Int)\n"
+        "(assert (or (and (< x 1) (> y 2)) (= x 5)))\n"
+        "(assert (or (< y 0)))\n"
+        "(assert (< x 10))\n");
+  SMT::Assert_ptr assert_command = dynamic_cast<SMT::Assert_ptr>(driver_.script_->command_list->at(3));
+  ASSERT_NE(nullptr, assert_command);
+  SMT::Or_ptr empty_or_term = dynamic_cast<SMT::Or_ptr>(assert_command->term);
+  ASSERT_NE(nullptr, empty_or_term);
+  for (auto term : *empty_or_term->term_list) {
+    delete term;
+  }
+  empty_or_term->term_list->clear();
+  Process();
+
+  SMT::Or_ptr or_term = dynamic_cast<SMT::Or_ptr>(GetAssertedTerm());
+  ASSERT_NE(nullptr, or_term);
+  EXPECT_TRUE(or_term->term_list->empty());
+}
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
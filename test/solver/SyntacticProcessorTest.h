@@ -0,0 +1,51 @@
+/*
+ * SyntacticProcessorTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef SOLVER_SYNTACTICPROCESSORTEST_H_
+#define SOLVER_SYNTACTICPROCESSORTEST_H_
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "Driver.h"
+#include "smt/ast.h"
+#include "solver/options/Solver.h"
+#include "solver/SyntacticProcessor.h"
+
+namespace Vlab {
+namespace Solver {
+namespace Test {
+
+class SyntacticProcessorTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  void Parse(const std::string& script);
+  void Process();
+
+  /**
+   * @return term of the single assertion left after processing
+   */
+  SMT::Term_ptr GetAssertedTerm();
+
+  /**
+   * @return types of the terms of each conjunction of the disjunction
+   */
+  std::vector<std::vector<SMT::Term::Type>> GetConjunctionTypes(SMT::Or_ptr or_term);
+
+  Driver driver_;
+  bool force_dnf_formula_;
+};
+
+} /* namespace Test */
+} /* namespace Solver */
+} /* namespace Vlab */
+
+#endif /* SOLVER_SYNTACTICPROCESSORTEST_H_ */
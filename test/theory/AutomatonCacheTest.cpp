@@ -0,0 +1,79 @@
+/*
+ * AutomatonCacheTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "AutomatonCacheTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+void AutomatonCacheTest::SetUp() {
+  memory_budget_ = AutomatonCache::GetInstance().get_memory_budget();
+  AutomatonCache::GetInstance().Clear();
+  AutomatonCache::GetInstance().set_memory_budget(16 * 1024 * 1024);
+}
+
+void AutomatonCacheTest::TearDown() {
+  AutomatonCache::GetInstance().Clear();
+  AutomatonCache::GetInstance().set_memory_budget(memory_budget_);
+}
+
+TEST_F(AutomatonCacheTest, IsEqual) {
+  StringAutomaton_ptr ab_auto = StringAutomaton::MakeRegexAuto("ab*");
+  StringAutomaton_ptr ba_auto = StringAutomaton::MakeRegexAuto("ba*");
+  StringAutomaton_ptr ab_copy_auto = ab_auto->clone();
+  EXPECT_TRUE(AutomatonCache::IsEqual(ab_auto->getDFA(), ab_copy_auto->getDFA()));
+  EXPECT_FALSE(AutomatonCache::IsEqual(ab_auto->getDFA(), ba_auto->getDFA()));
+  delete ab_auto;
+  delete ba_auto;
+  delete ab_copy_auto;
+}
+
+TEST_F(AutomatonCacheTest, HitRequiresEqualOperands) {
+  StringAutomaton_ptr ab_auto = StringAutomaton::MakeRegexAuto("ab*");
+  StringAutomaton_ptr ba_auto = StringAutomaton::MakeRegexAuto("ba*");
+  auto& cache = AutomatonCache::GetInstance();
+  const unsigned long num_of_hits = cache.get_num_of_hits();
+  int num_of_computations = 0;
+  auto compute = [&num_of_computations, ab_auto]() {
+    ++num_of_computations;
+    return dfaCopy(ab_auto->getDFA());
+  };
+
+  dfaFree(cache.Apply("key", {ab_auto->getDFA()}, compute));
+  dfaFree(cache.Apply("key", {ab_auto->getDFA()}, compute));
+  EXPECT_EQ(1, num_of_computations);
+  EXPECT_EQ(num_of_hits + 1, cache.get_num_of_hits());
+
+  // same key with other operands is a collision, the result is computed again
+  dfaFree(cache.Apply("key", {ba_auto->getDFA()}, compute));
+  EXPECT_EQ(2, num_of_computations);
+  EXPECT_EQ(num_of_hits + 1, cache.get_num_of_hits());
+  delete ab_auto;
+  delete ba_auto;
+}
+
+TEST_F(AutomatonCacheTest, CachedIntersectionIsEqualToComputed) {
+  StringAutomaton_ptr ab_auto = StringAutomaton::MakeRegexAuto("(ab)*");
+  StringAutomaton_ptr length_auto = StringAutomaton::MakeAnyStringLengthEqualTo(4);
+  StringAutomaton_ptr first_auto = ab_auto->Intersect(length_auto);
+  const unsigned long num_of_hits = AutomatonCache::GetInstance().get_num_of_hits();
+  StringAutomaton_ptr second_auto = ab_auto->Intersect(length_auto);
+  EXPECT_LT(num_of_hits, AutomatonCache::GetInstance().get_num_of_hits());
+  EXPECT_TRUE(AutomatonCache::IsEqual(first_auto->getDFA(), second_auto->getDFA()));
+  EXPECT_TRUE(first_auto->IsAcceptingSingleString());
+  delete ab_auto;
+  delete length_auto;
+  delete first_auto;
+  delete second_auto;
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
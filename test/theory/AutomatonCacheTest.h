@@ -0,0 +1,34 @@
+/*
+ * AutomatonCacheTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_AUTOMATONCACHETEST_H_
+#define THEORY_AUTOMATONCACHETEST_H_
+
+#include <cstddef>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/AutomatonCache.h"
+#include "theory/StringAutomaton.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class AutomatonCacheTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  std::size_t memory_budget_;
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_AUTOMATONCACHETEST_H_ */
@@ -18,10 +18,10 @@ class PublicBinaryIntAutomaton : public BinaryIntAutomaton {
  public:
   using BinaryIntAutomaton::BinaryIntAutomaton;
   using BinaryIntAutomaton::type_;
-  using BinaryIntAutomaton::is_count_matrix_cached_;
+  using BinaryIntAutomaton::is_counter_cached_;
   using BinaryIntAutomaton::dfa_;
   using BinaryIntAutomaton::num_of_bdd_variables_;
-  using BinaryIntAutomaton::count_matrix_;
+  using BinaryIntAutomaton::counter_;
   using BinaryIntAutomaton::is_natural_number_;
   using BinaryIntAutomaton::formula_;
 
@@ -31,9 +31,21 @@ using namespace ::testing;
 using namespace Vlab::Test::Path;
 
 void BinaryIntAutomatonTest::SetUp() {
+  symbolic_arithmetic_threshold_ = Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD;
 }
 
 void BinaryIntAutomatonTest::TearDown() {
+  Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD = symbolic_arithmetic_threshold_;
+}
+
+void BinaryIntAutomatonTest::ExpectSameConstructions(ArithmeticFormula_ptr formula, const bool is_natural_number) {
+  Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD = 0;
+  auto symbolic_auto = BinaryIntAutomaton::MakeAutomaton(formula->clone(), is_natural_number);
+  Option::Theory::SYMBOLIC_ARITHMETIC_THRESHOLD = std::numeric_limits<int>::max();
+  auto enumerated_auto = BinaryIntAutomaton::MakeAutomaton(formula->clone(), is_natural_number);
+  EXPECT_TRUE(symbolic_auto->IsEqual(enumerated_auto)) << *formula << (is_natural_number ? " natural" : " int");
+  delete symbolic_auto;
+  delete enumerated_auto;
 }
 
 TEST_F(BinaryIntAutomatonTest, ConstructorWith1Args) {
@@ -54,11 +66,11 @@ TEST_F(BinaryIntAutomatonTest, ConstructorWith3Args) {
   EXPECT_EQ(5, b_int_auto_0.num_of_bdd_variables_);
 
   auto formula = new ArithmeticFormula();
-  formula->set_type(ArithmeticFormula::Type::EQ);
-  formula->set_constant(7);
-  formula->add_variable("x", 1);
-  formula->add_variable("y", 2);
-  formula->add_variable("z", 3);
+  formula->SetType(ArithmeticFormula::Type::EQ);
+  formula->SetConstant(7);
+  formula->AddVariable("x", 1);
+  formula->AddVariable("y", 2);
+  formula->AddVariable("z", 3);
   PublicBinaryIntAutomaton b_int_auto_1(nullptr, formula, true);
   EXPECT_EQ(Automaton::Type::BINARYINT, b_int_auto_1.type_);
   EXPECT_EQ(formula, b_int_auto_1.formula_);
@@ -70,16 +82,16 @@ TEST_F(BinaryIntAutomatonTest, ConstructorWith3Args) {
 
 TEST_F(BinaryIntAutomatonTest, CopyConstructor) {
   auto formula = new ArithmeticFormula();
-  formula->set_type(ArithmeticFormula::Type::EQ);
-  formula->set_constant(7);
-  formula->add_variable("x", 1);
-  formula->add_variable("y", 2);
-  formula->add_variable("z", 3);
+  formula->SetType(ArithmeticFormula::Type::EQ);
+  formula->SetConstant(7);
+  formula->AddVariable("x", 1);
+  formula->AddVariable("y", 2);
+  formula->AddVariable("z", 3);
 
   PublicBinaryIntAutomaton b_int_auto_0(nullptr, formula, true);
   PublicBinaryIntAutomaton b_int_auto_1(b_int_auto_0);
   EXPECT_EQ(Automaton::Type::BINARYINT, b_int_auto_1.type_);
-  EXPECT_THAT(b_int_auto_1.formula_->get_variable_coefficient_map(), ElementsAre(Pair("x", 1), Pair("y", 2), Pair("z", 3)));
+  EXPECT_THAT(b_int_auto_1.formula_->GetVariableCoefficientMap(), ElementsAre(Pair("x", 1), Pair("y", 2), Pair("z", 3)));
   EXPECT_EQ(nullptr, b_int_auto_1.dfa_);
   EXPECT_EQ(true, b_int_auto_1.is_natural_number_);
   EXPECT_EQ(3, b_int_auto_1.num_of_bdd_variables_);
@@ -87,11 +99,11 @@ TEST_F(BinaryIntAutomatonTest, CopyConstructor) {
 
 TEST_F(BinaryIntAutomatonTest, MakePhi) {
   auto formula = new ArithmeticFormula();
-  formula->set_type(ArithmeticFormula::Type::EQ);
-  formula->set_constant(7);
-  formula->add_variable("x", 1);
-  formula->add_variable("y", 2);
-  formula->add_variable("z", 3);
+  formula->SetType(ArithmeticFormula::Type::EQ);
+  formula->SetConstant(7);
+  formula->AddVariable("x", 1);
+  formula->AddVariable("y", 2);
+  formula->AddVariable("z", 3);
 
   auto result = BinaryIntAutomaton::MakePhi(formula, false);
   PublicBinaryIntAutomaton* presult = static_cast<PublicBinaryIntAutomaton*>(result);
@@ -102,6 +114,42 @@ TEST_F(BinaryIntAutomatonTest, MakePhi) {
   // TODO add an automaton check wrt a expectation
 }
 
+TEST_F(BinaryIntAutomatonTest, SymbolicCountHonoursTheBoundFlag) {
+  auto formula = new ArithmeticFormula();
+  formula->AddVariable("x", 1);
+  auto any_int_auto = BinaryIntAutomaton::MakeAnyInt(formula, false);
+  // 3 bits and a sign bit hold 16 values, 8 of them do not fit in 2 bits and a sign bit
+  EXPECT_EQ(BigInteger(16), any_int_auto->SymbolicCount(3.0, true));
+  EXPECT_EQ(BigInteger(8), any_int_auto->SymbolicCount(3.0, false));
+  EXPECT_EQ(BigInteger(2), any_int_auto->SymbolicCount(0.0, false));
+  EXPECT_EQ(BigInteger(16), any_int_auto->SymbolicCount(3.5, true));
+  EXPECT_EQ(BigInteger(0), any_int_auto->SymbolicCount(-1.0, true));
+  delete any_int_auto;
+}
+
+TEST_F(BinaryIntAutomatonTest, SymbolicConstructionMatchesEnumeration) {
+  const std::vector<ArithmeticFormula::Type> types {ArithmeticFormula::Type::EQ, ArithmeticFormula::Type::NOTEQ,
+      ArithmeticFormula::Type::LT, ArithmeticFormula::Type::LE, ArithmeticFormula::Type::GT,
+      ArithmeticFormula::Type::GE};
+  const std::vector<std::vector<int>> coefficients {{1}, {2, -1}, {1, -2, 3}, {3, 3, -4, 1}};
+  const std::vector<int> constants {-7, -2, -1, 0, 1, 5};
+  for (auto type : types) {
+    for (auto& coeffs : coefficients) {
+      for (int constant : constants) {
+        auto formula = new ArithmeticFormula();
+        for (std::size_t i = 0; i < coeffs.size(); ++i) {
+          formula->AddVariable("x" + std::to_string(i), coeffs[i]);
+        }
+        formula->SetConstant(constant);
+        formula->SetType(type);
+        ExpectSameConstructions(formula, false);
+        ExpectSameConstructions(formula, true);
+        delete formula;
+      }
+    }
+  }
+}
+
 //TEST_F(BinaryIntAutomatonTest, Complement) {
 //  std::stringstream ss;
 //    std::string expected;
@@ -11,6 +11,7 @@
 #ifndef THEORY_BINARYINTAUTOMATONTEST_H_
 #define THEORY_BINARYINTAUTOMATONTEST_H_
 
+#include <limits>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -27,6 +28,13 @@ protected:
   virtual void SetUp();
   virtual void TearDown();
 
+  /**
+   * Builds the automaton of the formula with the symbolic construction and with the enumerating construction and
+   * expects the same language
+   */
+  static void ExpectSameConstructions(ArithmeticFormula_ptr formula, const bool is_natural_number);
+
+  int symbolic_arithmetic_threshold_;
 };
 
 } /* namespace Test */
@@ -0,0 +1,107 @@
+/*
+ * LinearRecurrenceTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "LinearRecurrenceTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+void LinearRecurrenceTest::SetUp() {
+}
+
+void LinearRecurrenceTest::TearDown() {
+}
+
+std::vector<BigInteger> LinearRecurrenceTest::Generate(const std::vector<BigInteger>& coefficients,
+                                                       const std::vector<BigInteger>& initial_terms,
+                                                       const std::size_t num_of_terms) {
+  std::vector<BigInteger> sequence(initial_terms);
+  while (sequence.size() < num_of_terms) {
+    BigInteger term = 0;
+    for (std::size_t i = 0; i < coefficients.size(); ++i) {
+      term += coefficients[i] * sequence[sequence.size() - 1 - i];
+    }
+    sequence.push_back(term);
+  }
+  sequence.resize(num_of_terms);
+  return sequence;
+}
+
+TEST_F(LinearRecurrenceTest, FibonacciIsFound) {
+  auto recurrence = LinearRecurrence::Make({0, 1, 1, 2, 3, 5, 8, 13});
+  EXPECT_THAT(recurrence.get_coefficients(), ElementsAre(1, 1));
+  EXPECT_THAT(recurrence.get_initial_terms(), ElementsAre(0, 1));
+  EXPECT_EQ(BigInteger(55), recurrence.Evaluate(10));
+  EXPECT_EQ(BigInteger("2880067194370816120"), recurrence.Evaluate(90));
+}
+
+TEST_F(LinearRecurrenceTest, GeometricSequenceHasOrderOne) {
+  auto recurrence = LinearRecurrence::Make({3, 6, 12, 24});
+  EXPECT_THAT(recurrence.get_coefficients(), ElementsAre(2));
+  EXPECT_THAT(recurrence.get_initial_terms(), ElementsAre(3));
+  EXPECT_EQ(BigInteger(3) << 100, recurrence.Evaluate(100));
+}
+
+TEST_F(LinearRecurrenceTest, PolynomialSequence) {
+  // n^2 satisfies the recurrence of (x - 1)^3
+  auto recurrence = LinearRecurrence::Make({0, 1, 4, 9, 16, 25});
+  EXPECT_THAT(recurrence.get_coefficients(), ElementsAre(3, -3, 1));
+  EXPECT_EQ(BigInteger(1000000), recurrence.Evaluate(1000));
+  EXPECT_EQ(BigInteger(1) << 80, recurrence.Evaluate(BigInteger(1) << 40));
+}
+
+TEST_F(LinearRecurrenceTest, ZeroSequenceIsEmpty) {
+  auto recurrence = LinearRecurrence::Make({0, 0, 0, 0});
+  EXPECT_TRUE(recurrence.is_empty());
+  EXPECT_EQ(BigInteger(0), recurrence.Evaluate(7));
+  EXPECT_EQ(BigInteger(0), recurrence.PartialSums().Evaluate(7));
+}
+
+TEST_F(LinearRecurrenceTest, RecurrenceIsRecoveredFromTwiceItsOrder) {
+  const std::vector<BigInteger> coefficients {2, 0, -1, 3};
+  auto sequence = Generate(coefficients, {1, -2, 5, 0}, 200);
+  auto recurrence = LinearRecurrence::Make(std::vector<BigInteger>(sequence.begin(), sequence.begin() + 8));
+  EXPECT_EQ(coefficients, recurrence.get_coefficients());
+  for (std::size_t n = 0; n < sequence.size(); ++n) {
+    EXPECT_EQ(sequence[n], recurrence.Evaluate(n)) << "term " << n;
+  }
+}
+
+TEST_F(LinearRecurrenceTest, LeadingZerosAreInitialTerms) {
+  // counts of strings over {a, b} of length at most n that end with "ab"
+  auto sequence = Generate({3, -2, 0}, {0, 0, 1}, 64);
+  auto recurrence = LinearRecurrence::Make(std::vector<BigInteger>(sequence.begin(), sequence.begin() + 8));
+  EXPECT_EQ(3, recurrence.order());
+  for (std::size_t n = 0; n < sequence.size(); ++n) {
+    EXPECT_EQ(sequence[n], recurrence.Evaluate(n)) << "term " << n;
+  }
+}
+
+TEST_F(LinearRecurrenceTest, PartialSumsAddUpTheTerms) {
+  std::vector<std::vector<BigInteger>> sequences {
+    Generate({1, 1}, {0, 1}, 60),
+    Generate({2}, {1}, 60),
+    Generate({3, -2, 0}, {0, 0, 1}, 60),
+    Generate({2, 0, -1, 3}, {1, -2, 5, 0}, 60) };
+  for (auto& sequence : sequences) {
+    auto recurrence = LinearRecurrence::Make(sequence);
+    auto partial_sums = recurrence.PartialSums();
+    EXPECT_EQ(recurrence.order() + 1, partial_sums.order());
+    BigInteger sum = 0;
+    for (std::size_t n = 0; n < sequence.size(); ++n) {
+      sum += sequence[n];
+      EXPECT_EQ(sum, partial_sums.Evaluate(n)) << "term " << n << " of " << recurrence;
+    }
+  }
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
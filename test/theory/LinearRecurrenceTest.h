@@ -0,0 +1,38 @@
+/*
+ * LinearRecurrenceTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_LINEARRECURRENCETEST_H_
+#define THEORY_LINEARRECURRENCETEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/Automaton.h"
+#include "theory/LinearRecurrence.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class LinearRecurrenceTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * @return first num_of_terms terms of a(n) = c(1) * a(n-1) + ... + c(d) * a(n-d)
+   */
+  static std::vector<BigInteger> Generate(const std::vector<BigInteger>& coefficients,
+                                          const std::vector<BigInteger>& initial_terms, const std::size_t num_of_terms);
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_LINEARRECURRENCETEST_H_ */
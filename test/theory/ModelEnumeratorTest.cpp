@@ -0,0 +1,95 @@
+/*
+ * ModelEnumeratorTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ModelEnumeratorTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+void ModelEnumeratorTest::SetUp() {
+}
+
+void ModelEnumeratorTest::TearDown() {
+}
+
+std::map<unsigned long, int> ModelEnumeratorTest::CountWordsByLength(ModelEnumerator& enumerator,
+                                                                      const int max_words) {
+  std::map<unsigned long, int> num_of_words;
+  std::set<std::vector<bool>> words;
+  unsigned long previous_length = 0;
+  for (int i = 0; i < max_words and enumerator.HasNext(); ++i) {
+    const unsigned long length = enumerator.get_length();
+    EXPECT_LE(previous_length, length) << "words are not in length order";
+    previous_length = length;
+    EXPECT_TRUE(words.insert(enumerator.Next()).second) << "word is enumerated twice";
+    ++num_of_words[length];
+  }
+  return num_of_words;
+}
+
+TEST_F(ModelEnumeratorTest, BoundedWordsAreEnumeratedInLengthOrder) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("(a|b){0,2}|c*");
+  ModelEnumerator enumerator(string_auto, 3);
+  auto num_of_words = CountWordsByLength(enumerator, 100);
+  EXPECT_THAT(num_of_words, ElementsAre(Pair(0, 1), Pair(1, 3), Pair(2, 5), Pair(3, 1)));
+  EXPECT_FALSE(enumerator.HasNext());
+  delete string_auto;
+}
+
+TEST_F(ModelEnumeratorTest, FiniteLanguageEndsWithoutBound) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("ab|c|de");
+  ModelEnumerator enumerator(string_auto);
+  auto num_of_words = CountWordsByLength(enumerator, 100);
+  EXPECT_THAT(num_of_words, ElementsAre(Pair(1, 1), Pair(2, 2)));
+  EXPECT_FALSE(enumerator.HasNext());
+  delete string_auto;
+}
+
+TEST_F(ModelEnumeratorTest, InfiniteLanguageGoesOnWithoutBound) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("(a|b)(cc)*");
+  ModelEnumerator enumerator(string_auto);
+  auto num_of_words = CountWordsByLength(enumerator, 40);
+  ASSERT_EQ(20, num_of_words.size());
+  for (auto& length_entry : num_of_words) {
+    EXPECT_EQ(1, length_entry.first % 2);
+    EXPECT_EQ(2, length_entry.second);
+  }
+  EXPECT_TRUE(enumerator.HasNext());
+  delete string_auto;
+}
+
+TEST_F(ModelEnumeratorTest, LengthsWithoutWordsAreSkipped) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("a|b{30}");
+  ModelEnumerator enumerator(string_auto);
+  auto num_of_words = CountWordsByLength(enumerator, 100);
+  EXPECT_THAT(num_of_words, ElementsAre(Pair(1, 1), Pair(30, 1)));
+  EXPECT_FALSE(enumerator.HasNext());
+  delete string_auto;
+}
+
+TEST_F(ModelEnumeratorTest, EmptyLanguageHasNoWords) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakePhi();
+  ModelEnumerator bounded_enumerator(string_auto, 5);
+  EXPECT_FALSE(bounded_enumerator.HasNext());
+  ModelEnumerator enumerator(string_auto);
+  EXPECT_FALSE(enumerator.HasNext());
+  delete string_auto;
+}
+
+TEST_F(ModelEnumeratorTest, BoundBelowShortestWordHasNoWords) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("abc*");
+  ModelEnumerator enumerator(string_auto, 1);
+  EXPECT_FALSE(enumerator.HasNext());
+  delete string_auto;
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
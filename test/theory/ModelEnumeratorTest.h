@@ -0,0 +1,40 @@
+/*
+ * ModelEnumeratorTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_MODELENUMERATORTEST_H_
+#define THEORY_MODELENUMERATORTEST_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/ModelEnumerator.h"
+#include "theory/StringAutomaton.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class ModelEnumeratorTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * Pulls at most max_words words
+   * @return number of words of each length
+   */
+  static std::map<unsigned long, int> CountWordsByLength(ModelEnumerator& enumerator, const int max_words);
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_MODELENUMERATORTEST_H_ */
@@ -0,0 +1,118 @@
+/*
+ * RegexCompilerTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "RegexCompilerTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+void RegexCompilerTest::SetUp() {
+}
+
+void RegexCompilerTest::TearDown() {
+}
+
+void RegexCompilerTest::ExpectSameLanguage(const std::string& regex, StringAutomaton_ptr expected_auto) {
+  StringAutomaton_ptr regex_auto = StringAutomaton::MakeRegexAuto(regex);
+  EXPECT_TRUE(regex_auto->IsEqual(expected_auto)) << regex;
+  delete regex_auto;
+  delete expected_auto;
+}
+
+TEST_F(RegexCompilerTest, String) {
+  ExpectSameLanguage("abc", StringAutomaton::MakeString("abc"));
+}
+
+TEST_F(RegexCompilerTest, UnionAndStar) {
+  StringAutomaton_ptr ab_auto = StringAutomaton::MakeString("ab");
+  StringAutomaton_ptr c_auto = StringAutomaton::MakeString("c");
+  StringAutomaton_ptr union_auto = ab_auto->Union(c_auto);
+  ExpectSameLanguage("(ab|c)*", union_auto->KleeneClosure());
+  delete ab_auto;
+  delete c_auto;
+  delete union_auto;
+}
+
+TEST_F(RegexCompilerTest, PlusAndOptional) {
+  StringAutomaton_ptr a_auto = StringAutomaton::MakeString("a");
+  StringAutomaton_ptr b_auto = StringAutomaton::MakeString("b");
+  StringAutomaton_ptr a_plus_auto = a_auto->Closure();
+  StringAutomaton_ptr b_optional_auto = b_auto->Optional();
+  ExpectSameLanguage("a+b?", a_plus_auto->Concat(b_optional_auto));
+  delete a_auto;
+  delete b_auto;
+  delete a_plus_auto;
+  delete b_optional_auto;
+}
+
+TEST_F(RegexCompilerTest, CharRangeAndRepeat) {
+  StringAutomaton_ptr range_auto = StringAutomaton::MakeCharRange('a', 'c');
+  ExpectSameLanguage("[a-c]{2,3}", range_auto->Repeat(2, 3));
+  delete range_auto;
+}
+
+TEST_F(RegexCompilerTest, NegatedCharClass) {
+  StringAutomaton_ptr any_char_auto = StringAutomaton::MakeAnyChar();
+  StringAutomaton_ptr a_auto = StringAutomaton::MakeString("a");
+  ExpectSameLanguage("[^a]", any_char_auto->Difference(a_auto));
+  delete any_char_auto;
+  delete a_auto;
+}
+
+TEST_F(RegexCompilerTest, AnyCharAnyStringAndEmpty) {
+  ExpectSameLanguage(".", StringAutomaton::MakeAnyChar());
+  ExpectSameLanguage("@", StringAutomaton::MakeAnyString());
+  ExpectSameLanguage("#", StringAutomaton::MakePhi());
+}
+
+TEST_F(RegexCompilerTest, Complement) {
+  StringAutomaton_ptr a_auto = StringAutomaton::MakeString("a");
+  StringAutomaton_ptr a_star_auto = a_auto->KleeneClosure();
+  ExpectSameLanguage("~(a*)", a_star_auto->Complement());
+  delete a_auto;
+  delete a_star_auto;
+}
+
+TEST_F(RegexCompilerTest, Intersection) {
+  StringAutomaton_ptr range_auto = StringAutomaton::MakeCharRange('a', 'd');
+  StringAutomaton_ptr range_star_auto = range_auto->KleeneClosure();
+  StringAutomaton_ptr any_auto = StringAutomaton::MakeAnyString();
+  StringAutomaton_ptr b_auto = StringAutomaton::MakeString("b");
+  StringAutomaton_ptr any_b_auto = any_auto->Concat(b_auto);
+  StringAutomaton_ptr contains_b_auto = any_b_auto->Concat(any_auto);
+  ExpectSameLanguage("[a-d]*&(.*b.*)", range_star_auto->Intersect(contains_b_auto));
+  delete range_auto;
+  delete range_star_auto;
+  delete any_auto;
+  delete b_auto;
+  delete any_b_auto;
+  delete contains_b_auto;
+}
+
+TEST_F(RegexCompilerTest, SuffixOfStar) {
+  StringAutomaton_ptr range_auto = StringAutomaton::MakeCharRange('a', 'b');
+  StringAutomaton_ptr range_star_auto = range_auto->KleeneClosure();
+  StringAutomaton_ptr abb_auto = StringAutomaton::MakeString("abb");
+  ExpectSameLanguage("(a|b)*abb", range_star_auto->Concat(abb_auto));
+  delete range_auto;
+  delete range_star_auto;
+  delete abb_auto;
+}
+
+TEST_F(RegexCompilerTest, CountOfCompiledExpression) {
+  StringAutomaton_ptr regex_auto = StringAutomaton::MakeRegexAuto("[a-z]{3}|[0-9]{2}");
+  EXPECT_EQ(26 * 26 * 26, regex_auto->Count(3) - regex_auto->Count(2));
+  EXPECT_EQ(100, regex_auto->Count(2) - regex_auto->Count(1));
+  delete regex_auto;
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,38 @@
+/*
+ * RegexCompilerTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_REGEXCOMPILERTEST_H_
+#define THEORY_REGEXCOMPILERTEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/RegexCompiler.h"
+#include "theory/StringAutomaton.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class RegexCompilerTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * Compiles the expression and compares it with the automaton built by the automata operations, deletes the
+   * automaton
+   */
+  static void ExpectSameLanguage(const std::string& regex, StringAutomaton_ptr expected_auto);
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_REGEXCOMPILERTEST_H_ */
@@ -0,0 +1,113 @@
+/*
+ * StringAutomatonLengthTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "StringAutomatonLengthTest.h"
+
+#include <algorithm>
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+const int StringAutomatonLengthTest::MAX_LENGTH = 30;
+
+void StringAutomatonLengthTest::SetUp() {
+}
+
+void StringAutomatonLengthTest::TearDown() {
+}
+
+bool StringAutomatonLengthTest::IsMember(SemilinearSet_ptr semilinear_set, const int value) {
+  auto& constants = semilinear_set->get_constants();
+  if (std::find(constants.begin(), constants.end(), value) != constants.end()) {
+    return true;
+  }
+  const int period = semilinear_set->get_period();
+  const int cycle_head = semilinear_set->get_cycle_head();
+  if (period <= 0 or value < cycle_head) {
+    return false;
+  }
+  auto& periodic_constants = semilinear_set->get_periodic_constants();
+  return std::find(periodic_constants.begin(), periodic_constants.end(), (value - cycle_head) % period)
+      != periodic_constants.end();
+}
+
+bool StringAutomatonLengthTest::HasLength(StringAutomaton_ptr string_auto, const int length) {
+  StringAutomaton_ptr length_auto = StringAutomaton::MakeAnyStringLengthEqualTo(length);
+  StringAutomaton_ptr restricted_auto = string_auto->Intersect(length_auto);
+  const bool has_length = not restricted_auto->IsEmptyLanguage();
+  delete length_auto;
+  delete restricted_auto;
+  return has_length;
+}
+
+void StringAutomatonLengthTest::ExpectSameLengths(const std::string& regex) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto(regex);
+  SemilinearSet_ptr length_set = string_auto->GetLengthSemilinearSet();
+  IntAutomaton_ptr length_auto = string_auto->Length();
+  for (int n = 0; n <= MAX_LENGTH; ++n) {
+    const bool has_length = HasLength(string_auto, n);
+    EXPECT_EQ(has_length, IsMember(length_set, n)) << regex << " length " << n;
+    IntAutomaton_ptr value_auto = length_auto->intersect(n);
+    EXPECT_EQ(has_length, not value_auto->isEmptyLanguage()) << regex << " length " << n;
+    delete value_auto;
+  }
+  delete length_auto;
+  delete length_set;
+  delete string_auto;
+}
+
+TEST_F(StringAutomatonLengthTest, EmptyLanguageHasNoLengths) {
+  StringAutomaton_ptr phi_auto = StringAutomaton::MakePhi();
+  SemilinearSet_ptr length_set = phi_auto->GetLengthSemilinearSet();
+  EXPECT_TRUE(length_set->is_empty_set());
+  delete length_set;
+  delete phi_auto;
+}
+
+TEST_F(StringAutomatonLengthTest, FiniteLanguagesHaveOnlyConstants) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("abc|de|fghij");
+  SemilinearSet_ptr length_set = string_auto->GetLengthSemilinearSet();
+  EXPECT_TRUE(length_set->has_only_constants());
+  EXPECT_THAT(length_set->get_constants(), ElementsAre(2, 3, 5));
+  delete length_set;
+  delete string_auto;
+  ExpectSameLengths("abc");
+  ExpectSameLengths("[a-c]{2,4}");
+}
+
+TEST_F(StringAutomatonLengthTest, StarHasAPeriod) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("(ab)*c");
+  SemilinearSet_ptr length_set = string_auto->GetLengthSemilinearSet();
+  EXPECT_EQ(2, length_set->get_period());
+  EXPECT_FALSE(IsMember(length_set, 0));
+  EXPECT_TRUE(IsMember(length_set, 1));
+  EXPECT_FALSE(IsMember(length_set, 2));
+  EXPECT_TRUE(IsMember(length_set, 21));
+  delete length_set;
+  delete string_auto;
+  ExpectSameLengths("(ab)*c");
+}
+
+TEST_F(StringAutomatonLengthTest, UnionOfPeriods) {
+  ExpectSameLengths("a{2,4}|(bcd)+");
+  ExpectSameLengths("(aa|aaa)*");
+  ExpectSameLengths("(abcde)*|(ab)*x");
+  ExpectSameLengths("x[a-z]{3,5}(yy|zzz)*");
+}
+
+TEST_F(StringAutomatonLengthTest, ComplementAndIntersection) {
+  ExpectSameLengths("~((aa)*)");
+  ExpectSameLengths("(a|b)*&((ab)*|(aab)*)");
+  ExpectSameLengths("@");
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,46 @@
+/*
+ * StringAutomatonLengthTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_STRINGAUTOMATONLENGTHTEST_H_
+#define THEORY_STRINGAUTOMATONLENGTHTEST_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/IntAutomaton.h"
+#include "theory/SemilinearSet.h"
+#include "theory/StringAutomaton.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class StringAutomatonLengthTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  static const int MAX_LENGTH;
+
+  static bool IsMember(SemilinearSet_ptr semilinear_set, const int value);
+  /**
+   * @return true if the automaton accepts a string of the length, found by intersecting with all strings of the length
+   */
+  static bool HasLength(StringAutomaton_ptr string_auto, const int length);
+  /**
+   * Compares the length semilinear set and the length automaton of the expression with the exact length
+   * intersections up to MAX_LENGTH
+   */
+  static void ExpectSameLengths(const std::string& regex);
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_STRINGAUTOMATONLENGTHTEST_H_ */
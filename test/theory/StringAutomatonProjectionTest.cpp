@@ -0,0 +1,129 @@
+/*
+ * StringAutomatonProjectionTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "StringAutomatonProjectionTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+const int StringAutomatonProjectionTest::NUM_OF_TRACKS = 3;
+
+void StringAutomatonProjectionTest::SetUp() {
+}
+
+void StringAutomatonProjectionTest::TearDown() {
+}
+
+StringAutomaton_ptr StringAutomatonProjectionTest::MakeConcatRelation(const std::string& prefix_regex,
+                                                                      const std::string& suffix_regex) {
+  StringAutomaton_ptr concat_auto = StringAutomaton::MakePrefixSuffix(0, 1, 2, NUM_OF_TRACKS);
+  const int number_of_bdd_variables = concat_auto->get_number_of_bdd_variables();
+  DFA_ptr relation_dfa = dfaCopy(concat_auto->getDFA());
+  delete concat_auto;
+  const std::vector<std::pair<int, std::string>> track_regexes {{1, prefix_regex}, {2, suffix_regex}};
+  for (auto& track_regex : track_regexes) {
+    StringAutomaton_ptr regex_auto = StringAutomaton::MakeRegexAuto(track_regex.second);
+    StringAutomaton_ptr track_auto = new StringAutomaton(regex_auto->getDFA(), track_regex.first, NUM_OF_TRACKS,
+                                                         regex_auto->get_number_of_bdd_variables());
+    DFA_ptr product_dfa = dfaProduct(relation_dfa, track_auto->getDFA(), dfaAND);
+    dfaFree(relation_dfa);
+    relation_dfa = dfaMinimize(product_dfa);
+    dfaFree(product_dfa);
+    delete regex_auto;
+    delete track_auto;
+  }
+  return new StringAutomaton(relation_dfa, NUM_OF_TRACKS, number_of_bdd_variables);
+}
+
+DFA_ptr StringAutomatonProjectionTest::ProjectPerVariable(const DFA_ptr dfa, const std::vector<int>& map,
+                                                          const std::vector<int>& indices) {
+  DFA_ptr result_dfa = dfaCopy(dfa);
+  for (auto index : indices) {
+    DFA_ptr projected_dfa = dfaProject(result_dfa, (unsigned)index);
+    dfaFree(result_dfa);
+    result_dfa = dfaMinimize(projected_dfa);
+    dfaFree(projected_dfa);
+  }
+  std::vector<int> indices_map (map);
+  dfaReplaceIndices(result_dfa, &indices_map[0]);
+  return result_dfa;
+}
+
+void StringAutomatonProjectionTest::ExpectSameProjections(StringAutomaton_ptr relation_auto) {
+  const int num_tracks = relation_auto->GetNumTracks();
+  const int number_of_bdd_variables = relation_auto->get_number_of_bdd_variables();
+  const int var_per_track = number_of_bdd_variables / num_tracks;
+  for (int k_track = 0; k_track < num_tracks; ++k_track) {
+    // same renaming as ProjectKTrack, the projected track goes to the end
+    std::vector<int> map (number_of_bdd_variables);
+    std::vector<int> indices;
+    for (int i = 0, k = 0, l = 0; i < number_of_bdd_variables; ++i) {
+      if (i == k_track + l * num_tracks) {
+        map[i] = (num_tracks - 1) * var_per_track + l;
+        indices.push_back(i);
+        ++l;
+      } else {
+        map[i] = k++;
+      }
+    }
+    StringAutomaton_ptr projected_auto = relation_auto->ProjectKTrack(k_track);
+    StringAutomaton_ptr expected_auto = new StringAutomaton(ProjectPerVariable(relation_auto->getDFA(), map, indices),
+                                                            num_tracks - 1, (num_tracks - 1) * var_per_track);
+    EXPECT_TRUE(projected_auto->IsEqual(expected_auto)) << "ProjectKTrack(" << k_track << ")";
+    delete projected_auto;
+    delete expected_auto;
+
+    // same renaming as GetKTrack, the kept track goes to the front
+    indices.clear();
+    for (int i = 0; i < num_tracks; ++i) {
+      const int shift = (i > k_track) ? i - 1 : i;
+      for (int k = 0; k < var_per_track; ++k) {
+        if (i == k_track) {
+          map[i + num_tracks * k] = k;
+        } else {
+          map[i + num_tracks * k] = var_per_track + shift + (num_tracks - 1) * k;
+          indices.push_back(i + num_tracks * k);
+        }
+      }
+    }
+    DFA_ptr track_dfa = ProjectPerVariable(relation_auto->getDFA(), map, indices);
+    DFA_ptr trimmed_dfa = StringAutomaton::TrimLambdaSuffix(track_dfa, var_per_track, false);
+    dfaFree(track_dfa);
+    track_dfa = StringAutomaton::TrimLambdaPrefix(trimmed_dfa, var_per_track);
+    dfaFree(trimmed_dfa);
+    StringAutomaton_ptr track_auto = relation_auto->GetKTrack(k_track);
+    expected_auto = new StringAutomaton(track_dfa, var_per_track - 1);
+    EXPECT_TRUE(track_auto->IsEqual(expected_auto)) << "GetKTrack(" << k_track << ")";
+    delete track_auto;
+    delete expected_auto;
+  }
+}
+
+TEST_F(StringAutomatonProjectionTest, ConcatOfConstants) {
+  StringAutomaton_ptr relation_auto = MakeConcatRelation("ab", "c");
+  ExpectSameProjections(relation_auto);
+  delete relation_auto;
+}
+
+TEST_F(StringAutomatonProjectionTest, ConcatOfLoops) {
+  StringAutomaton_ptr relation_auto = MakeConcatRelation("(ab)*", "c+");
+  ExpectSameProjections(relation_auto);
+  delete relation_auto;
+}
+
+TEST_F(StringAutomatonProjectionTest, ConcatOfChoices) {
+  StringAutomaton_ptr relation_auto = MakeConcatRelation("a|bc", "(a|d)*");
+  ExpectSameProjections(relation_auto);
+  delete relation_auto;
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,50 @@
+/*
+ * StringAutomatonProjectionTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_STRINGAUTOMATONPROJECTIONTEST_H_
+#define THEORY_STRINGAUTOMATONPROJECTIONTEST_H_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/StringAutomaton.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class StringAutomatonProjectionTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  static const int NUM_OF_TRACKS;
+
+  /**
+   * @return a multi-track automaton where track 0 is the concatenation of tracks 1 and 2, the tracks are restricted
+   * with the given expressions
+   */
+  static StringAutomaton_ptr MakeConcatRelation(const std::string& prefix_regex, const std::string& suffix_regex);
+  /**
+   * Projects the bdd variables away one at a time with a minimization after each one and renames the rest with the
+   * map, the way multi-track projection used to work
+   */
+  static DFA_ptr ProjectPerVariable(const DFA_ptr dfa, const std::vector<int>& map, const std::vector<int>& indices);
+  /**
+   * Compares ProjectKTrack and GetKTrack on each track with the per variable projection
+   */
+  static void ExpectSameProjections(StringAutomaton_ptr relation_auto);
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_STRINGAUTOMATONPROJECTIONTEST_H_ */
@@ -0,0 +1,234 @@
+/*
+ * SymbolicCounterTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "SymbolicCounterTest.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+const std::vector<SymbolicCounter::Method> SymbolicCounterTest::METHODS = {
+    SymbolicCounter::Method::ITERATIVE, SymbolicCounter::Method::MATRIX_EXPONENTIATION,
+    SymbolicCounter::Method::LINEAR_RECURRENCE, SymbolicCounter::Method::FIXED_WIDTH,
+    SymbolicCounter::Method::MODULAR };
+
+void SymbolicCounterTest::SetUp() {
+}
+
+void SymbolicCounterTest::TearDown() {
+}
+
+SymbolicCounter SymbolicCounterTest::MakeCounter(const std::vector<std::vector<BigInteger>>& transition_counts,
+                                                 const std::vector<bool>& is_accepting,
+                                                 const SymbolicCounter::Type type, const bool count_bound_exact) {
+  const int num_of_states = transition_counts.size();
+  std::vector<Eigen::Triplet<BigInteger>> entries;
+  for (int s = 0; s < num_of_states; ++s) {
+    for (int t = 0; t < num_of_states; ++t) {
+      if (transition_counts[s][t] != 0) {
+        entries.push_back(Eigen::Triplet<BigInteger>(s, t, transition_counts[s][t]));
+      }
+    }
+    if (is_accepting[s]) {
+      entries.push_back(Eigen::Triplet<BigInteger>(s, num_of_states, 1));
+    }
+  }
+  if (not count_bound_exact) {
+    entries.push_back(Eigen::Triplet<BigInteger>(num_of_states, num_of_states, 1));
+  }
+  Eigen::SparseMatrix<BigInteger> count_matrix(num_of_states + 1, num_of_states + 1);
+  count_matrix.setFromTriplets(entries.begin(), entries.end());
+  count_matrix.makeCompressed();
+
+  SymbolicCounter counter;
+  counter.set_type(type);
+  counter.set_transition_count_matrix(count_matrix);
+  counter.set_initialization_vector(count_matrix.innerVector(count_matrix.cols() - 1));
+  return counter;
+}
+
+std::vector<BigInteger> SymbolicCounterTest::CountEach(const SymbolicCounter& counter,
+                                                       const std::vector<unsigned long>& bounds,
+                                                       const SymbolicCounter::Method method) {
+  std::vector<BigInteger> counts;
+  for (auto bound : bounds) {
+    SymbolicCounter fresh_counter = counter;
+    counts.push_back(fresh_counter.Count(bound, method));
+  }
+  return counts;
+}
+
+SymbolicCounter SymbolicCounterTest::MakeEndsWithAbCounter(const SymbolicCounter::Type type,
+                                                           const bool count_bound_exact) {
+  return MakeCounter({{1, 1, 0}, {0, 1, 1}, {1, 1, 0}}, {false, false, true}, type, count_bound_exact);
+}
+
+TEST_F(SymbolicCounterTest, ExactCountsOfStrings) {
+  SymbolicCounter counter = MakeEndsWithAbCounter(SymbolicCounter::Type::STRING, true);
+  // 2^(n-2) strings of length n >= 2 end with "ab"
+  std::vector<unsigned long> bounds {0, 1, 2, 3, 4, 10, 30};
+  auto counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_THAT(counts, ElementsAre(0, 0, 1, 2, 4, 256, BigInteger(BigInteger(1) << 28)));
+}
+
+TEST_F(SymbolicCounterTest, CountsUpToTheBoundOfStrings) {
+  SymbolicCounter counter = MakeEndsWithAbCounter(SymbolicCounter::Type::STRING);
+  // 2^(n-1) - 1 strings of length at most n end with "ab"
+  std::vector<unsigned long> bounds {0, 1, 2, 3, 10};
+  auto counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_THAT(counts, ElementsAre(0, 0, 1, 3, 511));
+}
+
+TEST_F(SymbolicCounterTest, MethodsAgreeWithIterativeCounting) {
+  std::vector<unsigned long> bounds;
+  for (unsigned long bound = 0; bound <= 40; ++bound) {
+    bounds.push_back(bound);
+  }
+  const std::vector<SymbolicCounter::Type> types {SymbolicCounter::Type::STRING, SymbolicCounter::Type::BINARYINT,
+                                                  SymbolicCounter::Type::BINARYUNSIGNEDINT };
+  for (auto type : types) {
+    for (bool count_bound_exact : {false, true}) {
+      SymbolicCounter counter = MakeEndsWithAbCounter(type, count_bound_exact);
+      auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+      for (auto method : METHODS) {
+        EXPECT_EQ(expected_counts, CountEach(counter, bounds, method))
+            << "type " << static_cast<int>(type) << ", method " << static_cast<int>(method) << ", exact "
+            << count_bound_exact;
+      }
+    }
+  }
+}
+
+TEST_F(SymbolicCounterTest, MethodsAgreeOnUnaryInts) {
+  // one state with a self loop, the unary value n takes 2^n - 1 transitions
+  SymbolicCounter counter = MakeCounter({{1}}, {true}, SymbolicCounter::Type::UNARYINT);
+  std::vector<unsigned long> bounds {0, 1, 2, 5, 12};
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_THAT(expected_counts, ElementsAre(1, 2, 4, 32, 4096));
+  for (auto method : METHODS) {
+    EXPECT_EQ(expected_counts, CountEach(counter, bounds, method)) << "method " << static_cast<int>(method);
+  }
+}
+
+TEST_F(SymbolicCounterTest, BinaryIntsTakeATransitionForTheSignBit) {
+  SymbolicCounter string_counter = MakeEndsWithAbCounter(SymbolicCounter::Type::STRING);
+  SymbolicCounter int_counter = MakeEndsWithAbCounter(SymbolicCounter::Type::BINARYINT);
+  for (unsigned long bound = 0; bound < 10; ++bound) {
+    EXPECT_EQ(string_counter.Count(bound + 1), int_counter.Count(bound));
+    EXPECT_EQ(bound + 1, string_counter.get_bound());
+    EXPECT_EQ(bound + 1, int_counter.get_bound());
+  }
+}
+
+TEST_F(SymbolicCounterTest, IterativeCountingReusesTheCountVector) {
+  SymbolicCounter counter = MakeEndsWithAbCounter(SymbolicCounter::Type::BINARYINT);
+  std::vector<unsigned long> bounds {10, 4, 12, 12, 0, 7};
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  for (std::size_t i = 0; i < bounds.size(); ++i) {
+    EXPECT_EQ(expected_counts[i], counter.Count(bounds[i])) << "bound " << bounds[i];
+    EXPECT_EQ(bounds[i] + 1, counter.get_bound());
+  }
+}
+
+TEST_F(SymbolicCounterTest, CountAllKeepsTheOrderOfTheBounds) {
+  std::vector<unsigned long> bounds {9, 2, 9, 0, 5, 3};
+  SymbolicCounter counter = MakeEndsWithAbCounter(SymbolicCounter::Type::STRING);
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  for (auto method : METHODS) {
+    SymbolicCounter sweep_counter = counter;
+    EXPECT_EQ(expected_counts, sweep_counter.CountAll(bounds, method)) << "method " << static_cast<int>(method);
+  }
+  SymbolicCounter sweep_counter = counter;
+  sweep_counter.CountAll(bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_EQ(9, sweep_counter.get_bound());
+}
+
+TEST_F(SymbolicCounterTest, MinBoundOfInfiniteLanguage) {
+  // a*, one word of each length
+  SymbolicCounter counter = MakeCounter({{1}}, {true}, SymbolicCounter::Type::STRING);
+  counter.Count(20);
+  EXPECT_EQ(4, counter.GetMinBound(5));
+  EXPECT_EQ(4, counter.get_bound());
+  EXPECT_EQ(5, counter.Count(4));
+}
+
+TEST_F(SymbolicCounterTest, MinBoundOfFiniteLanguage) {
+  // a|bb
+  SymbolicCounter counter = MakeCounter({{0, 1, 1, 0}, {0, 0, 0, 0}, {0, 0, 0, 1}, {0, 0, 0, 0}},
+                                        {false, true, false, true}, SymbolicCounter::Type::STRING);
+  EXPECT_EQ(2, counter.GetMinBound(100));
+  // the transition that did not add models was taken
+  EXPECT_EQ(3, counter.get_bound());
+  EXPECT_EQ(2, counter.Count(5));
+  EXPECT_EQ(1, counter.Count(1));
+}
+
+TEST_F(SymbolicCounterTest, FixedWidthCountingPromotesOverflowingCounts) {
+  // one state with 2^40 self loops, counts grow past 64 bits after the first transition
+  SymbolicCounter counter = MakeCounter({{BigInteger(1) << 40}}, {true}, SymbolicCounter::Type::STRING);
+  FixedWidthCountMatrix matrix(counter.get_transition_count_matrix());
+  ASSERT_TRUE(matrix.is_fixed_width());
+  std::vector<uint64_t> count_vector {1, 1};
+  EXPECT_EQ(1, matrix.Multiply(count_vector, 10));
+  EXPECT_THAT(count_vector, ElementsAre((uint64_t(1) << 40) + 1, 1));
+
+  std::vector<unsigned long> bounds {0, 1, 2, 3, 8};
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_EQ(BigInteger(BigInteger(1) << 80) + BigInteger(BigInteger(1) << 40) + 1, expected_counts[2]);
+  EXPECT_EQ(expected_counts, CountEach(counter, bounds, SymbolicCounter::Method::FIXED_WIDTH));
+}
+
+TEST_F(SymbolicCounterTest, FixedWidthCountingFallsBackForWideEntries) {
+  SymbolicCounter counter = MakeCounter({{1, BigInteger(1) << 70}, {0, 1}}, {false, true},
+                                        SymbolicCounter::Type::STRING);
+  FixedWidthCountMatrix matrix(counter.get_transition_count_matrix());
+  EXPECT_FALSE(matrix.is_fixed_width());
+  std::vector<unsigned long> bounds {0, 1, 2, 5};
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_EQ(BigInteger(BigInteger(1) << 70), expected_counts[1]);
+  EXPECT_EQ(expected_counts, CountEach(counter, bounds, SymbolicCounter::Method::FIXED_WIDTH));
+  EXPECT_EQ(expected_counts, CountEach(counter, bounds, SymbolicCounter::Method::MODULAR));
+}
+
+TEST_F(SymbolicCounterTest, ModularCountingReconstructsWithManyPrimes) {
+  SymbolicCounter counter = MakeCounter({{BigInteger(1) << 40, 3}, {5, 7}}, {false, true},
+                                        SymbolicCounter::Type::STRING);
+  FixedWidthCountMatrix matrix(counter.get_transition_count_matrix());
+  // the result bound needs more than one prime
+  EXPECT_GT(matrix.GetResultBitBound(30), 120);
+  std::vector<unsigned long> bounds {0, 1, 2, 7, 30};
+  auto expected_counts = CountEach(counter, bounds, SymbolicCounter::Method::ITERATIVE);
+  EXPECT_EQ(expected_counts, CountEach(counter, bounds, SymbolicCounter::Method::MODULAR));
+}
+
+TEST_F(SymbolicCounterTest, ResiduesReconstructTheValue) {
+  const auto primes = FixedWidthCountMatrix::GetPrimes(6);
+  ASSERT_EQ(6, primes.size());
+  BigInteger value = boost::multiprecision::pow(BigInteger(3), 200);
+  std::vector<uint64_t> residues;
+  for (auto prime : primes) {
+    residues.push_back(static_cast<uint64_t>(value % prime));
+  }
+  EXPECT_EQ(value, FixedWidthCountMatrix::ReconstructFromResidues(&residues[0], primes));
+}
+
+TEST_F(SymbolicCounterTest, FixedWidthMethodsFallBackForLargeUnaryBounds) {
+  // the unary value 70 takes 2^70 - 1 transitions
+  SymbolicCounter counter = MakeCounter({{1}}, {true}, SymbolicCounter::Type::UNARYINT);
+  std::vector<unsigned long> bounds {70};
+  for (auto method : {SymbolicCounter::Method::MATRIX_EXPONENTIATION, SymbolicCounter::Method::FIXED_WIDTH,
+                      SymbolicCounter::Method::MODULAR}) {
+    EXPECT_THAT(CountEach(counter, bounds, method), ElementsAre(BigInteger(BigInteger(1) << 70)))
+        << "method " << static_cast<int>(method);
+  }
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
@@ -0,0 +1,52 @@
+/*
+ * SymbolicCounterTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_SYMBOLICCOUNTERTEST_H_
+#define THEORY_SYMBOLICCOUNTERTEST_H_
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/FixedWidthCountMatrix.h"
+#include "theory/SymbolicCounter.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class SymbolicCounterTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+  /**
+   * Builds a counter the way Automaton::SetSymbolicCounter does, with one artificial state for the accepting states
+   * @param transition_counts number of transitions between each pair of states, state 0 is the initial state
+   * @param count_bound_exact counts only the words of exactly the bound if true
+   */
+  static SymbolicCounter MakeCounter(const std::vector<std::vector<BigInteger>>& transition_counts,
+                                     const std::vector<bool>& is_accepting, const SymbolicCounter::Type type,
+                                     const bool count_bound_exact = false);
+  /**
+   * Strings over {a, b} that end with "ab"
+   */
+  static SymbolicCounter MakeEndsWithAbCounter(const SymbolicCounter::Type type, const bool count_bound_exact = false);
+  /**
+   * Counts every bound with a fresh copy of the counter, so no count vector is reused
+   */
+  static std::vector<BigInteger> CountEach(const SymbolicCounter& counter, const std::vector<unsigned long>& bounds,
+                                           const SymbolicCounter::Method method);
+
+  static const std::vector<SymbolicCounter::Method> METHODS;
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_SYMBOLICCOUNTERTEST_H_ */
@@ -0,0 +1,102 @@
+/*
+ * UniformSamplerTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "UniformSamplerTest.h"
+
+#include <map>
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+using namespace ::testing;
+
+void UniformSamplerTest::SetUp() {
+}
+
+void UniformSamplerTest::TearDown() {
+}
+
+TEST_F(UniformSamplerTest, WordsAreCountedUpToTheBound) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("(a|bc)*");
+  UniformSampler sampler(string_auto, 4);
+  EXPECT_FALSE(sampler.IsEmpty());
+  EXPECT_EQ(12, sampler.get_num_of_words());
+  UniformSampler exact_sampler(string_auto, 4, true);
+  EXPECT_EQ(5, exact_sampler.get_num_of_words());
+  delete string_auto;
+}
+
+TEST_F(UniformSamplerTest, SamplesAreSpreadEvenlyOverTheWords) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("(a|bc)*");
+  std::mt19937_64 rng(7);
+  auto samples = string_auto->GetAcceptingStringsUniform(1200, 4, rng);
+  ASSERT_EQ(1200, samples.size());
+  std::map<std::string, int> num_of_samples;
+  for (auto& sample : samples) {
+    ++num_of_samples[sample];
+  }
+  std::vector<std::string> words;
+  for (auto& sample_entry : num_of_samples) {
+    words.push_back(sample_entry.first);
+    // 100 samples of each word are expected, the bounds are more than 5 standard deviations away
+    EXPECT_GT(sample_entry.second, 50) << sample_entry.first;
+    EXPECT_LT(sample_entry.second, 150) << sample_entry.first;
+  }
+  EXPECT_THAT(words, UnorderedElementsAre("", "a", "aa", "bc", "aaa", "abc", "bca", "aaaa", "aabc", "abca", "bcaa",
+                                          "bcbc"));
+  delete string_auto;
+}
+
+TEST_F(UniformSamplerTest, LengthsFollowTheNumberOfWords) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("[a-z]*");
+  UniformSampler sampler(string_auto, 20);
+  BigInteger num_of_words = 0, power = 1;
+  for (int i = 0; i <= 20; ++i) {
+    num_of_words += power;
+    power *= 26;
+  }
+  EXPECT_EQ(num_of_words, sampler.get_num_of_words());
+
+  std::mt19937_64 rng(11);
+  auto samples = string_auto->GetAcceptingStringsUniform(500, 20, rng);
+  int num_of_longest = 0;
+  for (auto& sample : samples) {
+    EXPECT_LE(sample.size(), 20);
+    num_of_longest += (sample.size() == 20) ? 1 : 0;
+  }
+  // 25 of 26 words have the longest length
+  EXPECT_GT(num_of_longest, 450);
+  delete string_auto;
+}
+
+TEST_F(UniformSamplerTest, SameSeedGivesSameSamples) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("[a-c]{1,6}");
+  std::mt19937_64 rng_0(3), rng_1(3);
+  EXPECT_EQ(string_auto->GetAcceptingStringsUniform(50, 6, rng_0),
+            string_auto->GetAcceptingStringsUniform(50, 6, rng_1));
+  delete string_auto;
+}
+
+TEST_F(UniformSamplerTest, NoWordsWithinTheBound) {
+  StringAutomaton_ptr string_auto = StringAutomaton::MakeRegexAuto("a+");
+  UniformSampler sampler(string_auto, 0);
+  EXPECT_TRUE(sampler.IsEmpty());
+  std::mt19937_64 rng(5);
+  EXPECT_TRUE(string_auto->GetAcceptingStringsUniform(10, 0, rng).empty());
+  EXPECT_THAT(string_auto->GetAcceptingStringsUniform(3, 1, rng), ElementsAre("a", "a", "a"));
+  delete string_auto;
+
+  StringAutomaton_ptr phi_auto = StringAutomaton::MakePhi();
+  UniformSampler phi_sampler(phi_auto, 10);
+  EXPECT_TRUE(phi_sampler.IsEmpty());
+  delete phi_auto;
+}
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
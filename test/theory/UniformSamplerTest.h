@@ -0,0 +1,34 @@
+/*
+ * UniformSamplerTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef THEORY_UNIFORMSAMPLERTEST_H_
+#define THEORY_UNIFORMSAMPLERTEST_H_
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "theory/StringAutomaton.h"
+#include "theory/UniformSampler.h"
+
+namespace Vlab {
+namespace Theory {
+namespace Test {
+
+class UniformSamplerTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+};
+
+} /* namespace Test */
+} /* namespace Theory */
+} /* namespace Vlab */
+
+#endif /* THEORY_UNIFORMSAMPLERTEST_H_ */
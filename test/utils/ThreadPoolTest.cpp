@@ -0,0 +1,95 @@
+/*
+ * ThreadPoolTest.cpp
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#include "ThreadPoolTest.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace Vlab {
+namespace Util {
+namespace Test {
+
+using namespace ::testing;
+
+void ThreadPoolTest::SetUp() {
+}
+
+void ThreadPoolTest::TearDown() {
+}
+
+TEST_F(ThreadPoolTest, ParallelForVisitsEachIndexOnce) {
+  std::vector<std::atomic<int>> visits(1000);
+  for (auto& visit : visits) {
+    visit = 0;
+  }
+  ThreadPool::GetInstance().ParallelFor(0, visits.size(), 7, [&visits](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+  for (auto& visit : visits) {
+    EXPECT_EQ(1, visit);
+  }
+}
+
+TEST_F(ThreadPoolTest, ParallelForEmptyRange) {
+  bool is_called = false;
+  ThreadPool::GetInstance().ParallelFor(5, 5, [&is_called](std::size_t, std::size_t) {
+    is_called = true;
+  });
+  EXPECT_FALSE(is_called);
+}
+
+TEST_F(ThreadPoolTest, ParallelForRethrowsException) {
+  EXPECT_THROW(ThreadPool::GetInstance().ParallelFor(0, 100, 10, [](std::size_t begin, std::size_t end) {
+    if (begin <= 50 and 50 < end) {
+      throw std::runtime_error("chunk failed");
+    }
+  }), std::runtime_error);
+}
+
+TEST_F(ThreadPoolTest, NestedParallelFor) {
+  std::atomic<std::size_t> sum {0};
+  ThreadPool::GetInstance().ParallelFor(0, 8, 8, [&sum](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+      ThreadPool::GetInstance().ParallelFor(0, 100, 4, [&sum](std::size_t inner_begin, std::size_t inner_end) {
+        sum += inner_end - inner_begin;
+      });
+    }
+  });
+  EXPECT_EQ(800u, sum);
+}
+
+/**
+ * Loop state must outlive the caller's stack frame until the last chunk is done with it
+ */
+TEST_F(ThreadPoolTest, ManyShortLoops) {
+  for (int round = 0; round < 2000; ++round) {
+    std::atomic<std::size_t> count {0};
+    ThreadPool::GetInstance().ParallelFor(0, 64, 16, [&count](std::size_t begin, std::size_t end) {
+      count += end - begin;
+    });
+    ASSERT_EQ(64u, count);
+  }
+}
+
+TEST_F(ThreadPoolTest, ConfigureAfterStart) {
+  const std::size_t num_of_threads = ThreadPool::GetInstance().get_num_of_threads();
+  EXPECT_FALSE(ThreadPool::Configure(num_of_threads + 5));
+  EXPECT_EQ(num_of_threads, ThreadPool::GetInstance().get_num_of_threads());
+}
+
+TEST_F(ThreadPoolTest, SubmitReturnsResult) {
+  auto future = ThreadPool::GetInstance().Submit([]() { return 42; });
+  EXPECT_EQ(42, future.get());
+}
+
+} /* namespace Test */
+} /* namespace Util */
+} /* namespace Vlab */
@@ -0,0 +1,30 @@
+/*
+ * ThreadPoolTest.h
+ *
+ *  Created on: Oct 16, 2026
+ *      Author: agent
+ */
+
+#ifndef UTILS_THREADPOOLTEST_H_
+#define UTILS_THREADPOOLTEST_H_
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "utils/ThreadPool.h"
+
+namespace Vlab {
+namespace Util {
+namespace Test {
+
+class ThreadPoolTest : public ::testing::Test {
+protected:
+  virtual void SetUp();
+  virtual void TearDown();
+
+};
+
+} /* namespace Test */
+} /* namespace Util */
+} /* namespace Vlab */
+
+#endif /* UTILS_THREADPOOLTEST_H_ */